@@ -60,6 +60,9 @@
 
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 0
 
+// Allow large messages over TCP, reassembled into heap-allocated packet buffers.
+#define CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES 64000
+
 #define CHIP_CONFIG_DATA_MANAGEMENT_CLIENT_EXPERIMENTAL 1
 
 #ifndef CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT
@@ -20,6 +20,7 @@
 #include <platform/PlatformManager.h>
 
 #include <app/clusters/network-commissioning/network-commissioning.h>
+#include <app/EventManagement.h>
 #include <app/server/OnboardingCodesUtil.h>
 #include <app/server/Server.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -40,6 +41,11 @@
 
 #include <platform/CommissionableDataProvider.h>
 #include <platform/DiagnosticDataProvider.h>
+#include <trace/trace.h>
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <platform/Linux/AsyncLogging.h>
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 
 #include <DeviceInfoProviderImpl.h>
 
@@ -72,10 +78,13 @@
 #endif
 #include <app/TestEventTriggerDelegate.h>
 
+#include <algorithm>
 #include <signal.h>
 
 #include "AppMain.h"
 #include "CommissionableInit.h"
+#include "MappedFileEventLog.h"
+#include "PrometheusMetrics.h"
 
 using namespace chip;
 using namespace chip::ArgParser;
@@ -122,6 +131,11 @@ void Cleanup()
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
 
     // TODO(16968): Lifecycle management of storage-using components like GroupDataProvider, etc
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    // Last, so that the messages logged until now are written.
+    chip::Logging::Platform::StopAsyncLogging();
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 }
 
 } // namespace
@@ -209,6 +223,34 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions)
     err = ParseArguments(argc, argv, customOptions);
     SuccessOrExit(err);
 
+#if defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+    // Before any thread is started, so that they all leave SIGUSR1 to the exporting one.
+    if (LinuxDeviceOptions::GetInstance().traceEventsFile != nullptr &&
+        !chip::Tracing::ExportJsonOnSignal(SIGUSR1, LinuxDeviceOptions::GetInstance().traceEventsFile))
+    {
+        ChipLogError(NotSpecified, "Failed to export trace events on SIGUSR1");
+    }
+#endif // defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    // Before any thread is started, as for SIGUSR1 above.
+    if (LinuxDeviceOptions::GetInstance().metricsFile != nullptr)
+    {
+        err = chip::System::Metrics::ExportPrometheusTextOnSignal(SIGUSR2, LinuxDeviceOptions::GetInstance().metricsFile);
+        SuccessOrExit(err);
+    }
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+
+    if (LinuxDeviceOptions::GetInstance().asyncLogging)
+    {
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+        err = chip::Logging::Platform::StartAsyncLogging();
+        SuccessOrExit(err);
+#else
+        ChipLogError(NotSpecified, "Async logging is not supported on this platform");
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+    }
+
 #ifdef CHIP_CONFIG_KVS_PATH
     if (LinuxDeviceOptions::GetInstance().KVS == nullptr)
     {
@@ -318,6 +360,29 @@ exit:
     return 0;
 }
 
+namespace {
+chip::app::MappedFileEventLog gPersistentEventLog;
+
+void InitPersistentEventLog()
+{
+    const LinuxDeviceOptions & options = LinuxDeviceOptions::GetInstance();
+    VerifyOrReturn(options.eventLogDir != nullptr);
+
+    chip::app::MappedFileEventLog::Config config;
+    config.mMaxSegments   = std::max<uint32_t>(1, options.eventLogMaxSize / config.mSegmentSize);
+    config.mMaxAgeSeconds = options.eventLogMaxAgeSeconds;
+
+    CHIP_ERROR err =
+        gPersistentEventLog.Init(options.eventLogDir, config, chip::app::EventManagement::GetInstance().GetLastEventNumber());
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to open persistent event log: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    chip::app::EventManagement::GetInstance().SetPersistentEventLog(&gPersistentEventLog);
+}
+} // namespace
+
 void ChipLinuxAppMainLoop()
 {
     static chip::CommonCaseDeviceServerInitParams initParams;
@@ -366,6 +431,8 @@ void ChipLinuxAppMainLoop()
     // Init ZCL Data Model and CHIP App Server
     Server::GetInstance().Init(initParams);
 
+    InitPersistentEventLog();
+
     // Now that the server has started and we are done with our startup logging,
     // log our discovery/onboarding information again so it's not lost in the
     // noise.
@@ -399,8 +466,30 @@ void ChipLinuxAppMainLoop()
     shellThread.join();
 #endif
 
+#if defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+    if (LinuxDeviceOptions::GetInstance().traceEventsFile != nullptr &&
+        !chip::Tracing::ExportJson(LinuxDeviceOptions::GetInstance().traceEventsFile))
+    {
+        ChipLogError(NotSpecified, "Failed to export trace events");
+    }
+#endif // defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    if (LinuxDeviceOptions::GetInstance().metricsFile != nullptr)
+    {
+        CHIP_ERROR err = chip::System::Metrics::ExportPrometheusText(LinuxDeviceOptions::GetInstance().metricsFile);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(NotSpecified, "Failed to export metrics: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+
     Server::GetInstance().Shutdown();
 
+    chip::app::EventManagement::GetInstance().SetPersistentEventLog(nullptr);
+    gPersistentEventLog.Shutdown();
+
     DeviceLayer::PlatformMgr().Shutdown();
 
     Cleanup();
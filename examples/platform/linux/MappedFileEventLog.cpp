@@ -0,0 +1,454 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "MappedFileEventLog.h"
+
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr uint32_t kSegmentMagic    = 0x5456454d; // "MEVT"
+constexpr uint16_t kSegmentVersion  = 2;
+constexpr char kSegmentFilePrefix[] = "events-";
+constexpr char kSegmentFileSuffix[] = ".seg";
+
+uint32_t CurrentEpochSeconds()
+{
+    System::Clock::Milliseconds64 now;
+    if (System::SystemClock().GetClock_RealTimeMS(now) != CHIP_NO_ERROR)
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Seconds32>(now).count());
+}
+
+// Schedule write-back of [aStart, aStart + aLength) without waiting for it.
+void SyncRange(uint8_t * aMapping, size_t aStart, size_t aLength)
+{
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t begin    = aStart - (aStart % pageSize);
+    msync(aMapping + begin, aStart + aLength - begin, MS_ASYNC);
+}
+
+} // namespace
+
+CHIP_ERROR MappedFileEventLog::Init(const char * aDirectory, const Config & aConfig, EventNumber aLastEventNumber)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aDirectory != nullptr && aDirectory[0] != '\0', CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aConfig.mSegmentSize > sizeof(SegmentHeader) && aConfig.mMaxSegments > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mkdir(aDirectory, 0700) != 0 && errno != EEXIST)
+    {
+        ChipLogError(EventLogging, "Unable to create event log directory %s: %s", aDirectory, strerror(errno));
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    DIR * dir = opendir(aDirectory);
+    VerifyOrReturnError(dir != nullptr, CHIP_ERROR_POSIX(errno));
+
+    mDirectory = aDirectory;
+    mConfig    = aConfig;
+
+    struct dirent * entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        const size_t nameLength   = strlen(entry->d_name);
+        const size_t prefixLength = sizeof(kSegmentFilePrefix) - 1;
+        const size_t suffixLength = sizeof(kSegmentFileSuffix) - 1;
+        if (nameLength <= prefixLength + suffixLength || strncmp(entry->d_name, kSegmentFilePrefix, prefixLength) != 0 ||
+            strcmp(entry->d_name + nameLength - suffixLength, kSegmentFileSuffix) != 0)
+        {
+            continue;
+        }
+
+        std::string path = mDirectory + "/" + entry->d_name;
+        CHIP_ERROR err   = LoadSegment(path);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(EventLogging, "Discarding event log segment %s: %" CHIP_ERROR_FORMAT, path.c_str(), err.Format());
+            unlink(path.c_str());
+        }
+    }
+    closedir(dir);
+
+    std::sort(mSegments.begin(), mSegments.end(),
+              [](const Segment & a, const Segment & b) { return a.Header()->mSequence < b.Header()->mSequence; });
+
+    for (const auto & segment : mSegments)
+    {
+        if (!segment.mIndex.empty() && segment.Header()->mMaxEventNumber > aLastEventNumber)
+        {
+            // The event number counter went backwards: the stored events can no longer be told apart from new ones.
+            ChipLogError(EventLogging, "Persistent event log is ahead of event number 0x" ChipLogFormatX64 ", clearing it",
+                         ChipLogValueX64(aLastEventNumber));
+            while (!mSegments.empty())
+            {
+                RemoveOldestSegment();
+            }
+            break;
+        }
+    }
+
+    while (mSegments.size() > mConfig.mMaxSegments)
+    {
+        RemoveOldestSegment();
+    }
+    RemoveExpiredSegments();
+    mNextSequence = mSegments.empty() ? 0 : mSegments.back().Header()->mSequence + 1;
+
+    ChipLogProgress(EventLogging, "Persistent event log in %s: %u segment(s) recovered", mDirectory.c_str(),
+                    static_cast<unsigned>(mSegments.size()));
+    return CHIP_NO_ERROR;
+}
+
+void MappedFileEventLog::Shutdown()
+{
+    for (auto & segment : mSegments)
+    {
+        CloseSegment(segment, false /* aRemoveFile */);
+    }
+    mSegments.clear();
+    mDirectory.clear();
+}
+
+CHIP_ERROR MappedFileEventLog::AppendEvictedEvent(EventNumber aEventNumber, const TLV::TLVReader & aReader)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    RemoveExpiredSegments();
+
+    if (mSegments.empty())
+    {
+        ReturnErrorOnFailure(CreateSegment());
+    }
+
+    CHIP_ERROR err = AppendToSegment(mSegments.back(), aEventNumber, aReader);
+    if ((err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY) && !mSegments.back().mIndex.empty())
+    {
+        // Current segment is full; roll over to a new one.
+        ReturnErrorOnFailure(CreateSegment());
+        err = AppendToSegment(mSegments.back(), aEventNumber, aReader);
+    }
+    return err;
+}
+
+CHIP_ERROR MappedFileEventLog::GetNextEvent(EventNumber aEventMin, EventNumber & aEventNumber, ByteSpan & aEncodedEvent)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_NOT_FOUND);
+
+    const Segment * found     = nullptr;
+    const IndexEntry * entry  = nullptr;
+    const IndexEntry eventMin = { aEventMin, 0, 0 };
+    for (const auto & segment : mSegments)
+    {
+        if (segment.mIndex.empty() || segment.Header()->mMaxEventNumber < aEventMin ||
+            (entry != nullptr && segment.Header()->mMinEventNumber >= entry->mEventNumber))
+        {
+            continue;
+        }
+
+        auto candidate = std::lower_bound(segment.mIndex.begin(), segment.mIndex.end(), eventMin);
+        if (candidate != segment.mIndex.end() && (entry == nullptr || candidate->mEventNumber < entry->mEventNumber))
+        {
+            found = &segment;
+            entry = &*candidate;
+        }
+    }
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NOT_FOUND);
+
+    aEventNumber  = entry->mEventNumber;
+    aEncodedEvent = ByteSpan(found->Data() + entry->mOffset, entry->mLength);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFileEventLog::FabricRemoved(FabricIndex aFabricIndex)
+{
+    for (auto & segment : mSegments)
+    {
+        const uint32_t committedLength = segment.Header()->mCommittedLength;
+        for (const auto & entry : segment.mIndex)
+        {
+            TLV::TLVReader reader;
+            TLV::TLVType outerType;
+            TLV::TLVType eventDataType;
+            reader.Init(segment.Data() + entry.mOffset, committedLength - entry.mOffset);
+            if (reader.Next() != CHIP_NO_ERROR || reader.EnterContainer(outerType) != CHIP_NO_ERROR ||
+                reader.Next(TLV::ContextTag(to_underlying(EventReportIB::Tag::kEventData))) != CHIP_NO_ERROR ||
+                reader.EnterContainer(eventDataType) != CHIP_NO_ERROR)
+            {
+                continue;
+            }
+
+            while (reader.Next() == CHIP_NO_ERROR)
+            {
+                if (reader.GetTag() != TLV::ProfileTag(kEventManagementProfile, kFabricIndexTag))
+                {
+                    continue;
+                }
+
+                FabricIndex fabricIndex = kUndefinedFabricIndex;
+                if (reader.Get(fabricIndex) == CHIP_NO_ERROR && fabricIndex == aFabricIndex)
+                {
+                    // Same minimal-encoding assumption as EventManagement::FabricRemovedCB: the value is the single byte
+                    // right before the read point.
+                    const size_t valueOffset = static_cast<size_t>(reader.GetReadPoint() - segment.mpMapping) - 1;
+                    segment.mpMapping[valueOffset] = kUndefinedFabricIndex;
+                    SyncRange(segment.mpMapping, valueOffset, 1);
+                }
+                break;
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFileEventLog::LoadSegment(const std::string & aPath)
+{
+    int fd = open(aPath.c_str(), O_RDWR | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0 || static_cast<size_t>(fileInfo.st_size) <= sizeof(SegmentHeader) ||
+        static_cast<uint64_t>(fileInfo.st_size) > UINT32_MAX)
+    {
+        close(fd);
+        return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+
+    void * mapping = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    VerifyOrReturnError(mapping != MAP_FAILED, CHIP_ERROR_POSIX(errno));
+
+    Segment segment;
+    segment.mPath        = aPath;
+    segment.mpMapping    = static_cast<uint8_t *>(mapping);
+    segment.mMappingSize = static_cast<size_t>(fileInfo.st_size);
+
+    SegmentHeader * header = segment.Header();
+    if (header->mMagic != kSegmentMagic || header->mVersion != kSegmentVersion)
+    {
+        CloseSegment(segment, false /* aRemoveFile */);
+        return CHIP_ERROR_VERSION_MISMATCH;
+    }
+
+    // Rebuild the index, and stop at the first event that does not decode: anything past it was not fully written.
+    const uint32_t committedLength = std::min(header->mCommittedLength, segment.Capacity());
+    TLV::TLVReader reader;
+    reader.Init(segment.Data(), committedLength);
+    uint32_t validLength = 0;
+    while (true)
+    {
+        const uint32_t offset = reader.GetLengthRead();
+        EventNumber eventNumber;
+        if (reader.Next() != CHIP_NO_ERROR || ReadEventNumber(reader, eventNumber) != CHIP_NO_ERROR ||
+            reader.Skip() != CHIP_NO_ERROR)
+        {
+            break;
+        }
+        validLength = reader.GetLengthRead();
+        AddToIndex(segment, { eventNumber, offset, validLength - offset });
+    }
+
+    if (validLength != header->mCommittedLength)
+    {
+        ChipLogError(EventLogging, "Truncating event log segment %s from %u to %u bytes", aPath.c_str(),
+                     static_cast<unsigned>(header->mCommittedLength), static_cast<unsigned>(validLength));
+        header->mCommittedLength = validLength;
+        SyncRange(segment.mpMapping, 0, sizeof(SegmentHeader));
+    }
+    if (!segment.mIndex.empty())
+    {
+        header->mMinEventNumber = segment.mIndex.front().mEventNumber;
+        header->mMaxEventNumber = segment.mIndex.back().mEventNumber;
+    }
+
+    mSegments.push_back(std::move(segment));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFileEventLog::CreateSegment()
+{
+    while (mSegments.size() >= mConfig.mMaxSegments)
+    {
+        RemoveOldestSegment();
+    }
+
+    char fileName[sizeof(kSegmentFilePrefix) + 16 + sizeof(kSegmentFileSuffix)];
+    snprintf(fileName, sizeof(fileName), "%s%016" PRIX64 "%s", kSegmentFilePrefix, mNextSequence, kSegmentFileSuffix);
+    std::string path = mDirectory + "/" + fileName;
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+    if (ftruncate(fd, static_cast<off_t>(mConfig.mSegmentSize)) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(fd);
+        unlink(path.c_str());
+        return err;
+    }
+
+    void * mapping = mmap(nullptr, mConfig.mSegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        unlink(path.c_str());
+        return err;
+    }
+
+    Segment segment;
+    segment.mPath        = path;
+    segment.mpMapping    = static_cast<uint8_t *>(mapping);
+    segment.mMappingSize = mConfig.mSegmentSize;
+
+    SegmentHeader * header          = segment.Header();
+    header->mMagic                  = kSegmentMagic;
+    header->mVersion                = kSegmentVersion;
+    header->mReserved               = 0;
+    header->mSequence               = mNextSequence;
+    header->mMinEventNumber         = 0;
+    header->mMaxEventNumber         = 0;
+    header->mCommittedLength        = 0;
+    header->mLastAppendEpochSeconds = CurrentEpochSeconds();
+    SyncRange(segment.mpMapping, 0, sizeof(SegmentHeader));
+
+    mSegments.push_back(std::move(segment));
+    mNextSequence++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedFileEventLog::AppendToSegment(Segment & aSegment, EventNumber aEventNumber, const TLV::TLVReader & aReader)
+{
+    SegmentHeader * header         = aSegment.Header();
+    const uint32_t committedLength = header->mCommittedLength;
+
+    TLV::TLVReader reader;
+    reader.Init(aReader);
+    TLV::TLVWriter writer;
+    writer.Init(aSegment.Data() + committedLength, aSegment.Capacity() - committedLength);
+    ReturnErrorOnFailure(writer.CopyElement(reader));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    const uint32_t length = static_cast<uint32_t>(writer.GetLengthWritten());
+    AddToIndex(aSegment, { aEventNumber, committedLength, length });
+    header->mMinEventNumber         = aSegment.mIndex.front().mEventNumber;
+    header->mMaxEventNumber         = aSegment.mIndex.back().mEventNumber;
+    header->mLastAppendEpochSeconds = CurrentEpochSeconds();
+
+    // Publishing the new committed length last is what makes the event visible after a restart.
+    header->mCommittedLength = committedLength + length;
+
+    SyncRange(aSegment.mpMapping, sizeof(SegmentHeader) + committedLength, length);
+    SyncRange(aSegment.mpMapping, 0, sizeof(SegmentHeader));
+    return CHIP_NO_ERROR;
+}
+
+void MappedFileEventLog::RemoveOldestSegment()
+{
+    VerifyOrReturn(!mSegments.empty());
+    CloseSegment(mSegments.front(), true /* aRemoveFile */);
+    mSegments.erase(mSegments.begin());
+}
+
+void MappedFileEventLog::RemoveExpiredSegments()
+{
+    VerifyOrReturn(mConfig.mMaxAgeSeconds != 0);
+
+    const uint32_t now = CurrentEpochSeconds();
+    VerifyOrReturn(now != 0);
+
+    while (!mSegments.empty())
+    {
+        const uint32_t lastAppend = mSegments.front().Header()->mLastAppendEpochSeconds;
+        if (lastAppend == 0 || lastAppend > now || now - lastAppend <= mConfig.mMaxAgeSeconds)
+        {
+            break;
+        }
+        RemoveOldestSegment();
+    }
+}
+
+void MappedFileEventLog::CloseSegment(Segment & aSegment, bool aRemoveFile)
+{
+    if (aSegment.mpMapping != nullptr)
+    {
+        if (!aRemoveFile)
+        {
+            msync(aSegment.mpMapping, aSegment.mMappingSize, MS_SYNC);
+        }
+        munmap(aSegment.mpMapping, aSegment.mMappingSize);
+        aSegment.mpMapping = nullptr;
+    }
+    if (aRemoveFile)
+    {
+        unlink(aSegment.mPath.c_str());
+    }
+    aSegment.mIndex.clear();
+}
+
+void MappedFileEventLog::AddToIndex(Segment & aSegment, const IndexEntry & aEntry)
+{
+    // Events mostly arrive in increasing order, so this is usually an append.
+    aSegment.mIndex.insert(std::upper_bound(aSegment.mIndex.begin(), aSegment.mIndex.end(), aEntry), aEntry);
+}
+
+CHIP_ERROR MappedFileEventLog::ReadEventNumber(const TLV::TLVReader & aEventReader, EventNumber & aEventNumber)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    TLV::TLVType eventDataType;
+    reader.Init(aEventReader);
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(to_underlying(EventReportIB::Tag::kEventData))));
+    ReturnErrorOnFailure(reader.EnterContainer(eventDataType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == TLV::ContextTag(to_underlying(EventDataIB::Tag::kEventNumber)))
+        {
+            return reader.Get(aEventNumber);
+        }
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_ERROR_NOT_FOUND : err;
+}
+
+} // namespace app
+} // namespace chip
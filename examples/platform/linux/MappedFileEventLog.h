@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/PersistentEventLog.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/**
+ * Persistent event tier backed by a directory of memory-mapped segment files.
+ *
+ * Each segment file holds a small header followed by the events, encoded
+ * back-to-back exactly as they were in the RAM event buffers, in the order
+ * they were evicted.  That is not event number order, since each priority
+ * leaves RAM at its own pace: every segment keeps an in-memory index sorted
+ * by event number, and its lowest and highest event numbers, to look events
+ * up.  An event is only visible once the header's committed length covers
+ * it, so a crash in the middle of an append loses at most that event.  On
+ * Init the segments found in the directory are scanned and truncated at the
+ * first event that does not decode.
+ *
+ * Retention is bounded by the number of segments (hence by size) and,
+ * optionally, by the age of the last event appended to a segment.  Segments
+ * are removed in the order they were created.
+ */
+class MappedFileEventLog : public PersistentEventLog
+{
+public:
+    struct Config
+    {
+        uint32_t mSegmentSize   = 256 * 1024; ///< Size of each segment file, in bytes.
+        uint32_t mMaxSegments   = 16;         ///< Oldest segments are removed beyond this count.
+        uint32_t mMaxAgeSeconds = 0;          ///< Segments last written before this age are removed; 0 disables.
+    };
+
+    MappedFileEventLog() = default;
+    ~MappedFileEventLog() override { Shutdown(); }
+
+    MappedFileEventLog(const MappedFileEventLog &) = delete;
+    MappedFileEventLog & operator=(const MappedFileEventLog &) = delete;
+
+    /**
+     * Open (creating it if needed) the segment directory and recover the
+     * segments already present in it.
+     *
+     * @param[in] aLastEventNumber The last event number vended by
+     *                             EventManagement.  Stored events numbered
+     *                             after it predate a reset of the event number
+     *                             counter, e.g. by a factory reset that kept
+     *                             the directory, and the log is cleared.
+     */
+    CHIP_ERROR Init(const char * aDirectory, const Config & aConfig, EventNumber aLastEventNumber);
+
+    /**
+     * Flush and unmap all segments.
+     */
+    void Shutdown();
+
+    // PersistentEventLog implementation
+    CHIP_ERROR AppendEvictedEvent(EventNumber aEventNumber, const TLV::TLVReader & aReader) override;
+    CHIP_ERROR GetNextEvent(EventNumber aEventMin, EventNumber & aEventNumber, ByteSpan & aEncodedEvent) override;
+    CHIP_ERROR FabricRemoved(FabricIndex aFabricIndex) override;
+
+private:
+    struct SegmentHeader
+    {
+        uint32_t mMagic;
+        uint16_t mVersion;
+        uint16_t mReserved;
+        uint64_t mSequence;               ///< Creation order of the segment.
+        uint64_t mMinEventNumber;         ///< Lowest event number stored; meaningless while the segment is empty.
+        uint64_t mMaxEventNumber;         ///< Highest event number stored; meaningless while the segment is empty.
+        uint32_t mCommittedLength;        ///< Bytes of valid event data following the header.
+        uint32_t mLastAppendEpochSeconds; ///< 0 when real time was not available.
+    };
+
+    struct IndexEntry
+    {
+        EventNumber mEventNumber;
+        uint32_t mOffset; ///< Offset of the event in the data area.
+        uint32_t mLength; ///< Encoded length of the event.
+
+        bool operator<(const IndexEntry & aOther) const { return mEventNumber < aOther.mEventNumber; }
+    };
+
+    struct Segment
+    {
+        std::string mPath;
+        uint8_t * mpMapping = nullptr;
+        size_t mMappingSize = 0;
+        // Every committed event, sorted by event number.
+        std::vector<IndexEntry> mIndex;
+
+        SegmentHeader * Header() const { return reinterpret_cast<SegmentHeader *>(mpMapping); }
+        uint8_t * Data() const { return mpMapping + sizeof(SegmentHeader); }
+        uint32_t Capacity() const { return static_cast<uint32_t>(mMappingSize - sizeof(SegmentHeader)); }
+    };
+
+    CHIP_ERROR LoadSegment(const std::string & aPath);
+    CHIP_ERROR CreateSegment();
+    CHIP_ERROR AppendToSegment(Segment & aSegment, EventNumber aEventNumber, const TLV::TLVReader & aReader);
+    void RemoveOldestSegment();
+    void RemoveExpiredSegments();
+    void CloseSegment(Segment & aSegment, bool aRemoveFile);
+    static void AddToIndex(Segment & aSegment, const IndexEntry & aEntry);
+    bool IsInitialized() const { return !mDirectory.empty(); }
+
+    static CHIP_ERROR ReadEventNumber(const TLV::TLVReader & aEventReader, EventNumber & aEventNumber);
+
+    std::string mDirectory;
+    Config mConfig;
+    std::vector<Segment> mSegments; ///< Oldest first.
+    uint64_t mNextSequence = 0;
+};
+
+} // namespace app
+} // namespace chip
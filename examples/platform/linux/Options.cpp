@@ -73,6 +73,12 @@ enum
     kOptionCSRResponseCSRExistingKeyPair                = 0x101e,
     kDeviceOption_TestEventTriggerEnableKey             = 0x101f,
     kCommissionerOption_FabricID                        = 0x1020,
+    kDeviceOption_EventLogDir                           = 0x1021,
+    kDeviceOption_EventLogMaxSize                       = 0x1022,
+    kDeviceOption_EventLogMaxAge                        = 0x1023,
+    kDeviceOption_TraceEventsFile                       = 0x1024,
+    kDeviceOption_MetricsFile                           = 0x1025,
+    kDeviceOption_AsyncLogging                          = 0x1026,
 };
 
 constexpr unsigned kAppUsageLength = 64;
@@ -119,6 +125,16 @@ OptionDef sDeviceOptionDefs[] = {
     { "cert_error_attestation_signature_invalid", kNoArgument, kOptionCSRResponseAttestationSignatureInvalid },
     { "enable-key", kArgumentRequired, kDeviceOption_TestEventTriggerEnableKey },
     { "commissioner-fabric-id", kArgumentRequired, kCommissionerOption_FabricID },
+    { "event-log-dir", kArgumentRequired, kDeviceOption_EventLogDir },
+    { "event-log-max-size", kArgumentRequired, kDeviceOption_EventLogMaxSize },
+    { "event-log-max-age", kArgumentRequired, kDeviceOption_EventLogMaxAge },
+#if defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+    { "trace-events-file", kArgumentRequired, kDeviceOption_TraceEventsFile },
+#endif // defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+#if CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    { "metrics-file", kArgumentRequired, kDeviceOption_MetricsFile },
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    { "async-logging", kNoArgument, kDeviceOption_AsyncLogging },
     {}
 };
 
@@ -198,6 +214,16 @@ const char * sDeviceOptionHelp =
     "\n"
     "  --interface-id <interface>\n"
     "       A interface id to advertise on.\n"
+    "\n"
+    "  --event-log-dir <directory>\n"
+    "       Keep events evicted from the in-memory event buffers in memory-mapped segment files in <directory>,\n"
+    "       so they survive restarts and can still be read by lagging subscribers.\n"
+    "\n"
+    "  --event-log-max-size <bytes>\n"
+    "       Upper bound on the size of the persistent event log (default is 4 MiB).\n"
+    "\n"
+    "  --event-log-max-age <seconds>\n"
+    "       Discard persisted events older than this (default is 0, no age limit).\n"
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
     "\n"
     "  --trace_file <file>\n"
@@ -207,6 +233,17 @@ const char * sDeviceOptionHelp =
     "  --trace_decode <1/0>\n"
     "       A value of 1 enables traces decoding, 0 disables this (default 0).\n"
 #endif // CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
+#if defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+    "  --trace-events-file <file>\n"
+    "       Write the trace events to the provided file, as Chrome/Perfetto trace JSON, on SIGUSR1 and on exit.\n"
+#endif // defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+#if CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    "  --metrics-file <file>\n"
+    "       Write the runtime metrics to the provided file, in the Prometheus text format, on SIGUSR2 and on exit.\n"
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    "  --async-logging\n"
+    "       Format and write log messages on a background thread instead of the logging one. Messages logged while its\n"
+    "       queue is full are dropped.\n"
     "  --cert_error_csr_incorrect_type\n"
     "       Configure the CSRResponse to be built with an invalid CSR type.\n"
     "  --cert_error_csr_existing_keypair\n"
@@ -465,12 +502,48 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
 
         break;
     }
+    case kDeviceOption_EventLogDir:
+        LinuxDeviceOptions::GetInstance().eventLogDir = aValue;
+        break;
+
+    case kDeviceOption_EventLogMaxSize:
+        if (!ParseInt(aValue, LinuxDeviceOptions::GetInstance().eventLogMaxSize))
+        {
+            PrintArgError("%s: invalid value specified for event log max size: %s\n", aProgram, aValue);
+            retval = false;
+        }
+        break;
+
+    case kDeviceOption_EventLogMaxAge:
+        if (!ParseInt(aValue, LinuxDeviceOptions::GetInstance().eventLogMaxAgeSeconds))
+        {
+            PrintArgError("%s: invalid value specified for event log max age: %s\n", aProgram, aValue);
+            retval = false;
+        }
+        break;
+
     case kCommissionerOption_FabricID: {
         char * eptr;
         LinuxDeviceOptions::GetInstance().commissionerFabricId = (chip::FabricId) strtoull(aValue, &eptr, 0);
         break;
     }
 
+#if defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+    case kDeviceOption_TraceEventsFile:
+        LinuxDeviceOptions::GetInstance().traceEventsFile = aValue;
+        break;
+#endif // defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+    case kDeviceOption_MetricsFile:
+        LinuxDeviceOptions::GetInstance().metricsFile = aValue;
+        break;
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+
+    case kDeviceOption_AsyncLogging:
+        LinuxDeviceOptions::GetInstance().asyncLogging = true;
+        break;
+
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
         retval = false;
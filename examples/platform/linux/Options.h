@@ -61,6 +61,12 @@ struct LinuxDeviceOptions
     chip::CSRResponseOptions mCSRResponseOptions;
     uint8_t testEventTriggerEnableKey[16] = { 0 };
     chip::FabricId commissionerFabricId   = chip::kUndefinedFabricId;
+    const char * eventLogDir              = nullptr;
+    uint32_t eventLogMaxSize              = 4 * 1024 * 1024;
+    uint32_t eventLogMaxAgeSeconds        = 0;
+    const char * traceEventsFile          = nullptr;
+    const char * metricsFile              = nullptr;
+    bool asyncLogging                     = false;
 
     static LinuxDeviceOptions & GetInstance();
 };
@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "PrometheusMetrics.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemMetrics.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+
+namespace chip {
+namespace System {
+namespace Metrics {
+namespace {
+
+void WriteHistogram(FILE * file, const char * name, const HistogramData & data)
+{
+    fprintf(file, "# TYPE %s histogram\n", name);
+
+    // Buckets are cumulative, and only listed up to the last one counting a value: the others would repeat the count.
+    size_t lastBucket = kHistogramBuckets;
+    while (lastBucket > 0 && data.mBuckets[lastBucket - 1] == 0)
+    {
+        lastBucket--;
+    }
+
+    uint64_t cumulativeCount = 0;
+    for (size_t index = 0; index < lastBucket && index + 1 < kHistogramBuckets; index++)
+    {
+        cumulativeCount += data.mBuckets[index];
+        fprintf(file, "%s_bucket{le=\"%" PRIu32 "\"} %" PRIu64 "\n", name, GetBucketLowerBound(index + 1) - 1, cumulativeCount);
+    }
+    fprintf(file, "%s_bucket{le=\"+Inf\"} %" PRIu64 "\n", name, data.mCount);
+    fprintf(file, "%s_sum %" PRIu64 "\n", name, data.mSum);
+    fprintf(file, "%s_count %" PRIu64 "\n", name, data.mCount);
+
+    fprintf(file, "# TYPE %s_max gauge\n", name);
+    fprintf(file, "%s_max %" PRIu32 "\n", name, data.mMax);
+}
+
+void WriteSnapshot(FILE * file, const Snapshot & snapshot)
+{
+    for (int counter = 0; counter < kNumCounters; counter++)
+    {
+        const char * name = GetName(static_cast<Counter>(counter));
+        fprintf(file, "# TYPE %s counter\n%s %" PRIu64 "\n", name, name, snapshot.mCounters[counter]);
+    }
+
+    for (int gauge = 0; gauge < kNumGauges; gauge++)
+    {
+        const char * name = GetName(static_cast<Gauge>(gauge));
+        fprintf(file, "# TYPE %s gauge\n%s %" PRId32 "\n", name, name, snapshot.mGauges[gauge]);
+    }
+
+    for (int histogram = 0; histogram < kNumHistograms; histogram++)
+    {
+        WriteHistogram(file, GetName(static_cast<Histogram>(histogram)), snapshot.mHistograms[histogram]);
+    }
+}
+
+} // namespace
+
+CHIP_ERROR ExportPrometheusText(const char * aPath)
+{
+    Snapshot snapshot;
+
+    DeviceLayer::PlatformMgr().LockChipStack();
+    GetSnapshot(snapshot);
+    DeviceLayer::PlatformMgr().UnlockChipStack();
+
+    std::string tmpPath = std::string(aPath) + ".tmp";
+    FILE * file         = fopen(tmpPath.c_str(), "w");
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_POSIX(errno));
+
+    WriteSnapshot(file, snapshot);
+
+    bool written = !ferror(file);
+    written      = (fclose(file) == 0) && written;
+    if (!written || rename(tmpPath.c_str(), aPath) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        remove(tmpPath.c_str());
+        return err;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ExportPrometheusTextOnSignal(int aSignalNumber, const char * aPath)
+{
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, aSignalNumber);
+    int status = pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    VerifyOrReturnError(status == 0, CHIP_ERROR_POSIX(status));
+
+    std::string exportPath(aPath);
+    std::thread([signals, exportPath]() {
+        int signal;
+        while (sigwait(&signals, &signal) == 0)
+        {
+            CHIP_ERROR err = ExportPrometheusText(exportPath.c_str());
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(NotSpecified, "Failed to export metrics to %s: %" CHIP_ERROR_FORMAT, exportPath.c_str(), err.Format());
+            }
+        }
+    }).detach();
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Metrics
+} // namespace System
+} // namespace chip
@@ -0,0 +1,45 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+namespace chip {
+namespace System {
+namespace Metrics {
+
+/**
+ * Write a snapshot of the metrics of SystemMetrics.h to the file at aPath, in the Prometheus text exposition format
+ * (e.g. for the textfile collector of node_exporter).
+ *
+ * The file is written aside and renamed, so that readers never see it partly written.  Takes the CHIP stack lock.
+ */
+CHIP_ERROR ExportPrometheusText(const char * aPath);
+
+/**
+ * Export the metrics to aPath each time the process receives aSignalNumber (e.g. SIGUSR2).
+ *
+ * The signal is blocked and waited for by a thread of its own, so this must be called before any other thread is
+ * started, for them to inherit the blocked signal.
+ */
+CHIP_ERROR ExportPrometheusTextOnSignal(int aSignalNumber, const char * aPath);
+
+} // namespace Metrics
+} // namespace System
+} // namespace chip
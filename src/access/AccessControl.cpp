@@ -23,6 +23,8 @@
 
 #include "AccessControl.h"
 
+#include <system/SystemMetrics.h>
+
 namespace chip {
 namespace Access {
 
@@ -307,6 +309,29 @@ void AccessControl::RemoveEntryListener(EntryListener & listener)
 
 CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                 Privilege requestPrivilege)
+{
+    SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_AccessControlChecks);
+
+    CHIP_ERROR result;
+    {
+        SYSTEM_METRICS_RECORD_LATENCY_SCOPE(System::Metrics::kHistogram_AccessControlCheckLatencyUs);
+        result = CheckImpl(subjectDescriptor, requestPath, requestPrivilege);
+    }
+
+    // Checks that could not be made, e.g. before initialization, are not denials.
+    if (result == CHIP_ERROR_ACCESS_DENIED)
+    {
+        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_AccessControlDenials);
+    }
+    else if (result != CHIP_NO_ERROR)
+    {
+        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_AccessControlErrors);
+    }
+    return result;
+}
+
+CHIP_ERROR AccessControl::CheckImpl(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                    Privilege requestPrivilege)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
 
@@ -651,6 +651,8 @@ public:
 private:
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
+    CHIP_ERROR CheckImpl(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
+
     bool IsValid(const Entry & entry);
 
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
@@ -447,6 +447,16 @@ public:
     void SetNext(AttributeAccessInterface * aNext) { mNext = aNext; }
     AttributeAccessInterface * GetNext() const { return mNext; }
 
+    /**
+     * Mechanism for keeping track of the AttributeAccessInterfaces sharing a bucket of an
+     * InterfaceDispatchTable.
+     */
+    void SetNextInBucket(AttributeAccessInterface * aNext) { mNextInBucket = aNext; }
+    AttributeAccessInterface * GetNextInBucket() const { return mNextInBucket; }
+
+    const Optional<EndpointId> & GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Check whether a this AttributeAccessInterface is relevant for a
      * particular endpoint+cluster.  An AttributeAccessInterface will be used
@@ -478,7 +488,8 @@ public:
 private:
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
-    AttributeAccessInterface * mNext = nullptr;
+    AttributeAccessInterface * mNext         = nullptr;
+    AttributeAccessInterface * mNextInBucket = nullptr;
 };
 
 } // namespace app
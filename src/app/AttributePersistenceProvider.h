@@ -69,6 +69,18 @@ public:
      */
     virtual CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
                                  MutableByteSpan & aValue) = 0;
+
+    /**
+     * Called when all the attributes of an endpoint are loaded, e.g. on startup, before ReadValue is called for each
+     * of its non-volatile attributes.  Implementations can fetch what those reads need at once, and must answer them as
+     * ReadValue otherwise would.
+     *
+     * EndBulkRead is called after the last of those reads.  Bulk reads do not nest.
+     *
+     * @param [in] aEndpointId the endpoint whose attributes are loaded.
+     */
+    virtual void StartBulkRead(EndpointId aEndpointId) {}
+    virtual void EndBulkRead() {}
 };
 
 /**
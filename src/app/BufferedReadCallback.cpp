@@ -20,12 +20,13 @@
 #include "lib/core/CHIPTLVTags.h"
 #include "lib/core/CHIPTLVTypes.h"
 #include "protocols/interaction_model/Constants.h"
-#include "system/SystemPacketBuffer.h"
-#include "system/TLVPacketBufferBackingStore.h"
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
 #include <lib/support/ScopedBuffer.h>
 
+#include <algorithm>
+#include <string.h>
+
 namespace chip {
 namespace app {
 
@@ -45,91 +46,122 @@ void BufferedReadCallback::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
+namespace {
+
+//
+// Initial size of the list arena. It grows by doubling from there, so a handful of reallocations at most
+// is needed to reach the size of the largest list received by a given callback.
+//
+constexpr size_t kInitialListArenaSize = 256;
+
+//
+// Upper bound on the size of the control octet, (anonymous) tag and length field of a TLV element,
+// which are already consumed by the reader positioned on the element.
+//
+constexpr size_t kMaxElementHeadSize = 1 + sizeof(uint64_t);
+
+//
+// Control octets of an anonymous array start and of an end of container.
+//
+constexpr uint8_t kAnonymousArrayStart = static_cast<uint8_t>(TLV::TLVElementType::Array);
+constexpr uint8_t kEndOfContainer      = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
+
+} // namespace
+
+void BufferedReadCallback::ReleaseListArena()
 {
-    TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    mListArena.Free();
+    mListArenaLength = 0;
+}
 
-    //
-    // To generate the final reconstituted list, we need to allocate a contiguous
-    // buffer than can hold the entirety of its contents. To do so, we need to figure out
-    // how big a buffer to allocate. This requires walking the buffered list items and computing their TLV sizes,
-    // summing them all up and adding a bit of slop to account for the TLV array the list elements will go into.
-    //
-    // The alternative was to use a PacketBufferTLVWriter backed by chained packet buffers to
-    // write out the list - this would have removed the need for this first pass. However,
-    // we cannot actually back a TLVReader with a chained buffer since that violates the ability
-    // for us to create readers off-of readers. Each reader would assume exclusive ownership of the chained
-    // buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
-    //
-    // To avoid that, a single contiguous buffer is the best likely approach for now.
-    //
-    uint32_t totalBufSize = 0;
-    for (size_t i = 0; i < mBufferedList.size(); i++)
+CHIP_ERROR BufferedReadCallback::EnsureListArenaCapacity(size_t aRequiredLength)
+{
+    if (aRequiredLength <= mListArena.AllocatedSize())
     {
-        totalBufSize += mBufferedList[i]->TotalLength();
+        return CHIP_NO_ERROR;
     }
 
-    //
-    // Size of the start container and end container are just 1 byte each, but, let's just be safe.
-    //
-    totalBufSize += 4;
-
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    size_t newSize = std::max(mListArena.AllocatedSize(), kInitialListArenaSize);
+    while (newSize < aRequiredLength)
+    {
+        newSize *= 2;
+    }
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
+    Platform::ScopedMemoryBufferWithSize<uint8_t> newArena;
+    newArena.Alloc(newSize);
+    VerifyOrReturnError(newArena.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    for (auto & bufHandle : mBufferedList)
+    if (mListArenaLength != 0)
     {
-        System::PacketBufferTLVReader reader;
+        memcpy(newArena.Get(), mListArena.Get(), mListArenaLength);
+    }
 
-        reader.Init(std::move(bufHandle));
+    //
+    // Moving into a ScopedMemoryBuffer does not release the buffer it previously held.
+    //
+    mListArena.Free();
+    mListArena = std::move(newArena);
+    return CHIP_NO_ERROR;
+}
 
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::TLVReader & aReader)
+{
+    //
+    // The list items were written to the arena as the elements of an anonymous array as they
+    // arrived, so all that is left is to terminate the array. A single contiguous buffer is used
+    // (rather than chained packet buffers) since readers created off-of this reader need to be able
+    // to share it.
+    //
+    if (mListArenaLength == 0)
+    {
+        ReturnErrorOnFailure(EnsureListArenaCapacity(1));
+        mListArena[mListArenaLength++] = kAnonymousArrayStart;
     }
 
-    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(EnsureListArenaCapacity(mListArenaLength + 1));
+    mListArena[mListArenaLength++] = kEndOfContainer;
 
-    writer.Finalize(backingBuffer);
-
-    aReader.Init(std::move(backingBuffer), totalBufSize);
+    mListArenaHighWaterMark = std::max(mListArenaHighWaterMark, mListArenaLength);
 
+    aReader.Init(mListArena.Get(), mListArenaLength);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
+    TLV::TLVWriter writer;
+    TLV::TLVReader sizingReader;
 
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // A list built solely out of AppendItem operations has not opened its array yet.
+    //
+    if (mListArenaLength == 0)
+    {
+        ReturnErrorOnFailure(EnsureListArenaCapacity(kInitialListArenaSize));
+        mListArena[mListArenaLength++] = kAnonymousArrayStart;
+    }
+
     //
-    // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
-    // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
-    // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
-    // we can improve this.
+    // Size the element by skipping over it on a copy of the reader. The reader's current position is already
+    // set past the control octet, tag and length, so account for those separately. Sizing up front matters:
+    // CopyElement advances the source reader even when it fails, so it cannot be retried after growing the arena.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+    sizingReader.Init(reader);
+    uint32_t lengthReadBefore = sizingReader.GetLengthRead();
+    ReturnErrorOnFailure(sizingReader.Skip());
+    size_t maxElementSize = static_cast<size_t>(sizingReader.GetLengthRead() - lengthReadBefore) + kMaxElementHeadSize;
 
-    writer.Init(std::move(handle), false);
+    //
+    // Keep room for the end of container octet written by GenerateListTLV.
+    //
+    ReturnErrorOnFailure(EnsureListArenaCapacity(mListArenaLength + maxElementSize + 1));
 
+    writer.Init(mListArena.Get() + mListArenaLength, mListArena.AllocatedSize() - mListArenaLength);
     ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
-
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
+    ReturnErrorOnFailure(writer.Finalize());
 
-    mBufferedList.push_back(std::move(handle));
+    mListArenaLength += writer.GetLengthWritten();
+    mListArenaHighWaterMark = std::max(mListArenaHighWaterMark, mListArenaLength);
 
     return CHIP_NO_ERROR;
 }
@@ -142,7 +174,7 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
         TLV::TLVType outerContainer;
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-        mBufferedList.clear();
+        ResetListArena();
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -201,7 +233,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
+    TLV::TLVReader reader;
 
     ReturnErrorOnFailure(GenerateListTLV(reader));
 
@@ -219,9 +251,9 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
 
     //
-    // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
+    // Clear out our buffered contents, keeping the arena around for the next list, and reset the buffered path.
     //
-    mBufferedList.clear();
+    ResetListArena();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
@@ -19,11 +19,9 @@
 #pragma once
 
 #include "lib/core/CHIPTLV.h"
-#include "system/SystemPacketBuffer.h"
-#include "system/TLVPacketBufferBackingStore.h"
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
-#include <vector>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace app {
@@ -34,17 +32,37 @@ namespace app {
  * upon completion of delivery of all chunks. This is then delivered to a compliant ReadClient::Callback
  * without any awareness on their part that chunking happened.
  *
+ * List items are appended, already encoded as elements of the final TLV array, to a single growable
+ * arena. Delivering the list is then just a matter of closing the array and handing out a reader over
+ * the arena, without any further copy. The arena keeps its capacity across lists (and reports), so
+ * steady-state reassembly does not allocate.
+ *
  */
 class BufferedReadCallback : public ReadClient::Callback
 {
 public:
     BufferedReadCallback(Callback & callback) : mCallback(callback) {}
 
+    /*
+     * Number of bytes currently allocated for the list arena.
+     */
+    size_t GetListArenaCapacity() const { return mListArena.AllocatedSize(); }
+
+    /*
+     * Largest reassembled list, in bytes of encoded TLV, seen by this callback.
+     */
+    size_t GetListArenaHighWaterMark() const { return mListArenaHighWaterMark; }
+
+    /*
+     * Release the list arena. It will be re-allocated on demand when the next chunked list is received.
+     */
+    void ReleaseListArena();
+
 private:
     /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
+     * Closes the TLV array being reconstituted in the list arena and initializes aReader to read it.
      */
-    CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
+    CHIP_ERROR GenerateListTLV(TLV::TLVReader & aReader);
 
     /*
      * Dispatch any buffered list data if we need to. Buffered data will only be dispatched if:
@@ -71,7 +89,8 @@ private:
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
-        mBufferedList.clear();
+        // The interaction is over: the arena would only be reused by a later report of this callback.
+        ReleaseListArena();
         return mCallback.OnError(aError);
     }
 
@@ -108,15 +127,28 @@ private:
         return mCallback.GetHighestReceivedEventNumber(aEventNumber);
     }
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, append the list item where the reader is positioned
+     * to the list arena, growing it if needed.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
+
+    /*
+     * Make sure the list arena can hold aRequiredLength bytes, preserving its current contents.
+     */
+    CHIP_ERROR EnsureListArenaCapacity(size_t aRequiredLength);
+
+    /*
+     * Forget the buffered list items, keeping the arena allocation around for the next list.
+     */
+    void ResetListArena() { mListArenaLength = 0; }
+
     ConcreteDataAttributePath mBufferedPath;
-    std::vector<System::PacketBufferHandle> mBufferedList;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mListArena;
+    size_t mListArenaLength        = 0;
+    size_t mListArenaHighWaterMark = 0;
     Callback & mCallback;
 };
 
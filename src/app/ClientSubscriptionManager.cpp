@@ -0,0 +1,343 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClientSubscriptionManager.h>
+
+#include <app/ReadClient.h>
+#include <crypto/RandUtils.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock::Literals;
+
+namespace {
+
+constexpr System::Clock::Milliseconds32 kRateLimitWindow = 1000_ms32;
+
+System::Clock::Timeout TimeUntil(System::Clock::Timestamp deadline)
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    return deadline > now ? std::chrono::duration_cast<System::Clock::Timeout>(deadline - now) : System::Clock::kZero;
+}
+
+} // namespace
+
+void ClientSubscriptionManager::Shutdown()
+{
+    for (auto & peer : mPeers)
+    {
+        mSystemLayer.CancelTimer(OnPeerTimer, &peer.second);
+    }
+    mSystemLayer.CancelTimer(OnResubscribeTimer, this);
+
+    mClients.clear();
+    mPeers.clear();
+    mPendingResubscriptions.clear();
+    mResubscribeTimerArmed = false;
+    mPeersReleasedInWindow = 0;
+}
+
+size_t ClientSubscriptionManager::GetArmedTimerCount() const
+{
+    size_t count = mResubscribeTimerArmed ? 1 : 0;
+    for (const auto & peer : mPeers)
+    {
+        count += peer.second.mTimerArmed ? 1 : 0;
+    }
+    return count;
+}
+
+ClientSubscriptionManager::ClientState & ClientSubscriptionManager::Track(ReadClient & client, const ScopedNodeId & peer)
+{
+    auto result         = mClients.emplace(&client, ClientState());
+    ClientState & state = result.first->second;
+
+    if (!result.second && state.mPeer != peer)
+    {
+        // The subscription was re-established with another peer; move it to that peer.
+        auto oldPeer = mPeers.find(state.mPeer);
+        if (oldPeer != mPeers.end())
+        {
+            oldPeer->second.mClients.erase(&client);
+        }
+    }
+
+    PeerState & peerState = mPeers[peer];
+    peerState.mManager    = this;
+    peerState.mClients.insert(&client);
+
+    state.mPeer = peer;
+    return state;
+}
+
+void ClientSubscriptionManager::ForgetIfIdle(ReadClient & client)
+{
+    auto clientIter = mClients.find(&client);
+    VerifyOrReturn(clientIter != mClients.end());
+
+    const ClientState & state = clientIter->second;
+    VerifyOrReturn(!state.mLivenessTracked && !state.mResubscriptionPending && !state.mReleasing);
+
+    auto peerIter = mPeers.find(state.mPeer);
+    if (peerIter != mPeers.end())
+    {
+        peerIter->second.mClients.erase(&client);
+        if (peerIter->second.mClients.empty())
+        {
+            mSystemLayer.CancelTimer(OnPeerTimer, &peerIter->second);
+            mPeers.erase(peerIter);
+        }
+    }
+
+    mClients.erase(clientIter);
+}
+
+CHIP_ERROR ClientSubscriptionManager::TrackLiveness(ReadClient & client, const ScopedNodeId & peer,
+                                                    System::Clock::Timeout timeout)
+{
+    ClientState & state = Track(client, peer);
+
+    state.mLivenessTracked  = true;
+    state.mLivenessDeadline = System::SystemClock().GetMonotonicTimestamp() + timeout;
+
+    // Deadlines usually move later, in which case the timer armed at the earliest deadline of the peer is left alone
+    // and re-armed when it fires.
+    PeerState & peerState = mPeers[peer];
+    if (!peerState.mTimerArmed || state.mLivenessDeadline < peerState.mTimerDeadline)
+    {
+        return ArmPeerTimer(peerState, state.mLivenessDeadline);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ClientSubscriptionManager::StopLivenessTracking(ReadClient & client)
+{
+    auto clientIter = mClients.find(&client);
+    VerifyOrReturn(clientIter != mClients.end());
+
+    clientIter->second.mLivenessTracked = false;
+    ForgetIfIdle(client);
+}
+
+CHIP_ERROR ClientSubscriptionManager::ScheduleResubscription(ReadClient & client, const ScopedNodeId & peer,
+                                                             System::Clock::Milliseconds32 delay)
+{
+    ClientState & state = Track(client, peer);
+
+    state.mResubscriptionPending = true;
+    state.mResubscriptionTime    = System::SystemClock().GetMonotonicTimestamp() + delay;
+    mPendingResubscriptions.insert(&client);
+
+    if (!mResubscribeTimerArmed || state.mResubscriptionTime < mResubscribeTimerDeadline)
+    {
+        return ArmResubscribeTimer(state.mResubscriptionTime);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ClientSubscriptionManager::CancelResubscription(ReadClient & client)
+{
+    auto clientIter = mClients.find(&client);
+    VerifyOrReturn(clientIter != mClients.end());
+
+    clientIter->second.mResubscriptionPending = false;
+    clientIter->second.mReleasing             = false;
+    mPendingResubscriptions.erase(&client);
+    ForgetIfIdle(client);
+}
+
+CHIP_ERROR ClientSubscriptionManager::ArmPeerTimer(PeerState & peerState, System::Clock::Timestamp deadline)
+{
+    peerState.mTimerArmed    = true;
+    peerState.mTimerDeadline = deadline;
+    return mSystemLayer.StartTimer(TimeUntil(deadline), OnPeerTimer, &peerState);
+}
+
+CHIP_ERROR ClientSubscriptionManager::ArmResubscribeTimer(System::Clock::Timestamp deadline)
+{
+    mResubscribeTimerArmed    = true;
+    mResubscribeTimerDeadline = deadline;
+    return mSystemLayer.StartTimer(TimeUntil(deadline), OnResubscribeTimer, this);
+}
+
+void ClientSubscriptionManager::OnPeerTimer(System::Layer * apSystemLayer, void * apAppState)
+{
+    // The timer is cancelled when its peer state goes away.
+    PeerState * peerState = static_cast<PeerState *>(apAppState);
+    peerState->mManager->HandlePeerTimer(*peerState);
+}
+
+void ClientSubscriptionManager::HandlePeerTimer(PeerState & peerState)
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    std::vector<ReadClient *> expired;
+    Optional<System::Clock::Timestamp> nextDeadline;
+
+    peerState.mTimerArmed = false;
+
+    for (ReadClient * client : peerState.mClients)
+    {
+        const ClientState & state = mClients[client];
+        if (!state.mLivenessTracked)
+        {
+            continue;
+        }
+
+        if (state.mLivenessDeadline <= now)
+        {
+            expired.push_back(client);
+        }
+        else if (!nextDeadline.HasValue() || state.mLivenessDeadline < nextDeadline.Value())
+        {
+            nextDeadline.SetValue(state.mLivenessDeadline);
+        }
+    }
+
+    if (nextDeadline.HasValue())
+    {
+        CHIP_ERROR err = ArmPeerTimer(peerState, nextDeadline.Value());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to arm subscription liveness timer: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
+    // Timing out a subscription may destroy it, or others: only time out those still tracked and expired.
+    for (ReadClient * client : expired)
+    {
+        auto clientIter = mClients.find(client);
+        if (clientIter == mClients.end() || !clientIter->second.mLivenessTracked || clientIter->second.mLivenessDeadline > now)
+        {
+            continue;
+        }
+
+        clientIter->second.mLivenessTracked = false;
+        ForgetIfIdle(*client);
+        ReadClient::OnLivenessTimeoutCallback(&mSystemLayer, client);
+    }
+}
+
+void ClientSubscriptionManager::OnResubscribeTimer(System::Layer * apSystemLayer, void * apAppState)
+{
+    static_cast<ClientSubscriptionManager *>(apAppState)->HandleResubscribeTimer();
+}
+
+void ClientSubscriptionManager::HandleResubscribeTimer()
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    std::vector<std::pair<System::Clock::Timestamp, ReadClient *>> due;
+    std::vector<ReadClient *> released;
+    std::set<ScopedNodeId, PeerCompare> releasedPeers;
+    bool rateLimited = false;
+
+    mResubscribeTimerArmed = false;
+
+    if (now >= mWindowStart + kRateLimitWindow)
+    {
+        mWindowStart           = now;
+        mPeersReleasedInWindow = 0;
+    }
+
+    for (ReadClient * client : mPendingResubscriptions)
+    {
+        const ClientState & state = mClients[client];
+        if (state.mResubscriptionTime <= now)
+        {
+            due.emplace_back(state.mResubscriptionTime, client);
+        }
+    }
+    std::sort(due.begin(), due.end());
+
+    for (const auto & entry : due)
+    {
+        const ScopedNodeId & peer = mClients[entry.second].mPeer;
+        if (releasedPeers.find(peer) != releasedPeers.end())
+        {
+            continue;
+        }
+
+        if (mPeersReleasedInWindow >= mMaxPeersPerSecond)
+        {
+            rateLimited = true;
+            break;
+        }
+
+        // Release every subscription to that peer waiting to re-subscribe, due or not: they will all share one session.
+        mPeersReleasedInWindow++;
+        releasedPeers.insert(peer);
+        for (ReadClient * client : mPeers[peer].mClients)
+        {
+            ClientState & state = mClients[client];
+            if (state.mResubscriptionPending)
+            {
+                state.mResubscriptionPending = false;
+                state.mReleasing             = true;
+                mPendingResubscriptions.erase(client);
+                released.push_back(client);
+            }
+        }
+    }
+
+    // Re-arm before releasing anything, since released subscriptions may immediately be scheduled again.
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (rateLimited)
+    {
+        uint32_t jitterMs = mMaxJitter.count() > 0 ? Crypto::GetRandU32() % (mMaxJitter.count() + 1) : 0;
+        ChipLogProgress(DataManagement, "Deferring %u re-subscriptions to stay under %" PRIu32 " peers per second",
+                        static_cast<unsigned>(mPendingResubscriptions.size()), mMaxPeersPerSecond);
+        err = ArmResubscribeTimer(mWindowStart + kRateLimitWindow + System::Clock::Milliseconds32(jitterMs));
+    }
+    else if (!mPendingResubscriptions.empty())
+    {
+        System::Clock::Timestamp nextTime = mClients[*mPendingResubscriptions.begin()].mResubscriptionTime;
+        for (ReadClient * client : mPendingResubscriptions)
+        {
+            nextTime = std::min(nextTime, mClients[client].mResubscriptionTime);
+        }
+        err = ArmResubscribeTimer(nextTime);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to arm re-subscription timer: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    for (ReadClient * client : released)
+    {
+        auto clientIter = mClients.find(client);
+        if (clientIter == mClients.end() || !clientIter->second.mReleasing)
+        {
+            // Destroyed, or stopped re-subscribing, while releasing the previous ones.
+            continue;
+        }
+
+        clientIter->second.mReleasing = false;
+        ForgetIfIdle(*client);
+        ReadClient::OnResubscribeTimerCallback(&mSystemLayer, client);
+    }
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <map>
+#include <set>
+
+namespace chip {
+namespace app {
+
+class ReadClient;
+
+/**
+ * @brief
+ *   Controller-side scheduler for the timers of many subscriptions (ReadClient objects), meant for controllers
+ *   maintaining thousands of them.
+ *
+ *   Liveness: instead of each ReadClient re-arming its own liveness timer on every report, the manager records the
+ *   liveness deadline of each subscription and keeps a single timer per peer, armed at the earliest deadline of the
+ *   subscriptions to that peer. A report only updates a timestamp; the timer is re-armed when it fires, or when a
+ *   deadline moves earlier than the one it is armed at. Each subscription still times out on its own deadline, since
+ *   a publisher may drop one subscription while keeping the others alive.
+ *
+ *   Re-subscription: subscriptions scheduled to re-subscribe are released by a single timer, at most
+ *   maxPeersPerSecond peers per second, with a random delay of up to maxJitter added whenever releases are deferred
+ *   by that limit. When a subscription to a peer is released, every other subscription to that peer waiting to
+ *   re-subscribe is released along with it, so that they share the CASE session established for the first one. This
+ *   spreads out the re-subscription storm that follows a network outage.
+ *
+ *   Register the manager with InteractionModelEngine::SetClientSubscriptionManager before establishing any
+ *   subscription, and unregister it only once all of them are gone.
+ */
+class ClientSubscriptionManager
+{
+public:
+    static constexpr uint32_t kDefaultMaxPeersPerSecond              = 10;
+    static constexpr System::Clock::Milliseconds32 kDefaultMaxJitter = System::Clock::Milliseconds32(1000);
+
+    ClientSubscriptionManager(System::Layer & systemLayer, uint32_t maxPeersPerSecond = kDefaultMaxPeersPerSecond,
+                              System::Clock::Milliseconds32 maxJitter = kDefaultMaxJitter) :
+        mSystemLayer(systemLayer),
+        mMaxPeersPerSecond(maxPeersPerSecond > 0 ? maxPeersPerSecond : 1), mMaxJitter(maxJitter)
+    {}
+    ~ClientSubscriptionManager() { Shutdown(); }
+
+    /**
+     * Cancel every timer and forget every subscription.
+     */
+    void Shutdown();
+
+    /**
+     * Number of timers currently armed, for diagnostics.
+     */
+    size_t GetArmedTimerCount() const;
+
+    /**
+     * Number of subscriptions waiting to re-subscribe.
+     */
+    size_t GetPendingResubscriptionCount() const { return mPendingResubscriptions.size(); }
+
+private:
+    friend class TestReadInteraction;
+    friend class ReadClient;
+
+    struct PeerCompare
+    {
+        bool operator()(const ScopedNodeId & a, const ScopedNodeId & b) const
+        {
+            return a.GetFabricIndex() < b.GetFabricIndex() ||
+                (a.GetFabricIndex() == b.GetFabricIndex() && a.GetNodeId() < b.GetNodeId());
+        }
+    };
+
+    struct PeerState
+    {
+        ClientSubscriptionManager * mManager = nullptr;
+        std::set<ReadClient *> mClients;
+        System::Clock::Timestamp mTimerDeadline = System::Clock::kZero;
+        bool mTimerArmed                        = false;
+    };
+
+    struct ClientState
+    {
+        ScopedNodeId mPeer;
+        bool mLivenessTracked                        = false;
+        System::Clock::Timestamp mLivenessDeadline   = System::Clock::kZero;
+        bool mResubscriptionPending                  = false;
+        System::Clock::Timestamp mResubscriptionTime = System::Clock::kZero;
+        // Released for re-subscription, but not yet told so.
+        bool mReleasing = false;
+    };
+
+    // Called by ReadClient in place of arming and cancelling its own timers.
+    CHIP_ERROR TrackLiveness(ReadClient & client, const ScopedNodeId & peer, System::Clock::Timeout timeout);
+    void StopLivenessTracking(ReadClient & client);
+    CHIP_ERROR ScheduleResubscription(ReadClient & client, const ScopedNodeId & peer, System::Clock::Milliseconds32 delay);
+    void CancelResubscription(ReadClient & client);
+
+    ClientState & Track(ReadClient & client, const ScopedNodeId & peer);
+    void ForgetIfIdle(ReadClient & client);
+    CHIP_ERROR ArmPeerTimer(PeerState & peerState, System::Clock::Timestamp deadline);
+    CHIP_ERROR ArmResubscribeTimer(System::Clock::Timestamp deadline);
+
+    static void OnPeerTimer(System::Layer * apSystemLayer, void * apAppState);
+    static void OnResubscribeTimer(System::Layer * apSystemLayer, void * apAppState);
+    void HandlePeerTimer(PeerState & peerState);
+    void HandleResubscribeTimer();
+
+    System::Layer & mSystemLayer;
+    const uint32_t mMaxPeersPerSecond;
+    const System::Clock::Milliseconds32 mMaxJitter;
+
+    std::map<ReadClient *, ClientState> mClients;
+    std::map<ScopedNodeId, PeerState, PeerCompare> mPeers;
+    std::set<ReadClient *> mPendingResubscriptions;
+
+    bool mResubscribeTimerArmed                        = false;
+    System::Clock::Timestamp mResubscribeTimerDeadline = System::Clock::kZero;
+    // Rate limiting of re-subscriptions: number of peers released since mWindowStart.
+    System::Clock::Timestamp mWindowStart = System::Clock::kZero;
+    uint32_t mPeersReleasedInWindow       = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -66,7 +66,7 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
         ReturnErrorOnFailure(writer.Finalize(backingBuffer));
 
-        state.Set<Platform::ScopedMemoryBufferWithSize<uint8_t>>(std::move(backingBuffer));
+        state.Set<AttributeData>(std::move(backingBuffer));
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
@@ -220,8 +220,7 @@ CHIP_ERROR ClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVRe
         return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
     }
 
-    reader.Init(attributeState->Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().Get(),
-                attributeState->Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().AllocatedSize());
+    reader.Init(attributeState->Get<AttributeData>().mTlv.Get(), attributeState->Get<AttributeData>().mTlv.AllocatedSize());
     return reader.Next();
 }
 
@@ -423,8 +422,8 @@ void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter
                 else
                 {
                     TLV::TLVReader bufReader;
-                    bufReader.Init(attributeIter.second.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().Get(),
-                                   attributeIter.second.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().AllocatedSize());
+                    bufReader.Init(attributeIter.second.Get<AttributeData>().mTlv.Get(),
+                                   attributeIter.second.Get<AttributeData>().mTlv.AllocatedSize());
                     ReturnOnFailure(bufReader.Next());
                     // Skip to the end of the element.
                     ReturnOnFailure(bufReader.Skip());
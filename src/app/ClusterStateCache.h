@@ -26,15 +26,103 @@
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
+#include <lib/support/BitMask.h>
 #include <lib/support/Variant.h>
 #include <list>
 #include <map>
 #include <queue>
 #include <set>
+#include <string.h>
+#include <type_traits>
 #include <vector>
 
 namespace chip {
 namespace app {
+
+namespace detail {
+
+/*
+ * Decoded value of a scalar attribute, kept by ClusterStateCache next to the TLV it was decoded from.
+ */
+struct DecodedScalarValue
+{
+    uint64_t mBits = 0;
+    bool mIsNull   = false;
+    // Identifies the type the value was decoded into, so that it is only handed back to readers of that same type.
+    const void * mType = nullptr;
+};
+
+/*
+ * Describes how a decodable attribute type is stored in a DecodedScalarValue. Only types that fit in 64 bits and
+ * do not point into the TLV (integers, floats, booleans, enums, bitmaps and nullable versions of these) are scalars.
+ */
+template <typename T, typename Enable = void>
+struct ScalarAttributeValue : std::false_type
+{
+};
+
+template <typename T>
+using IsPlainScalar =
+    std::integral_constant<bool, (std::is_arithmetic<T>::value || std::is_enum<T>::value) && sizeof(T) <= sizeof(uint64_t)>;
+
+template <typename T>
+struct ScalarAttributeValue<T, std::enable_if_t<IsPlainScalar<T>::value>> : std::true_type
+{
+    static void Save(const T & value, DecodedScalarValue & decoded)
+    {
+        decoded.mBits = 0;
+        memcpy(&decoded.mBits, &value, sizeof(value));
+        decoded.mIsNull = false;
+    }
+    static void Load(const DecodedScalarValue & decoded, T & value) { memcpy(&value, &decoded.mBits, sizeof(value)); }
+};
+
+template <typename FlagsEnum, typename StorageType>
+struct ScalarAttributeValue<BitMask<FlagsEnum, StorageType>> : std::true_type
+{
+    static void Save(const BitMask<FlagsEnum, StorageType> & value, DecodedScalarValue & decoded)
+    {
+        decoded.mBits   = value.Raw();
+        decoded.mIsNull = false;
+    }
+    static void Load(const DecodedScalarValue & decoded, BitMask<FlagsEnum, StorageType> & value)
+    {
+        value.SetRaw(static_cast<typename BitMask<FlagsEnum, StorageType>::IntegerType>(decoded.mBits));
+    }
+};
+
+template <typename T>
+struct ScalarAttributeValue<DataModel::Nullable<T>, std::enable_if_t<ScalarAttributeValue<T>::value>> : std::true_type
+{
+    static void Save(const DataModel::Nullable<T> & value, DecodedScalarValue & decoded)
+    {
+        if (value.IsNull())
+        {
+            decoded.mBits   = 0;
+            decoded.mIsNull = true;
+            return;
+        }
+        ScalarAttributeValue<T>::Save(value.Value(), decoded);
+    }
+    static void Load(const DecodedScalarValue & decoded, DataModel::Nullable<T> & value)
+    {
+        if (decoded.mIsNull)
+        {
+            value.SetNull();
+            return;
+        }
+        ScalarAttributeValue<T>::Load(decoded, value.SetNonNull());
+    }
+};
+
+template <typename T>
+const void * ScalarTypeTag()
+{
+    static const char tag = 0;
+    return &tag;
+}
+
+} // namespace detail
 /*
  * This implements a cluster state cache designed to aggregate both attribute and event data received by a client
  * from either read or subscribe interactions and keep it resident and available for clients to
@@ -131,17 +219,25 @@ public:
     template <typename AttributeObjectTypeT>
     CHIP_ERROR Get(const ConcreteAttributePath & path, typename AttributeObjectTypeT::DecodableType & value) const
     {
-        TLV::TLVReader reader;
+        using ValueType = typename AttributeObjectTypeT::DecodableType;
 
         if (path.mClusterId != AttributeObjectTypeT::GetClusterId() || path.mAttributeId != AttributeObjectTypeT::GetAttributeId())
         {
             return CHIP_ERROR_SCHEMA_MISMATCH;
         }
 
-        ReturnErrorOnFailure(Get(path, reader));
-        return DataModel::Decode(reader, value);
+        return GetDecodedValue(path, value, detail::ScalarAttributeValue<ValueType>());
     }
 
+    /*
+     * When enabled, the typed Get() above remembers the decoded value of scalar attributes (integers, floats, booleans,
+     * enums, bitmaps and nullable versions of these) next to their TLV, so that reading them again is a copy instead of
+     * a TLV decode. The decoded value is dropped as soon as new data or status is received for the attribute.
+     *
+     * This is meant for consumers that poll the cache for many attributes, e.g. dashboards. It is disabled by default.
+     */
+    void SetScalarValueCachingEnabled(bool enabled) { mScalarValueCachingEnabled = enabled; }
+
     /*
      * Retrieve the StatusIB for a given attribute if one exists currently in the cache.
      *
@@ -484,7 +580,16 @@ public:
     }
 
 private:
-    using AttributeState = Variant<Platform::ScopedMemoryBufferWithSize<uint8_t>, StatusIB>;
+    struct AttributeData
+    {
+        explicit AttributeData(Platform::ScopedMemoryBufferWithSize<uint8_t> && tlv) : mTlv(std::move(tlv)) {}
+
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mTlv;
+        // Filled in by the typed Get() on first read when scalar value caching is enabled.
+        mutable detail::DecodedScalarValue mDecodedValue;
+    };
+
+    using AttributeState = Variant<AttributeData, StatusIB>;
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
@@ -540,6 +645,46 @@ private:
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
+    template <typename ValueType>
+    CHIP_ERROR GetDecodedValue(const ConcreteAttributePath & path, ValueType & value, std::false_type) const
+    {
+        TLV::TLVReader reader;
+        ReturnErrorOnFailure(Get(path, reader));
+        return DataModel::Decode(reader, value);
+    }
+
+    template <typename ValueType>
+    CHIP_ERROR GetDecodedValue(const ConcreteAttributePath & path, ValueType & value, std::true_type) const
+    {
+        using Traits = detail::ScalarAttributeValue<ValueType>;
+
+        if (!mScalarValueCachingEnabled)
+        {
+            return GetDecodedValue(path, value, std::false_type());
+        }
+
+        CHIP_ERROR err;
+        auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+        ReturnErrorOnFailure(err);
+        VerifyOrReturnError(!attributeState->Is<StatusIB>(), CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+
+        const AttributeData & data = attributeState->Get<AttributeData>();
+        if (data.mDecodedValue.mType == detail::ScalarTypeTag<ValueType>())
+        {
+            Traits::Load(data.mDecodedValue, value);
+            return CHIP_NO_ERROR;
+        }
+
+        TLV::TLVReader reader;
+        reader.Init(data.mTlv.Get(), data.mTlv.AllocatedSize());
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(DataModel::Decode(reader, value));
+
+        Traits::Save(value, data.mDecodedValue);
+        data.mDecodedValue.mType = detail::ScalarTypeTag<ValueType>();
+        return CHIP_NO_ERROR;
+    }
+
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
      * with the provided status.
@@ -611,6 +756,7 @@ private:
     std::map<ConcreteEventPath, StatusIB> mEventStatusCache;
     BufferedReadCallback mBufferedReader;
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+    bool mScalarValueCachingEnabled         = false;
 };
 
 }; // namespace app
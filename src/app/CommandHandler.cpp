@@ -37,6 +37,8 @@
 #include <lib/support/TypeTraits.h>
 #include <platform/LockTracker.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemMetrics.h>
+#include <trace/trace.h>
 
 namespace chip {
 namespace app {
@@ -70,6 +72,7 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
 void CommandHandler::OnInvokeCommandRequest(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                             System::PacketBufferHandle && payload, bool isTimedInvoke)
 {
+    MATTER_TRACE_EVENT_SCOPE("OnInvokeCommandRequest", "CommandHandler");
     System::PacketBufferHandle response;
     Status status = Status::Failure;
     VerifyOrDieWithMsg(ec != nullptr, DataManagement, "Incoming exchange context should not be null");
@@ -97,6 +100,7 @@ void CommandHandler::OnInvokeCommandRequest(Messaging::ExchangeContext * ec, con
 
 Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payload, bool isTimedInvoke)
 {
+    MATTER_TRACE_EVENT_SCOPE("ProcessInvokeRequest", "CommandHandler");
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader reader;
     TLV::TLVReader invokeRequestsReader;
@@ -213,6 +217,7 @@ void CommandHandler::DecrementHoldOff()
 
 CHIP_ERROR CommandHandler::SendCommandResponse()
 {
+    MATTER_TRACE_EVENT_SCOPE("SendCommandResponse", "CommandHandler");
     System::PacketBufferHandle commandPacket;
 
     VerifyOrReturnError(mPendingWork == 0, CHIP_ERROR_INCORRECT_STATE);
@@ -244,6 +249,7 @@ constexpr uint8_t sNoFields[] = {
 
 Status CommandHandler::ProcessCommandDataIB(CommandDataIB::Parser & aCommandElement)
 {
+    MATTER_TRACE_EVENT_SCOPE("ProcessCommandDataIB", "CommandHandler");
     CHIP_ERROR err = CHIP_NO_ERROR;
     CommandPathIB::Parser commandPath;
     ConcreteCommandPath concretePath(0, 0, 0);
@@ -325,6 +331,7 @@ Status CommandHandler::ProcessCommandDataIB(CommandDataIB::Parser & aCommandElem
         ChipLogDetail(DataManagement, "Received command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
                       concretePath.mEndpointId, ChipLogValueMEI(concretePath.mClusterId), ChipLogValueMEI(concretePath.mCommandId));
         SuccessOrExit(MatterPreCommandReceivedCallback(concretePath, GetSubjectDescriptor()));
+        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_CommandsInvoked);
         mpCallback->DispatchCommand(*this, concretePath, commandDataReader);
         MatterPostCommandReceivedCallback(concretePath, GetSubjectDescriptor());
     }
@@ -342,6 +349,7 @@ exit:
 
 Status CommandHandler::ProcessGroupCommandDataIB(CommandDataIB::Parser & aCommandElement)
 {
+    MATTER_TRACE_EVENT_SCOPE("ProcessGroupCommandDataIB", "CommandHandler");
     CHIP_ERROR err = CHIP_NO_ERROR;
     CommandPathIB::Parser commandPath;
     TLV::TLVReader commandDataReader;
@@ -396,16 +404,11 @@ Status CommandHandler::ProcessGroupCommandDataIB(CommandDataIB::Parser & aComman
     // always have an accessing fabric, by definition.
 
     // Find which endpoints can process the command, and dispatch to them.
-    iterator = groupDataProvider->IterateEndpoints(fabric);
+    iterator = groupDataProvider->IterateEndpoints(fabric, groupId);
     VerifyOrReturnError(iterator != nullptr, Status::Failure);
 
     while (iterator->Next(mapping))
     {
-        if (groupId != mapping.group_id)
-        {
-            continue;
-        }
-
         ChipLogDetail(DataManagement,
                       "Processing group command for Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
                       mapping.endpoint_id, ChipLogValueMEI(clusterId), ChipLogValueMEI(commandId));
@@ -436,6 +439,7 @@ Status CommandHandler::ProcessGroupCommandDataIB(CommandDataIB::Parser & aComman
         if ((err = MatterPreCommandReceivedCallback(concretePath, GetSubjectDescriptor())) == CHIP_NO_ERROR)
         {
             TLV::TLVReader dataReader(commandDataReader);
+            SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_CommandsInvoked);
             mpCallback->DispatchCommand(*this, concretePath, dataReader);
             MatterPostCommandReceivedCallback(concretePath, GetSubjectDescriptor());
         }
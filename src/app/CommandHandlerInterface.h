@@ -157,6 +157,16 @@ public:
     void SetNext(CommandHandlerInterface * aNext) { mNext = aNext; }
     CommandHandlerInterface * GetNext() const { return mNext; }
 
+    /**
+     * Mechanism for keeping track of the CommandHandlerInterfaces sharing a bucket of an
+     * InterfaceDispatchTable.
+     */
+    void SetNextInBucket(CommandHandlerInterface * aNext) { mNextInBucket = aNext; }
+    CommandHandlerInterface * GetNextInBucket() const { return mNextInBucket; }
+
+    const Optional<EndpointId> & GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Check whether a this CommandHandlerInterface is relevant for a
      * particular endpoint+cluster.  An CommandHandlerInterface will be used
@@ -227,7 +237,8 @@ protected:
 private:
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
-    CommandHandlerInterface * mNext = nullptr;
+    CommandHandlerInterface * mNext         = nullptr;
+    CommandHandlerInterface * mNextInBucket = nullptr;
 };
 
 } // namespace app
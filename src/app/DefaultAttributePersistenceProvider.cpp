@@ -15,9 +15,16 @@
  */
 
 #include <app/DefaultAttributePersistenceProvider.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <cinttypes>
 
 namespace chip {
 namespace app {
@@ -27,20 +34,254 @@ CHIP_ERROR DefaultAttributePersistenceProvider::WriteValue(const ConcreteAttribu
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    // TODO: we may want to have a small cache for values that change a lot, so
-    // we only write them once a bunch of changes happen or on timer or
-    // shutdown.
+    // Values that change a lot can be coalesced by wrapping this provider in a
+    // DeferredAttributePersistenceProvider.
     DefaultStorageKeyAllocator key;
     if (!CanCastTo<uint16_t>(aValue.size()))
     {
         return CHIP_ERROR_BUFFER_TOO_SMALL;
     }
+    // List the value before storing it, so that the index never misses a stored value.
+    ReturnErrorOnFailure(AddToIndex(aPath));
     return mStorage->SyncSetKeyValue(key.AttributeValue(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId), aValue.data(),
                                      static_cast<uint16_t>(aValue.size()));
 }
 
 CHIP_ERROR DefaultAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
                                                           const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    if (mBulkReadEndpointIndex == nullptr || aPath.mEndpointId != mBulkReadEndpointIndex->mEndpointId)
+    {
+        return ReadStoredValue(aPath, aMetadata, aValue);
+    }
+
+    if (!mBulkReadBuildingIndex)
+    {
+        // A write may have dropped the index since the bulk read started.
+        VerifyOrReturnError(!mBulkReadEndpointIndex->mStored ||
+                                mBulkReadEndpointIndex->mIndex.Contains(aPath.mClusterId, aPath.mAttributeId),
+                            CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return ReadStoredValue(aPath, aMetadata, aValue);
+    }
+
+    CHIP_ERROR err = ReadStoredValue(aPath, aMetadata, aValue);
+    if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND && !mBulkReadIndex.Add(aPath.mClusterId, aPath.mAttributeId))
+    {
+        mBulkReadIndexFull = true;
+    }
+    return err;
+}
+
+void DefaultAttributePersistenceProvider::StartBulkRead(EndpointId aEndpointId)
+{
+    EndBulkRead();
+    VerifyOrReturn(mStorage != nullptr);
+    VerifyOrReturn(GetEndpointIndex(aEndpointId, mBulkReadEndpointIndex) == CHIP_NO_ERROR);
+
+    mBulkReadBuildingIndex = !mBulkReadEndpointIndex->mStored;
+    mBulkReadIndexFull     = false;
+    mBulkReadStartTime     = System::SystemClock().GetMonotonicMicroseconds64();
+    if (mBulkReadBuildingIndex)
+    {
+        ChipLogDetail(Zcl, "No index of the attribute values of endpoint %u: looking all of them up", aEndpointId);
+    }
+}
+
+void DefaultAttributePersistenceProvider::EndBulkRead()
+{
+    VerifyOrReturn(mBulkReadEndpointIndex != nullptr);
+
+    const char * indexUse =
+        !mBulkReadBuildingIndex ? "index loaded" : (mBulkReadIndexFull ? "too many values to index" : "index built");
+    // Too many values for an index: leave the endpoint without one, there is nothing to gain from reading it.
+    if (mBulkReadBuildingIndex && !mBulkReadIndexFull)
+    {
+        CHIP_ERROR err = StoreIndex(mBulkReadEndpointIndex->mEndpointId, mBulkReadIndex);
+        if (err == CHIP_NO_ERROR)
+        {
+            mBulkReadEndpointIndex->mIndex.Clear();
+            mBulkReadEndpointIndex->mIndex  = std::move(mBulkReadIndex);
+            mBulkReadEndpointIndex->mStored = true;
+        }
+        else
+        {
+            ChipLogError(Zcl, "Failed to store the index of the attribute values of endpoint %u: %" CHIP_ERROR_FORMAT,
+                         mBulkReadEndpointIndex->mEndpointId, err.Format());
+        }
+    }
+
+    // The bulk read spans the whole load of the endpoint, defaults included, so this is its share of the startup time.
+    const System::Clock::Microseconds64 duration = System::SystemClock().GetMonotonicMicroseconds64() - mBulkReadStartTime;
+    ChipLogProgress(Zcl, "Loaded the attributes of endpoint %u in %" PRIu32 " us (%s)", mBulkReadEndpointIndex->mEndpointId,
+                    static_cast<uint32_t>(std::min<uint64_t>(duration.count(), UINT32_MAX)), indexUse);
+
+    mBulkReadEndpointIndex = nullptr;
+    mBulkReadBuildingIndex = false;
+    mBulkReadIndex.Clear();
+}
+
+void DefaultAttributePersistenceProvider::Shutdown()
+{
+    EndBulkRead();
+    while (mEndpointIndexes != nullptr)
+    {
+        EndpointIndex * endpointIndex = mEndpointIndexes;
+        mEndpointIndexes              = endpointIndex->mNext;
+        Platform::Delete(endpointIndex);
+    }
+}
+
+bool DefaultAttributePersistenceProvider::Index::Contains(ClusterId aClusterId, AttributeId aAttributeId) const
+{
+    for (size_t offset = 0; offset + kIndexEntrySize <= mSize; offset += kIndexEntrySize)
+    {
+        const uint8_t * entry = mEntries.Get() + offset;
+        if (Encoding::LittleEndian::Get32(entry) == aClusterId &&
+            Encoding::LittleEndian::Get32(entry + sizeof(ClusterId)) == aAttributeId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DefaultAttributePersistenceProvider::Index::Add(ClusterId aClusterId, AttributeId aAttributeId)
+{
+    if (Contains(aClusterId, aAttributeId))
+    {
+        return true;
+    }
+    VerifyOrReturnValue(mSize + kIndexEntrySize <= kMaxIndexSize, false);
+
+    if (mSize + kIndexEntrySize > mCapacity)
+    {
+        // Values are rarely stored for the first time: grow by one entry.
+        Platform::ScopedMemoryBuffer<uint8_t> entries;
+        VerifyOrReturnValue(entries.Alloc(mSize + kIndexEntrySize).Get() != nullptr, false);
+        if (mSize > 0)
+        {
+            memcpy(entries.Get(), mEntries.Get(), mSize);
+        }
+        // Moving a buffer does not free the one it replaces.
+        mEntries.Free();
+        mEntries  = std::move(entries);
+        mCapacity = mSize + kIndexEntrySize;
+    }
+
+    Encoding::LittleEndian::BufferWriter writer(mEntries.Get() + mSize, kIndexEntrySize);
+    writer.Put32(aClusterId).Put32(aAttributeId);
+    mSize += kIndexEntrySize;
+    return true;
+}
+
+void DefaultAttributePersistenceProvider::Index::Clear()
+{
+    mEntries.Free();
+    mSize = mCapacity = 0;
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::GetEndpointIndex(EndpointId aEndpointId, EndpointIndex *& aEndpointIndex)
+{
+    for (aEndpointIndex = mEndpointIndexes; aEndpointIndex != nullptr; aEndpointIndex = aEndpointIndex->mNext)
+    {
+        VerifyOrReturnError(aEndpointIndex->mEndpointId != aEndpointId, CHIP_NO_ERROR);
+    }
+
+    EndpointIndex * endpointIndex = Platform::New<EndpointIndex>();
+    VerifyOrReturnError(endpointIndex != nullptr, CHIP_ERROR_NO_MEMORY);
+    endpointIndex->mEndpointId = aEndpointId;
+
+    CHIP_ERROR err         = LoadIndex(aEndpointId, endpointIndex->mIndex);
+    endpointIndex->mStored = (err == CHIP_NO_ERROR);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        // An index that cannot be read cannot be kept up to date: drop it, so that every value of the endpoint is looked up.
+        err = DeleteIndex(*endpointIndex);
+        if (err != CHIP_NO_ERROR)
+        {
+            Platform::Delete(endpointIndex);
+            return err;
+        }
+    }
+
+    endpointIndex->mNext = mEndpointIndexes;
+    mEndpointIndexes     = endpointIndex;
+    aEndpointIndex       = endpointIndex;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::LoadIndex(EndpointId aEndpointId, Index & aIndex)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> entries;
+    VerifyOrReturnError(entries.Alloc(kMaxIndexSize).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    DefaultStorageKeyAllocator key;
+    uint16_t size = static_cast<uint16_t>(kMaxIndexSize);
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.AttributeValueIndex(aEndpointId), entries.Get(), size));
+    VerifyOrReturnError(size % kIndexEntrySize == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    // Kept in a buffer of its size, as long as the endpoint is.
+    aIndex.Clear();
+    if (size > 0)
+    {
+        VerifyOrReturnError(aIndex.mEntries.Alloc(size).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        memcpy(aIndex.mEntries.Get(), entries.Get(), size);
+    }
+    aIndex.mSize = aIndex.mCapacity = size;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::StoreIndex(EndpointId aEndpointId, const Index & aIndex)
+{
+    DefaultStorageKeyAllocator key;
+    return mStorage->SyncSetKeyValue(key.AttributeValueIndex(aEndpointId), aIndex.mEntries.Get(),
+                                     static_cast<uint16_t>(aIndex.mSize));
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::DeleteIndex(EndpointIndex & aEndpointIndex)
+{
+    DefaultStorageKeyAllocator key;
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(key.AttributeValueIndex(aEndpointIndex.mEndpointId));
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, err);
+
+    aEndpointIndex.mStored = false;
+    aEndpointIndex.mIndex.Clear();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::AddToIndex(const ConcreteAttributePath & aPath)
+{
+    if (mBulkReadEndpointIndex != nullptr && aPath.mEndpointId == mBulkReadEndpointIndex->mEndpointId && mBulkReadBuildingIndex)
+    {
+        // The index being built is stored at the end of the bulk read.
+        mBulkReadIndexFull = !mBulkReadIndex.Add(aPath.mClusterId, aPath.mAttributeId) || mBulkReadIndexFull;
+        return CHIP_NO_ERROR;
+    }
+
+    EndpointIndex * endpointIndex;
+    ReturnErrorOnFailure(GetEndpointIndex(aPath.mEndpointId, endpointIndex));
+
+    // Without an index, there is none to keep up to date: the next bulk read of the endpoint builds it.
+    Index & index = endpointIndex->mIndex;
+    VerifyOrReturnError(endpointIndex->mStored && !index.Contains(aPath.mClusterId, aPath.mAttributeId), CHIP_NO_ERROR);
+
+    if (index.Add(aPath.mClusterId, aPath.mAttributeId))
+    {
+        if (StoreIndex(aPath.mEndpointId, index) == CHIP_NO_ERROR)
+        {
+            return CHIP_NO_ERROR;
+        }
+        // Keep mirroring the stored index.
+        index.mSize -= kIndexEntrySize;
+    }
+
+    // The index cannot list the value: drop it, so that every value of the endpoint is looked up.
+    return DeleteIndex(*endpointIndex);
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::ReadStoredValue(const ConcreteAttributePath & aPath,
+                                                                const EmberAfAttributeMetadata * aMetadata,
+                                                                MutableByteSpan & aValue)
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
@@ -16,8 +16,11 @@
 #pragma once
 
 #include <app/AttributePersistenceProvider.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace app {
@@ -29,6 +32,17 @@ namespace app {
  * NOTE: SetAttributePersistenceProvider must still be called with an instance
  * of this class, since it can't be constructed automatically without knowing
  * what PersistentStorageDelegate is to be used.
+ *
+ * PersistentStorageDelegate cannot list its keys, so each endpoint also has an
+ * index of the attributes it stored a value for.  A bulk read of an endpoint
+ * reads its index first, and only looks up the values the index lists: most
+ * non-volatile attributes are never written, and cost nothing on startup.  An
+ * endpoint without an index (e.g. values stored by an older version, or too
+ * many of them) has every value looked up, and its index built from the values
+ * found.
+ *
+ * The index of an endpoint is kept in memory once looked up, so that only
+ * writing a value for the first time touches it in storage.
  */
 class DefaultAttributePersistenceProvider : public AttributePersistenceProvider
 {
@@ -46,16 +60,67 @@ public:
         return CHIP_NO_ERROR;
     }
 
-    void Shutdown() {}
+    // Frees the indexes kept in memory.
+    void Shutdown();
 
     // AttributePersistenceProvider implementation.
     CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
                           const ByteSpan & aValue) override;
     CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
                          MutableByteSpan & aValue) override;
+    void StartBulkRead(EndpointId aEndpointId) override;
+    void EndBulkRead() override;
 
 protected:
     PersistentStorageDelegate * mStorage;
+
+private:
+    // Entries of the index of an endpoint: the cluster and attribute ids of a stored value, little-endian.
+    static constexpr size_t kIndexEntrySize = sizeof(ClusterId) + sizeof(AttributeId);
+    static constexpr size_t kMaxIndexSize   = CHIP_CONFIG_PERSISTED_ATTRIBUTE_INDEX_MAX_ENTRIES * kIndexEntrySize;
+    static_assert(kMaxIndexSize <= UINT16_MAX, "The index of an endpoint must fit in a storage value");
+
+    struct Index
+    {
+        bool Contains(ClusterId aClusterId, AttributeId aAttributeId) const;
+        // Appends an entry, unless already listed.  Returns false if the index is full, or out of memory.
+        bool Add(ClusterId aClusterId, AttributeId aAttributeId);
+        void Clear();
+
+        Platform::ScopedMemoryBuffer<uint8_t> mEntries;
+        size_t mSize     = 0;
+        size_t mCapacity = 0;
+    };
+
+    // The index of an endpoint in storage, once looked up.
+    struct EndpointIndex
+    {
+        EndpointIndex * mNext  = nullptr;
+        EndpointId mEndpointId = kInvalidEndpointId;
+        // Whether storage has an index for the endpoint, which mIndex then mirrors.
+        bool mStored = false;
+        Index mIndex;
+    };
+
+    // Looks the index of an endpoint up in storage the first time only.
+    CHIP_ERROR GetEndpointIndex(EndpointId aEndpointId, EndpointIndex *& aEndpointIndex);
+    CHIP_ERROR LoadIndex(EndpointId aEndpointId, Index & aIndex);
+    CHIP_ERROR StoreIndex(EndpointId aEndpointId, const Index & aIndex);
+    CHIP_ERROR DeleteIndex(EndpointIndex & aEndpointIndex);
+    CHIP_ERROR AddToIndex(const ConcreteAttributePath & aPath);
+    CHIP_ERROR ReadStoredValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                               MutableByteSpan & aValue);
+
+    EndpointIndex * mEndpointIndexes = nullptr;
+
+    // The endpoint being bulk read, if any.
+    EndpointIndex * mBulkReadEndpointIndex = nullptr;
+    // Whether the endpoint has no index, which mBulkReadIndex is being built as, from the values found.
+    bool mBulkReadBuildingIndex = false;
+    bool mBulkReadIndexFull     = false;
+    Index mBulkReadIndex;
+    // When the bulk read started, to report how long loading the endpoint took.
+    System::Clock::Microseconds64 mBulkReadStartTime;
 };
 
 } // namespace app
@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/DeferredAttributePersistenceProvider.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+void DeferredAttributePersistenceProvider::Shutdown()
+{
+    Flush();
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::Flush()
+{
+    if (mSystemLayer != nullptr && mWriteWindowStarted)
+    {
+        mSystemLayer->CancelTimer(OnWriteWindowEnd, this);
+    }
+    mWriteWindowStarted = false;
+
+    CHIP_ERROR result = CHIP_NO_ERROR;
+    for (PendingWrite & write : mPendingWrites)
+    {
+        if (!write.mInUse)
+        {
+            continue;
+        }
+
+        write.mInUse   = false;
+        CHIP_ERROR err = mPersister.WriteValue(write.mPath, write.mMetadata, ByteSpan(write.mValue.Get(), write.mValueSize));
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Zcl, "Failed to persist attribute %u/" ChipLogFormatMEI "/" ChipLogFormatMEI ": %" CHIP_ERROR_FORMAT,
+                         write.mPath.mEndpointId, ChipLogValueMEI(write.mPath.mClusterId),
+                         ChipLogValueMEI(write.mPath.mAttributeId), err.Format());
+            if (result == CHIP_NO_ERROR)
+            {
+                result = err;
+            }
+        }
+    }
+
+    return result;
+}
+
+size_t DeferredAttributePersistenceProvider::GetPendingWriteCount() const
+{
+    size_t count = 0;
+    for (const PendingWrite & write : mPendingWrites)
+    {
+        count += write.mInUse ? 1 : 0;
+    }
+    return count;
+}
+
+DeferredAttributePersistenceProvider::PendingWrite *
+DeferredAttributePersistenceProvider::FindPendingWrite(const ConcreteAttributePath & aPath)
+{
+    for (PendingWrite & write : mPendingWrites)
+    {
+        if (write.mInUse && write.mPath == aPath)
+        {
+            return &write;
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath,
+                                                            const EmberAfAttributeMetadata * aMetadata, const ByteSpan & aValue)
+{
+    if (mSystemLayer == nullptr || mWriteWindow == System::Clock::kZero)
+    {
+        return mPersister.WriteValue(aPath, aMetadata, aValue);
+    }
+
+    PendingWrite * write = FindPendingWrite(aPath);
+    if (write == nullptr)
+    {
+        for (PendingWrite & candidate : mPendingWrites)
+        {
+            if (!candidate.mInUse)
+            {
+                write = &candidate;
+                break;
+            }
+        }
+    }
+    if (write == nullptr)
+    {
+        // Every slot is taken: do not hold this one.
+        return mPersister.WriteValue(aPath, aMetadata, aValue);
+    }
+
+    if (write->mValue.Get() == nullptr || write->mValue.AllocatedSize() < aValue.size())
+    {
+        // Values of an attribute are at most as large as its metadata says: allocate that once.
+        size_t size = (aMetadata != nullptr && aMetadata->size > aValue.size()) ? aMetadata->size : aValue.size();
+        if (!write->mValue.Alloc(size > 0 ? size : 1))
+        {
+            write->mInUse = false;
+            return mPersister.WriteValue(aPath, aMetadata, aValue);
+        }
+    }
+
+    if (!aValue.empty())
+    {
+        memcpy(write->mValue.Get(), aValue.data(), aValue.size());
+    }
+    write->mValueSize = aValue.size();
+    write->mMetadata  = aMetadata;
+    write->mPath      = aPath;
+
+    if (!write->mInUse)
+    {
+        write->mInUse = true;
+        // The window starts with the first held value and is not extended by later ones, which bounds how long a value
+        // can stay in RAM only.
+        if (!mWriteWindowStarted)
+        {
+            CHIP_ERROR err = mSystemLayer->StartTimer(mWriteWindow, OnWriteWindowEnd, this);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Zcl, "Failed to defer attribute persistence: %" CHIP_ERROR_FORMAT, err.Format());
+                return Flush();
+            }
+            mWriteWindowStarted = true;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                           const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    PendingWrite * write = FindPendingWrite(aPath);
+    if (write == nullptr)
+    {
+        return mPersister.ReadValue(aPath, aMetadata, aValue);
+    }
+
+    VerifyOrReturnError(aValue.size() >= write->mValueSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    if (write->mValueSize > 0)
+    {
+        memcpy(aValue.data(), write->mValue.Get(), write->mValueSize);
+    }
+    aValue.reduce_size(write->mValueSize);
+    return CHIP_NO_ERROR;
+}
+
+void DeferredAttributePersistenceProvider::OnWriteWindowEnd(System::Layer * systemLayer, void * appState)
+{
+    auto * _this               = static_cast<DeferredAttributePersistenceProvider *>(appState);
+    _this->mWriteWindowStarted = false;
+    _this->Flush();
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePersistenceProvider.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Write-behind AttributePersistenceProvider, wrapping the one actually writing to non-volatile memory.
+ *
+ * The first write of an attribute is held for the write window; the writes of the same attribute within that window only
+ * replace the held value, so that an attribute changing many times in a row (e.g. the CurrentLevel of a dimming
+ * transition) is written once. Every held value is written when the window of the oldest one ends, and on Flush() or
+ * Shutdown(): a reboot loses at most the changes of the last write window.
+ *
+ * At most kMaxPendingWrites attributes are held at a time; writes of other attributes are written through.
+ */
+class DeferredAttributePersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    static constexpr size_t kMaxPendingWrites = CHIP_CONFIG_DEFERRED_ATTRIBUTE_MAX_PENDING_WRITES;
+
+    // Passed-in persister must outlive this object.
+    DeferredAttributePersistenceProvider(AttributePersistenceProvider & persister) : mPersister(persister) {}
+    ~DeferredAttributePersistenceProvider() override { Shutdown(); }
+
+    /**
+     * Start deferring writes. Until Init() is called, and if writeWindow is zero, writes are written through.
+     */
+    CHIP_ERROR Init(System::Layer * systemLayer, System::Clock::Milliseconds32 writeWindow)
+    {
+        VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        mSystemLayer = systemLayer;
+        mWriteWindow = writeWindow;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Write every held value, and write through from then on.
+     */
+    void Shutdown();
+
+    /**
+     * Write every held value now, e.g. when the fail-safe is committed.
+     *
+     * @return the first error of the underlying persister; the values it failed to write are dropped.
+     */
+    CHIP_ERROR Flush();
+
+    size_t GetPendingWriteCount() const;
+
+    // AttributePersistenceProvider implementation.
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                          const ByteSpan & aValue) override;
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+    void StartBulkRead(EndpointId aEndpointId) override { mPersister.StartBulkRead(aEndpointId); }
+    void EndBulkRead() override { mPersister.EndBulkRead(); }
+
+private:
+    struct PendingWrite
+    {
+        bool mInUse = false;
+        ConcreteAttributePath mPath;
+        // Attribute metadata live as long as their endpoint, which outlives the write window.
+        const EmberAfAttributeMetadata * mMetadata = nullptr;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+        size_t mValueSize = 0;
+    };
+
+    PendingWrite * FindPendingWrite(const ConcreteAttributePath & aPath);
+    static void OnWriteWindowEnd(System::Layer * systemLayer, void * appState);
+
+    AttributePersistenceProvider & mPersister;
+    System::Layer * mSystemLayer               = nullptr;
+    System::Clock::Milliseconds32 mWriteWindow = System::Clock::Milliseconds32(0);
+    bool mWriteWindowStarted                   = false;
+    PendingWrite mPendingWrites[kMaxPendingWrites];
+};
+
+} // namespace app
+} // namespace chip
@@ -30,6 +30,8 @@ constexpr size_t kNumPriorityLevel = 3;
 namespace chip {
 namespace app {
 
+class PersistentEventLog;
+
 /**
  * @brief
  *   The Priority of the log entry.
@@ -157,6 +159,9 @@ struct EventLoadOutContext
     const ObjectList<EventPathParams> * mpInterestedEventPaths = nullptr;
     bool mFirst                                                = true;
     Access::SubjectDescriptor mSubjectDescriptor;
+    // Persistent tier merged with the RAM buffers, and the lowest event number it has not been read from yet.
+    PersistentEventLog * mpPersistentEventLog = nullptr;
+    EventNumber mNextPersistedEventNumber     = 0;
 };
 } // namespace app
 } // namespace chip
@@ -24,6 +24,7 @@
 #include <app/RequiredPrivilege.h>
 #include <assert.h>
 #include <inttypes.h>
+#include <limits>
 #include <lib/core/CHIPEventLoggingConfig.h>
 #include <lib/core/CHIPTLVUtilities.hpp>
 #include <lib/support/CodeUtils.h>
@@ -65,8 +66,9 @@ EventManagement & EventManagement::GetInstance(void)
 
 struct ReclaimEventCtx
 {
-    CircularEventBuffer * mpEventBuffer = nullptr;
-    size_t mSpaceNeededForMovedEvent    = 0;
+    CircularEventBuffer * mpEventBuffer       = nullptr;
+    PersistentEventLog * mpPersistentEventLog = nullptr;
+    size_t mSpaceNeededForMovedEvent          = 0;
 };
 
 /**
@@ -180,6 +182,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
         if (requiredSpace > eventBuffer->AvailableDataLength())
         {
             ctx.mpEventBuffer             = eventBuffer;
+            ctx.mpPersistentEventLog      = mpPersistentEventLog;
             ctx.mSpaceNeededForMovedEvent = 0;
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
@@ -338,9 +341,10 @@ void EventManagement::CreateEventManagement(Messaging::ExchangeManager * apExcha
  */
 void EventManagement::DestroyEventManagement()
 {
-    sInstance.mState        = EventManagementStates::Shutdown;
-    sInstance.mpEventBuffer = nullptr;
-    sInstance.mpExchangeMgr = nullptr;
+    sInstance.mState               = EventManagementStates::Shutdown;
+    sInstance.mpEventBuffer        = nullptr;
+    sInstance.mpExchangeMgr        = nullptr;
+    sInstance.mpPersistentEventLog = nullptr;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -633,6 +637,48 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     return err;
 }
 
+CHIP_ERROR EventManagement::CopyPersistedEventsBefore(EventLoadOutContext & aContext, EventNumber aEventLimit)
+{
+    VerifyOrReturnError(aContext.mpPersistentEventLog != nullptr, CHIP_NO_ERROR);
+
+    EventNumber eventNumber;
+    ByteSpan encodedEvent;
+    CHIP_ERROR err;
+    while ((err = aContext.mpPersistentEventLog->GetNextEvent(aContext.mNextPersistedEventNumber, eventNumber, encodedEvent)) ==
+           CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(eventNumber < aEventLimit, CHIP_NO_ERROR);
+
+        TLVReader reader;
+        reader.Init(encodedEvent);
+        ReturnErrorOnFailure(reader.Next());
+        err = CopyEventsSince(reader, 0, &aContext);
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+        aContext.mNextPersistedEventNumber = eventNumber + 1;
+    }
+    return err == CHIP_ERROR_NOT_FOUND ? CHIP_NO_ERROR : err;
+}
+
+CHIP_ERROR EventManagement::CopyEventsSinceMergingPersisted(const TLVReader & aReader, size_t aDepth, void * apContext)
+{
+    EventLoadOutContext * const loadOutContext = static_cast<EventLoadOutContext *>(apContext);
+    EventEnvelopeContext event;
+    TLVReader reader;
+    TLVType containerType;
+    TLVType containerType1;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType1));
+    CHIP_ERROR err = TLV::Utilities::Iterate(reader, FetchEventParameters, &event, false /*recurse*/);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
+    // The persisted events numbered before this one go out first, so that events are copied in event number order.
+    ReturnErrorOnFailure(CopyPersistedEventsBefore(*loadOutContext, event.mEventNumber));
+    return CopyEventsSince(aReader, aDepth, apContext);
+}
+
 CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const ObjectList<EventPathParams> * apEventPathList,
                                              EventNumber & aEventMin, size_t & aEventCount,
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
@@ -646,10 +692,28 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const ObjectLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+
+    err = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+    if (mpPersistentEventLog == nullptr)
+    {
+        err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+    }
+    else
+    {
+        // The RAM buffers are in event number order, but the persistent tier is not behind them: each event is moved
+        // there when it leaves the buffer of its own priority, so a Critical event can still be in RAM long after the
+        // Debug events logged after it were persisted.  Interleave both tiers by event number, so that resuming from
+        // aEventMin neither repeats nor skips events.
+        context.mpPersistentEventLog      = mpPersistentEventLog;
+        context.mNextPersistedEventNumber = aEventMin;
+        err = TLV::Utilities::Iterate(reader, CopyEventsSinceMergingPersisted, &context, recurse);
+        if (err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV)
+        {
+            err = CopyPersistedEventsBefore(context, std::numeric_limits<EventNumber>::max());
+        }
+    }
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
@@ -726,6 +790,12 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     {
         err = CHIP_NO_ERROR;
     }
+    ReturnErrorOnFailure(err);
+
+    if (mpPersistentEventLog != nullptr)
+    {
+        err = mpPersistentEventLog->FabricRemoved(aFabricIndex);
+    }
     return err;
 }
 
@@ -801,6 +871,10 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
     // pull out the delta time, pull out the priority
     ReturnErrorOnFailure(aReader.Next());
 
+    // Keep a reader positioned on the whole event, in case it has to be moved to the persistent tier.
+    TLVReader eventReader;
+    eventReader.Init(aReader);
+
     TLVType containerType;
     TLVType containerType1;
     ReturnErrorOnFailure(aReader.EnterContainer(containerType));
@@ -824,12 +898,24 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
+        ctx->mSpaceNeededForMovedEvent = 0;
+        if (ctx->mpPersistentEventLog != nullptr)
+        {
+            err = ctx->mpPersistentEventLog->AppendEvictedEvent(context.mEventNumber, eventReader);
+            if (err == CHIP_NO_ERROR)
+            {
+                ChipLogDetail(EventLogging, "Moved event number 0x" ChipLogFormatX64 " to persistent event log",
+                              ChipLogValueX64(context.mEventNumber));
+                return CHIP_NO_ERROR;
+            }
+            ChipLogError(EventLogging, "Failed to persist evicted event: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+
         ChipLogProgress(EventLogging,
                         "Dropped 1 event from buffer with priority %u and event number  0x" ChipLogFormatX64
                         " due to overflow: event priority_level: %u",
                         static_cast<unsigned>(eventBuffer->GetPriority()), ChipLogValueX64(context.mEventNumber),
                         static_cast<unsigned>(imp));
-        ctx->mSpaceNeededForMovedEvent = 0;
         return CHIP_NO_ERROR;
     }
 
@@ -28,6 +28,7 @@
 
 #include "EventLoggingDelegate.h"
 #include "EventLoggingTypes.h"
+#include "PersistentEventLog.h"
 #include <access/SubjectDescriptor.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/MessageDef/StatusIB.h>
@@ -228,6 +229,17 @@ public:
 
     static void DestroyEventManagement();
 
+    /**
+     * @brief
+     *   Attach an optional persistent tier to the event log.
+     *
+     * Once attached, events that would otherwise be dropped from the RAM
+     * buffers are appended to apPersistentEventLog, and FetchEventsSince
+     * returns events from both tiers.  Pass nullptr to detach; the caller
+     * keeps ownership of the object and must detach it before destroying it.
+     */
+    void SetPersistentEventLog(PersistentEventLog * apPersistentEventLog) { mpPersistentEventLog = apPersistentEventLog; }
+
     /**
      * @brief
      *   Log an event via a EventLoggingDelegate, with options.
@@ -298,7 +310,8 @@ public:
      * specified event number.  The function will continue fetching events until
      * it runs out of space in the TLV::TLVWriter or in the log. The function
      * will terminate the event writing on event boundary. The function would filter out event based upon interested path
-     * specified by read/subscribe request.
+     * specified by read/subscribe request.  When a PersistentEventLog is attached, events
+     * stored there are merged with the ones still held in the RAM buffers, in event number order.
      *
      * @param[in] aWriter     The writer to use for event storage
      * @param[in] apEventPathList the interested EventPathParams list
@@ -439,6 +452,23 @@ private:
      */
     static CHIP_ERROR CopyEventsSince(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince for the persistent tier
+     *
+     * Runs CopyEventsSince over the events of the persistent tier of aContext numbered from
+     * aContext.mNextPersistedEventNumber up to, but excluding, aEventLimit, in event number order.
+     */
+    static CHIP_ERROR CopyPersistedEventsBefore(EventLoadOutContext & aContext, EventNumber aEventLimit);
+
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince when a persistent tier is attached
+     *
+     * Iterator function which copies the persisted events numbered before the event under aReader, then that event.
+     */
+    static CHIP_ERROR CopyEventsSinceMergingPersisted(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      *
@@ -503,6 +533,7 @@ private:
     // EventBuffer for debug level,
     CircularEventBuffer * mpEventBuffer        = nullptr;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
+    PersistentEventLog * mpPersistentEventLog  = nullptr;
     EventManagementStates mState               = EventManagementStates::Shutdown;
     uint32_t mBytesWritten                     = 0;
 
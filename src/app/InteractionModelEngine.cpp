@@ -50,14 +50,16 @@ InteractionModelEngine * InteractionModelEngine::GetInstance()
 }
 
 CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeMgr, FabricTable * apFabricTable,
-                                        CASESessionManager * apCASESessionMgr)
+                                        CASESessionManager * apCASESessionMgr,
+                                        SubscriptionResumptionStorage * apSubscriptionResumptionStorage)
 {
     VerifyOrReturnError(apFabricTable != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(apExchangeMgr != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    mpExchangeMgr    = apExchangeMgr;
-    mpFabricTable    = apFabricTable;
-    mpCASESessionMgr = apCASESessionMgr;
+    mpExchangeMgr                   = apExchangeMgr;
+    mpFabricTable                   = apFabricTable;
+    mpCASESessionMgr                = apCASESessionMgr;
+    mpSubscriptionResumptionStorage = apSubscriptionResumptionStorage;
 
     ReturnErrorOnFailure(mpFabricTable->AddFabricDelegate(this));
     ReturnErrorOnFailure(mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
@@ -82,10 +84,12 @@ void InteractionModelEngine::Shutdown()
     {
         CommandHandlerInterface * nextHandler = handlerIter->GetNext();
         handlerIter->SetNext(nullptr);
+        handlerIter->SetNextInBucket(nullptr);
         handlerIter = nextHandler;
     }
 
     mCommandHandlerList = nullptr;
+    mCommandHandlerTable.Clear();
 
     // Increase magic number to invalidate all Handle-s.
     mMagic++;
@@ -139,7 +143,15 @@ void InteractionModelEngine::Shutdown()
     mDataVersionFilterPool.ReleaseAll();
     mpExchangeMgr->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
 
-    mpCASESessionMgr = nullptr;
+    mpCASESessionMgr                = nullptr;
+    mpSubscriptionResumptionStorage = nullptr;
+
+    // Read clients outliving the engine must not be timed out by the manager.
+    if (mpClientSubscriptionManager != nullptr)
+    {
+        mpClientSubscriptionManager->Shutdown();
+        mpClientSubscriptionManager = nullptr;
+    }
 
     //
     // We _should_ be clearing these out, but doing so invites a world
@@ -187,6 +199,33 @@ uint32_t InteractionModelEngine::GetNumActiveReadHandlers(ReadHandler::Interacti
     return count;
 }
 
+void InteractionModelEngine::AlignKeepAlives(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(mKeepAliveAlignmentWindow > System::Clock::kZero);
+
+    Transport::SecureSession * session = aReadHandler.GetSession();
+    VerifyOrReturn(session != nullptr);
+
+    System::Clock::Timestamp deadline = System::SystemClock().GetMonotonicTimestamp() + mKeepAliveAlignmentWindow;
+    uint32_t numAligned               = 0;
+
+    // The keep-alives released here are sent by the same reporting engine run as the one of aReadHandler.
+    mReadHandlers.ForEachActiveObject([&aReadHandler, session, deadline, &numAligned](ReadHandler * handler) {
+        if (handler != &aReadHandler && handler->GetSession() == session && handler->AdvanceKeepAlive(deadline))
+        {
+            numAligned++;
+        }
+
+        return Loop::Continue;
+    });
+
+    if (numAligned > 0)
+    {
+        ChipLogDetail(InteractionModel, "Aligned %" PRIu32 " keep-alive reports with subscription 0x%08" PRIx32, numAligned,
+                      aReadHandler.mSubscriptionId);
+    }
+}
+
 ReadHandler * InteractionModelEngine::ActiveHandlerAt(unsigned int aIndex)
 {
     if (aIndex >= mReadHandlers.Allocated())
@@ -508,7 +547,8 @@ Protocols::InteractionModel::Status InteractionModelEngine::OnReadInitialRequest
                                     "Deleting previous subscription from NodeId: " ChipLogFormatX64 ", FabricIndex: %u",
                                     ChipLogValueX64(apExchangeContext->GetSessionHandle()->AsSecureSession()->GetPeerNodeId()),
                                     apExchangeContext->GetSessionHandle()->GetFabricIndex());
-                    mReadHandlers.ReleaseObject(handler);
+                    // Close() also forgets the persisted subscription, if any.
+                    handler->Close();
                 }
 
                 return Loop::Continue;
@@ -1356,38 +1396,53 @@ CHIP_ERROR InteractionModelEngine::RegisterCommandHandler(CommandHandlerInterfac
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    bool duplicate = false;
+    if (handler->GetEndpointId().HasValue())
     {
-        if (cur->Matches(*handler))
+        duplicate = mCommandHandlerTable.Find(handler->GetEndpointId().Value(), handler->GetClusterId()) != nullptr;
+    }
+    else
+    {
+        // A handler for all endpoints conflicts with any handler for its cluster.
+        for (auto * cur = mCommandHandlerList; cur && !duplicate; cur = cur->GetNext())
         {
-            ChipLogError(InteractionModel, "Duplicate command handler registration failed");
-            return CHIP_ERROR_INCORRECT_STATE;
+            duplicate = cur->Matches(*handler);
         }
     }
+    if (duplicate)
+    {
+        ChipLogError(InteractionModel, "Duplicate command handler registration failed");
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
 
     handler->SetNext(mCommandHandlerList);
     mCommandHandlerList = handler;
+    mCommandHandlerTable.Insert(handler);
 
     return CHIP_NO_ERROR;
 }
 
 void InteractionModelEngine::UnregisterCommandHandlers(EndpointId endpointId)
 {
-    CommandHandlerInterface * prev = nullptr;
+    CommandHandlerInterface * prev        = nullptr;
+    CommandHandlerInterface * nextHandler = nullptr;
 
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    // Fetch the next handler before unlinking the current one, so that the walk goes on past it.
+    for (auto * cur = mCommandHandlerList; cur; cur = nextHandler)
     {
+        nextHandler = cur->GetNext();
         if (cur->MatchesEndpoint(endpointId))
         {
             if (prev == nullptr)
             {
-                mCommandHandlerList = cur->GetNext();
+                mCommandHandlerList = nextHandler;
             }
             else
             {
-                prev->SetNext(cur->GetNext());
+                prev->SetNext(nextHandler);
             }
 
+            mCommandHandlerTable.Remove(cur);
             cur->SetNext(nullptr);
         }
         else
@@ -1415,6 +1470,7 @@ CHIP_ERROR InteractionModelEngine::UnregisterCommandHandler(CommandHandlerInterf
                 prev->SetNext(cur->GetNext());
             }
 
+            mCommandHandlerTable.Remove(cur);
             cur->SetNext(nullptr);
 
             return CHIP_NO_ERROR;
@@ -1428,15 +1484,7 @@ CHIP_ERROR InteractionModelEngine::UnregisterCommandHandler(CommandHandlerInterf
 
 CommandHandlerInterface * InteractionModelEngine::FindCommandHandler(EndpointId endpointId, ClusterId clusterId)
 {
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return mCommandHandlerTable.Find(endpointId, clusterId);
 }
 
 void InteractionModelEngine::OnTimedInteractionFailed(TimedHandler * apTimedHandler)
@@ -1519,6 +1567,56 @@ size_t InteractionModelEngine::GetNumDirtySubscriptions() const
     return numDirtySubscriptions;
 }
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+CHIP_ERROR InteractionModelEngine::ResumeSubscriptions()
+{
+    VerifyOrReturnError(mpSubscriptionResumptionStorage != nullptr && mpCASESessionMgr != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    SubscriptionInfo info;
+    for (size_t index = 0; index < mpSubscriptionResumptionStorage->GetMaxCount(); index++)
+    {
+        CHIP_ERROR err = mpSubscriptionResumptionStorage->Load(index, info);
+        if (err == CHIP_ERROR_NOT_FOUND)
+        {
+            continue;
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(InteractionModel, "Failed to load persisted subscription %u: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(index), err.Format());
+            continue;
+        }
+
+        if (mpFabricTable->FindFabricWithIndex(info.mFabricIndex) == nullptr)
+        {
+            ChipLogProgress(InteractionModel, "Forgetting subscription 0x%08" PRIx32 " of removed FabricIndex %u",
+                            info.mSubscriptionId, info.mFabricIndex);
+            mpSubscriptionResumptionStorage->Delete(info.GetPeer(), info.mSubscriptionId);
+            continue;
+        }
+
+        ReadHandler * handler = mReadHandlers.CreateObject(*this);
+        if (handler == nullptr)
+        {
+            ChipLogError(InteractionModel, "No ReadHandler to resume subscription 0x%08" PRIx32, info.mSubscriptionId);
+            mpSubscriptionResumptionStorage->Delete(info.GetPeer(), info.mSubscriptionId);
+            continue;
+        }
+
+        err = handler->ResumeSubscription(*mpCASESessionMgr, info);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(InteractionModel, "Failed to resume subscription 0x%08" PRIx32 ": %" CHIP_ERROR_FORMAT,
+                         info.mSubscriptionId, err.Format());
+            // Close() forgets the subscription.
+            handler->Close();
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 void InteractionModelEngine::OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex)
 {
     mReadHandlers.ForEachActiveObject([fabricIndex](ReadHandler * handler) {
@@ -1532,6 +1630,17 @@ void InteractionModelEngine::OnFabricRemoved(const FabricTable & fabricTable, Fa
         return Loop::Continue;
     });
 
+    if (mpSubscriptionResumptionStorage != nullptr)
+    {
+        // Also forget the subscriptions persisted but not resumed yet.
+        CHIP_ERROR err = mpSubscriptionResumptionStorage->DeleteAll(fabricIndex);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(InteractionModel, "Failed to forget the subscriptions of FabricIndex %u: %" CHIP_ERROR_FORMAT, fabricIndex,
+                         err.Format());
+        }
+    }
+
     for (auto * readClient = mpActiveReadClientList; readClient != nullptr; readClient = readClient->GetNextClient())
     {
         if (readClient->GetFabricIndex() == fabricIndex)
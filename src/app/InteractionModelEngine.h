@@ -48,10 +48,12 @@
 #include <app/ConcreteCommandPath.h>
 #include <app/DataVersionFilter.h>
 #include <app/EventPathParams.h>
+#include <app/InterfaceDispatchTable.h>
 #include <app/ObjectList.h>
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
 #include <app/StatusResponse.h>
+#include <app/SubscriptionResumptionStorage.h>
 #include <app/TimedHandler.h>
 #include <app/WriteClient.h>
 #include <app/WriteHandler.h>
@@ -60,6 +62,7 @@
 #include <app/util/basic-types.h>
 
 #include <app/CASESessionManager.h>
+#include <app/ClientSubscriptionManager.h>
 
 namespace chip {
 namespace app {
@@ -107,6 +110,8 @@ public:
      *  @param[in]    apExchangeMgr    A pointer to the ExchangeManager object.
      *  @param[in]    apFabricTable    A pointer to the FabricTable object.
      *  @param[in]    apCASESessionMgr An optional pointer to a CASESessionManager (used for re-subscriptions).
+     *  @param[in]    apSubscriptionResumptionStorage An optional pointer to the storage of the subscriptions of the server
+     *                                                 (see CHIP_CONFIG_PERSIST_SUBSCRIPTIONS).
      *
      *  @retval #CHIP_ERROR_INCORRECT_STATE If the state is not equal to
      *          kState_NotInitialized.
@@ -114,7 +119,8 @@ public:
      *
      */
     CHIP_ERROR Init(Messaging::ExchangeManager * apExchangeMgr, FabricTable * apFabricTable,
-                    CASESessionManager * apCASESessionMgr = nullptr);
+                    CASESessionManager * apCASESessionMgr                         = nullptr,
+                    SubscriptionResumptionStorage * apSubscriptionResumptionStorage = nullptr);
 
     void Shutdown();
 
@@ -126,6 +132,47 @@ public:
      */
     CASESessionManager * GetCASESessionManager() const { return mpCASESessionMgr; }
 
+    /**
+     * Returns a pointer to the storage of the subscriptions of the server. This can return nullptr if one wasn't provided
+     * in the call to Init().
+     */
+    SubscriptionResumptionStorage * GetSubscriptionResumptionStorage() const { return mpSubscriptionResumptionStorage; }
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    /**
+     * Resume the subscriptions persisted in the SubscriptionResumptionStorage, typically once when the server starts. Each
+     * subscription is resumed by its own ReadHandler; the ones that cannot be allocated one are forgotten.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE if no SubscriptionResumptionStorage or CASESessionManager was provided to Init().
+     */
+    CHIP_ERROR ResumeSubscriptions();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
+    /**
+     * Set the manager scheduling the liveness and re-subscription timers of client subscriptions (see
+     * ClientSubscriptionManager), or nullptr for each ReadClient to arm its own timers. This must not be changed while
+     * any subscription is established or waiting to re-subscribe.
+     */
+    void SetClientSubscriptionManager(ClientSubscriptionManager * apManager) { mpClientSubscriptionManager = apManager; }
+
+    ClientSubscriptionManager * GetClientSubscriptionManager() const { return mpClientSubscriptionManager; }
+
+    /**
+     * Set the window within which the keep-alive reports of subscriptions sharing a session are aligned: when the keep-alive
+     * of a subscription is due, the keep-alives of the other subscriptions over its session that are past their min interval
+     * and due within the window are sent along with it. Once aligned, subscriptions with the same max interval stay aligned.
+     * A window of 0 sends each keep-alive at its own max interval.
+     */
+    void SetKeepAliveAlignmentWindow(System::Clock::Seconds16 aWindow) { mKeepAliveAlignmentWindow = aWindow; }
+
+    System::Clock::Seconds16 GetKeepAliveAlignmentWindow() const { return mKeepAliveAlignmentWindow; }
+
+    /**
+     * Called by a subscription ReadHandler whose keep-alive report is due, to send the keep-alives of the other
+     * subscriptions over the same session along with it (see SetKeepAliveAlignmentWindow).
+     */
+    void AlignKeepAlives(ReadHandler & aReadHandler);
+
     /**
      * Tears down an active subscription.
      *
@@ -539,6 +586,8 @@ private:
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
 
     CommandHandlerInterface * mCommandHandlerList = nullptr;
+    // Index of mCommandHandlerList by endpoint and cluster, used by FindCommandHandler.
+    InterfaceDispatchTable<CommandHandlerInterface> mCommandHandlerTable;
 
     ObjectPool<CommandHandler, CHIP_IM_MAX_NUM_COMMAND_HANDLER> mCommandHandlerObjs;
     ObjectPool<TimedHandler, CHIP_IM_MAX_NUM_TIMED_HANDLER> mTimedHandlers;
@@ -596,6 +645,13 @@ private:
 
     CASESessionManager * mpCASESessionMgr = nullptr;
 
+    SubscriptionResumptionStorage * mpSubscriptionResumptionStorage = nullptr;
+
+    ClientSubscriptionManager * mpClientSubscriptionManager = nullptr;
+
+    System::Clock::Seconds16 mKeepAliveAlignmentWindow =
+        System::Clock::Seconds16(CHIP_IM_SUBSCRIPTION_KEEPALIVE_ALIGNMENT_WINDOW_SECONDS);
+
     // A magic number for tracking values between stack Shutdown()-s and Init()-s.
     // An ObjectHandle is valid iff. its magic equals to this one.
     uint32_t mMagic = 0;
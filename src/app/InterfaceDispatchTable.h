@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Hash table of interfaces registered for a cluster on either one endpoint or all endpoints, such as
+ * AttributeAccessInterface and CommandHandlerInterface, keyed by (endpoint, cluster).
+ *
+ * The table is intrusive and never allocates: T chains the interfaces sharing a bucket through
+ * GetNextInBucket()/SetNextInBucket(), and provides GetEndpointId() (Missing for all endpoints) and GetClusterId().
+ *
+ * Finding the interface for a concrete endpoint and cluster looks at most at two buckets: the one of the endpoint and
+ * cluster, then the one of the interfaces registered for the cluster on all endpoints.
+ */
+template <typename T, size_t N = CHIP_IM_INTERFACE_DISPATCH_TABLE_SIZE>
+class InterfaceDispatchTable
+{
+public:
+    static_assert(N > 0, "An InterfaceDispatchTable needs at least one bucket");
+
+    void Insert(T * aInterface)
+    {
+        T *& bucket = Bucket(aInterface->GetEndpointId(), aInterface->GetClusterId());
+        aInterface->SetNextInBucket(bucket);
+        bucket = aInterface;
+    }
+
+    void Remove(T * aInterface)
+    {
+        T *& bucket = Bucket(aInterface->GetEndpointId(), aInterface->GetClusterId());
+        T * prev    = nullptr;
+        for (T * cur = bucket; cur != nullptr; prev = cur, cur = cur->GetNextInBucket())
+        {
+            if (cur == aInterface)
+            {
+                if (prev == nullptr)
+                {
+                    bucket = cur->GetNextInBucket();
+                }
+                else
+                {
+                    prev->SetNextInBucket(cur->GetNextInBucket());
+                }
+                cur->SetNextInBucket(nullptr);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Returns the interface registered for aClusterId on aEndpointId, or else for aClusterId on all endpoints, or nullptr.
+     */
+    T * Find(EndpointId aEndpointId, ClusterId aClusterId) const
+    {
+        T * found = FindExact(MakeOptional(aEndpointId), aClusterId);
+        return found != nullptr ? found : FindExact(NullOptional, aClusterId);
+    }
+
+    /**
+     * Returns the interface registered for exactly aEndpointId (Missing for all endpoints) and aClusterId, or nullptr.
+     */
+    T * FindExact(const Optional<EndpointId> & aEndpointId, ClusterId aClusterId) const
+    {
+        for (T * cur = mBuckets[BucketIndex(aEndpointId, aClusterId)]; cur != nullptr; cur = cur->GetNextInBucket())
+        {
+            if (cur->GetClusterId() == aClusterId && cur->GetEndpointId() == aEndpointId)
+            {
+                return cur;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Forget every interface. The interfaces are left chained to each other, and must be reset by the caller.
+     */
+    void Clear()
+    {
+        for (T *& bucket : mBuckets)
+        {
+            bucket = nullptr;
+        }
+    }
+
+private:
+    static size_t BucketIndex(const Optional<EndpointId> & aEndpointId, ClusterId aClusterId)
+    {
+        // Interfaces for all endpoints hash as if registered for kInvalidEndpointId, which no concrete path uses.
+        uint32_t hash = aClusterId ^ (static_cast<uint32_t>(aEndpointId.ValueOr(kInvalidEndpointId)) << 16);
+        // Cluster IDs of the same vendor only differ in their low bits: mix them into the high bits.
+        hash *= 0x9E3779B1u;
+        return (hash ^ (hash >> 16)) % N;
+    }
+
+    T *& Bucket(const Optional<EndpointId> & aEndpointId, ClusterId aClusterId)
+    {
+        return mBuckets[BucketIndex(aEndpointId, aClusterId)];
+    }
+
+    T * mBuckets[N] = {};
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,92 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the interface of an optional persistent tier for the
+ *      event log kept by EventManagement.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * A PersistentEventLog receives events that are about to be dropped from the
+ * in-memory CircularEventBuffers and keeps them in a secondary, typically
+ * non-volatile, store.  EventManagement::FetchEventsSince merges the events of
+ * the persistent tier with the ones still held in the RAM buffers, by event
+ * number, so subscribers that lag behind (or reconnect after a restart) can
+ * still be served events that no longer fit in RAM.
+ *
+ * Events are stored exactly as they are encoded in the CircularEventBuffers:
+ * each one is an anonymous EventReportIB structure, including the internal
+ * fabric index tag used for fabric filtering.
+ *
+ * All methods are called with the CHIP stack lock held.
+ */
+class PersistentEventLog
+{
+public:
+    virtual ~PersistentEventLog() = default;
+
+    /**
+     * Append an event evicted from the RAM event buffers.
+     *
+     * @param[in] aEventNumber The number of the event.
+     * @param[in] aReader      A reader positioned on the event element.
+     *
+     * Events are not appended in event number order: an event is evicted
+     * when it leaves the buffer of its own priority, so a Critical event can
+     * be appended long after the Debug events logged after it.
+     *
+     * A failure is not fatal: the event is dropped, exactly as it would have
+     * been without a persistent tier.
+     */
+    virtual CHIP_ERROR AppendEvictedEvent(EventNumber aEventNumber, const TLV::TLVReader & aReader) = 0;
+
+    /**
+     * Get the stored event with the lowest event number that is at least
+     * aEventMin.
+     *
+     * @param[in]  aEventMin     The lowest event number to look for.
+     * @param[out] aEventNumber  The number of the event found.
+     * @param[out] aEncodedEvent The encoded event, valid until the next call
+     *                           to any method of the log.
+     *
+     * @retval CHIP_NO_ERROR        An event was found.
+     * @retval CHIP_ERROR_NOT_FOUND No stored event is numbered aEventMin or
+     *                              higher.
+     */
+    virtual CHIP_ERROR GetNextEvent(EventNumber aEventMin, EventNumber & aEventNumber, ByteSpan & aEncodedEvent) = 0;
+
+    /**
+     * Invalidate the fabric-sensitive events associated with aFabricIndex, the
+     * same way EventManagement::FabricRemoved does for the RAM buffers.
+     */
+    virtual CHIP_ERROR FabricRemoved(FabricIndex aFabricIndex) = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -145,6 +145,13 @@ CHIP_ERROR ReadClient::ScheduleResubscription(uint32_t aTimeTillNextResubscripti
 
     mDoCaseOnNextResub = aReestablishCASE;
 
+    ClientSubscriptionManager * subscriptionManager = InteractionModelEngine::GetInstance()->GetClientSubscriptionManager();
+    if (subscriptionManager != nullptr)
+    {
+        return subscriptionManager->ScheduleResubscription(*this, mPeer,
+                                                           System::Clock::Milliseconds32(aTimeTillNextResubscriptionMs));
+    }
+
     ReturnErrorOnFailure(
         InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
             System::Clock::Milliseconds32(aTimeTillNextResubscriptionMs), OnResubscribeTimerCallback, this));
@@ -788,7 +795,12 @@ CHIP_ERROR ReadClient::RefreshLivenessCheckTimer()
 
     VerifyOrReturnError(mState == ClientState::SubscriptionActive, CHIP_ERROR_INCORRECT_STATE);
 
-    CancelLivenessCheckTimer();
+    // The subscription manager, if any, just moves the liveness deadline of this subscription.
+    ClientSubscriptionManager * subscriptionManager = InteractionModelEngine::GetInstance()->GetClientSubscriptionManager();
+    if (subscriptionManager == nullptr)
+    {
+        CancelLivenessCheckTimer();
+    }
 
     System::Clock::Timeout timeout;
 
@@ -819,6 +831,12 @@ CHIP_ERROR ReadClient::RefreshLivenessCheckTimer()
         DataManagement,
         "Refresh LivenessCheckTime for %lu milliseconds with SubscriptionId = 0x%08" PRIx32 " Peer = %02x:" ChipLogFormatX64,
         static_cast<long unsigned>(timeout.count()), mSubscriptionId, GetFabricIndex(), ChipLogValueX64(GetPeerNodeId()));
+
+    if (subscriptionManager != nullptr)
+    {
+        return subscriptionManager->TrackLiveness(*this, mPeer, timeout);
+    }
+
     err = InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
         timeout, OnLivenessTimeoutCallback, this);
 
@@ -827,12 +845,26 @@ CHIP_ERROR ReadClient::RefreshLivenessCheckTimer()
 
 void ReadClient::CancelLivenessCheckTimer()
 {
+    ClientSubscriptionManager * subscriptionManager = InteractionModelEngine::GetInstance()->GetClientSubscriptionManager();
+    if (subscriptionManager != nullptr)
+    {
+        subscriptionManager->StopLivenessTracking(*this);
+        return;
+    }
+
     InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
         OnLivenessTimeoutCallback, this);
 }
 
 void ReadClient::CancelResubscribeTimer()
 {
+    ClientSubscriptionManager * subscriptionManager = InteractionModelEngine::GetInstance()->GetClientSubscriptionManager();
+    if (subscriptionManager != nullptr)
+    {
+        subscriptionManager->CancelResubscription(*this);
+        return;
+    }
+
     InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
         OnResubscribeTimerCallback, this);
 }
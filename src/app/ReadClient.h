@@ -395,6 +395,7 @@ public:
 private:
     friend class TestReadInteraction;
     friend class InteractionModelEngine;
+    friend class ClientSubscriptionManager;
 
     enum class ClientState : uint8_t
     {
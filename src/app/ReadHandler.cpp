@@ -23,6 +23,7 @@
  */
 
 #include <app/AppConfig.h>
+#include <app/CASESessionManager.h>
 #include <app/InteractionModelEngine.h>
 #include <app/MessageDef/EventPathIB.h>
 #include <app/MessageDef/StatusResponseMessage.h>
@@ -30,6 +31,7 @@
 #include <app/MessageDef/SubscribeResponseMessage.h>
 #include <lib/core/CHIPTLVUtilities.hpp>
 #include <messaging/ExchangeContext.h>
+#include <system/SystemMetrics.h>
 
 #include <app/ReadHandler.h>
 #include <app/reporting/Engine.h>
@@ -42,6 +44,10 @@ ReadHandler::ReadHandler(ManagementCallback & apCallback, Messaging::ExchangeCon
                          InteractionType aInteractionType) :
     mExchangeCtx(*this),
     mManagementCallback(apCallback)
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    ,
+    mOnConnectedCallback(HandleDeviceConnected, this), mOnConnectionFailureCallback(HandleDeviceConnectionFailure, this)
+#endif
 {
     VerifyOrDie(apExchangeContext != nullptr);
 
@@ -54,8 +60,122 @@ ReadHandler::ReadHandler(ManagementCallback & apCallback, Messaging::ExchangeCon
     SetStateFlag(ReadHandlerFlags::PrimingReports);
 
     mSessionHandle.Grab(mExchangeCtx->GetSessionHandle());
+    SYSTEM_METRICS_GAUGE_INCREMENT(System::Metrics::kGauge_ReadHandlersInUse);
+}
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+ReadHandler::ReadHandler(ManagementCallback & apCallback) :
+    mExchangeCtx(*this), mManagementCallback(apCallback), mOnConnectedCallback(HandleDeviceConnected, this),
+    mOnConnectionFailureCallback(HandleDeviceConnectionFailure, this)
+{
+    mInteractionType            = InteractionType::Subscribe;
+    mLastWrittenEventsBytes     = 0;
+    mTransactionStartGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
+    mFlags.ClearAll();
+    SetStateFlag(ReadHandlerFlags::PrimingReports);
+    SetStateFlag(ReadHandlerFlags::Resuming);
+    SYSTEM_METRICS_GAUGE_INCREMENT(System::Metrics::kGauge_ReadHandlersInUse);
+}
+
+CHIP_ERROR ReadHandler::ResumeSubscription(CASESessionManager & aCaseSessionManager, const SubscriptionInfo & aSubscriptionInfo)
+{
+    VerifyOrReturnError(IsResuming() && IsIdle(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Known before anything can fail, so that Close() forgets the subscription.
+    mSubscriptionId = aSubscriptionInfo.mSubscriptionId;
+    mPersistedPeer  = aSubscriptionInfo.GetPeer();
+
+    auto * engine = InteractionModelEngine::GetInstance();
+
+    // The lists were persisted in the order the handler held them; pushing to the front from the back restores that order.
+    for (size_t i = aSubscriptionInfo.mAttributePathCount; i > 0; i--)
+    {
+        AttributePathParams path = aSubscriptionInfo.mAttributePaths[i - 1];
+        ReturnErrorOnFailure(engine->PushFrontAttributePathList(mpAttributePathList, path));
+    }
+    for (size_t i = aSubscriptionInfo.mEventPathCount; i > 0; i--)
+    {
+        EventPathParams path = aSubscriptionInfo.mEventPaths[i - 1];
+        ReturnErrorOnFailure(engine->PushFrontEventPathParamsList(mpEventPathList, path));
+    }
+    for (size_t i = aSubscriptionInfo.mDataVersionFilterCount; i > 0; i--)
+    {
+        DataVersionFilter filter = aSubscriptionInfo.mDataVersionFilters[i - 1];
+        ReturnErrorOnFailure(engine->PushFrontDataVersionFilterList(mpDataVersionFilterList, filter));
+    }
+    mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributePathList);
+
+    mMinIntervalFloorSeconds = aSubscriptionInfo.mMinInterval;
+    mMaxInterval             = aSubscriptionInfo.mMaxInterval;
+    SetStateFlag(ReadHandlerFlags::FabricFiltered, aSubscriptionInfo.mFabricFiltered);
+
+    ChipLogProgress(DataManagement, "Resuming subscription 0x%08" PRIx32 " of " ChipLogFormatX64 " on fabric %u", mSubscriptionId,
+                    ChipLogValueX64(mPersistedPeer.GetNodeId()), mPersistedPeer.GetFabricIndex());
+
+    aCaseSessionManager.FindOrEstablishSession(mPersistedPeer, &mOnConnectedCallback, &mOnConnectionFailureCallback);
+    return CHIP_NO_ERROR;
+}
+
+void ReadHandler::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr, SessionHandle & sessionHandle)
+{
+    ReadHandler * const _this = static_cast<ReadHandler *>(context);
+
+    _this->mSessionHandle.Grab(sessionHandle);
+    _this->SetStateFlag(ReadHandlerFlags::ForceDirty);
+    _this->MoveToState(HandlerState::GeneratingReports);
 }
 
+void ReadHandler::HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    ReadHandler * const _this = static_cast<ReadHandler *>(context);
+
+    ChipLogError(DataManagement, "Failed to establish CASE to resume subscription 0x%08" PRIx32 ": %" CHIP_ERROR_FORMAT,
+                 _this->mSubscriptionId, error.Format());
+    _this->Close();
+}
+
+void ReadHandler::PersistSubscription()
+{
+    auto * storage = InteractionModelEngine::GetInstance()->GetSubscriptionResumptionStorage();
+    VerifyOrReturn(storage != nullptr);
+
+    SubscriptionInfo info;
+    info.mNodeId         = GetInitiatorNodeId();
+    info.mFabricIndex    = GetAccessingFabricIndex();
+    info.mSubscriptionId = mSubscriptionId;
+    info.mMinInterval    = mMinIntervalFloorSeconds;
+    info.mMaxInterval    = mMaxInterval;
+    info.mFabricFiltered = IsFabricFiltered();
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (auto * path = mpAttributePathList; path != nullptr; path = path->mpNext)
+    {
+        VerifyOrExit(info.mAttributePathCount < SubscriptionInfo::kMaxPaths, err = CHIP_ERROR_BUFFER_TOO_SMALL);
+        info.mAttributePaths[info.mAttributePathCount++] = path->mValue;
+    }
+    for (auto * path = mpEventPathList; path != nullptr; path = path->mpNext)
+    {
+        VerifyOrExit(info.mEventPathCount < SubscriptionInfo::kMaxPaths, err = CHIP_ERROR_BUFFER_TOO_SMALL);
+        info.mEventPaths[info.mEventPathCount++] = path->mValue;
+    }
+    for (auto * filter = mpDataVersionFilterList; filter != nullptr; filter = filter->mpNext)
+    {
+        VerifyOrExit(info.mDataVersionFilterCount < SubscriptionInfo::kMaxPaths, err = CHIP_ERROR_BUFFER_TOO_SMALL);
+        info.mDataVersionFilters[info.mDataVersionFilterCount++] = filter->mValue;
+    }
+
+    SuccessOrExit(err = storage->Save(info));
+    mPersistedPeer = info.GetPeer();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to persist subscription 0x%08" PRIx32 ": %" CHIP_ERROR_FORMAT, mSubscriptionId,
+                     err.Format());
+    }
+}
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 ReadHandler::~ReadHandler()
 {
     auto * appCallback = mManagementCallback.GetAppCallback();
@@ -80,10 +200,26 @@ ReadHandler::~ReadHandler()
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(mpAttributePathList);
     InteractionModelEngine::GetInstance()->ReleaseEventPathList(mpEventPathList);
     InteractionModelEngine::GetInstance()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+    SYSTEM_METRICS_GAUGE_DECREMENT(System::Metrics::kGauge_ReadHandlersInUse);
 }
 
 void ReadHandler::Close()
 {
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    // The subscription is over: it must not be resumed after a restart.
+    auto * storage = InteractionModelEngine::GetInstance()->GetSubscriptionResumptionStorage();
+    if (storage != nullptr && mPersistedPeer.GetFabricIndex() != kUndefinedFabricIndex)
+    {
+        CHIP_ERROR err = storage->Delete(mPersistedPeer, mSubscriptionId);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to forget subscription 0x%08" PRIx32 ": %" CHIP_ERROR_FORMAT, mSubscriptionId,
+                         err.Format());
+        }
+        mPersistedPeer = ScopedNodeId();
+    }
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
     MoveToState(HandlerState::AwaitingDestruction);
     mManagementCallback.OnDone(*this);
 }
@@ -140,7 +276,7 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
         {
             if (IsPriming())
             {
-                err = SendSubscribeResponse();
+                err = IsResuming() ? FinishResumption() : SendSubscribeResponse();
 
                 SetStateFlag(ReadHandlerFlags::ActiveSubscription);
 
@@ -177,7 +313,7 @@ exit:
 CHIP_ERROR ReadHandler::SendStatusReport(Protocols::InteractionModel::Status aStatus)
 {
     VerifyOrReturnLogError(IsReportable(), CHIP_ERROR_INCORRECT_STATE);
-    if (IsPriming() || IsChunkedReport())
+    if ((IsPriming() && !IsResuming()) || IsChunkedReport())
     {
         mSessionHandle.Grab(mExchangeCtx->GetSessionHandle());
     }
@@ -197,7 +333,8 @@ CHIP_ERROR ReadHandler::SendStatusReport(Protocols::InteractionModel::Status aSt
 CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, bool aMoreChunks)
 {
     VerifyOrReturnLogError(IsReportable(), CHIP_ERROR_INCORRECT_STATE);
-    if (IsPriming() || IsChunkedReport())
+    // The first report of a resumed subscription starts a new exchange, like any report after the priming ones.
+    if ((IsPriming() && !IsResuming()) || IsChunkedReport())
     {
         mSessionHandle.Grab(mExchangeCtx->GetSessionHandle());
     }
@@ -279,9 +416,21 @@ CHIP_ERROR ReadHandler::OnMessageReceived(Messaging::ExchangeContext * apExchang
 
 bool ReadHandler::IsFromSubscriber(Messaging::ExchangeContext & apExchangeContext) const
 {
-    return (IsType(InteractionType::Subscribe) &&
-            GetInitiatorNodeId() == apExchangeContext.GetSessionHandle()->AsSecureSession()->GetPeerNodeId() &&
-            GetAccessingFabricIndex() == apExchangeContext.GetSessionHandle()->GetFabricIndex());
+    VerifyOrReturnValue(IsType(InteractionType::Subscribe), false);
+
+    NodeId peerNodeId       = apExchangeContext.GetSessionHandle()->AsSecureSession()->GetPeerNodeId();
+    FabricIndex fabricIndex = apExchangeContext.GetSessionHandle()->GetFabricIndex();
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    // A resumed subscription has no session until CASE to the subscriber is established: match the subscriber it was
+    // persisted for instead.
+    if (mPersistedPeer.GetFabricIndex() != kUndefinedFabricIndex)
+    {
+        return mPersistedPeer == ScopedNodeId(peerNodeId, fabricIndex);
+    }
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
+    return GetInitiatorNodeId() == peerNodeId && GetAccessingFabricIndex() == fabricIndex;
 }
 
 void ReadHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
@@ -550,6 +699,15 @@ CHIP_ERROR ReadHandler::SendSubscribeResponse()
     return mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::SubscribeResponse, std::move(packet));
 }
 
+CHIP_ERROR ReadHandler::FinishResumption()
+{
+    ReturnErrorOnFailure(RefreshSubscribeSyncTimer());
+
+    ClearStateFlag(ReadHandlerFlags::Resuming);
+    ClearStateFlag(ReadHandlerFlags::PrimingReports);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aPayload)
 {
     System::PacketBufferTLVReader reader;
@@ -630,6 +788,9 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     SetStateFlag(ReadHandlerFlags::FabricFiltered, isFabricFiltered);
     ReturnErrorOnFailure(Crypto::DRBG_get_bytes(reinterpret_cast<uint8_t *>(&mSubscriptionId), sizeof(mSubscriptionId)));
     ReturnErrorOnFailure(subscribeRequestParser.ExitContainer());
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    PersistSubscription();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
     MoveToState(HandlerState::GeneratingReports);
 
     mExchangeCtx->WillSendMessage();
@@ -655,6 +816,19 @@ void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLa
     readHandler->ClearStateFlag(ReadHandlerFlags::HoldSync);
     ChipLogProgress(DataManagement, "Refresh subscribe timer sync after %d seconds",
                     readHandler->mMaxInterval - readHandler->mMinIntervalFloorSeconds);
+    InteractionModelEngine::GetInstance()->AlignKeepAlives(*readHandler);
+}
+
+bool ReadHandler::AdvanceKeepAlive(System::Clock::Timestamp aDeadline)
+{
+    VerifyOrReturnValue(IsType(InteractionType::Subscribe) && IsGeneratingReports() && !IsChunkedReport(), false);
+    VerifyOrReturnValue(!mFlags.Has(ReadHandlerFlags::HoldReport) && mFlags.Has(ReadHandlerFlags::HoldSync), false);
+    VerifyOrReturnValue(mMaxIntervalDeadline <= aDeadline, false);
+
+    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
+        OnRefreshSubscribeTimerSyncCallback, this);
+    ClearStateFlag(ReadHandlerFlags::HoldSync);
+    return true;
 }
 
 CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
@@ -670,6 +844,7 @@ CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
                         mMinIntervalFloorSeconds, mMaxInterval);
         SetStateFlag(ReadHandlerFlags::HoldReport);
         SetStateFlag(ReadHandlerFlags::HoldSync);
+        mMaxIntervalDeadline = System::SystemClock().GetMonotonicTimestamp() + System::Clock::Seconds16(mMaxInterval);
         ReturnErrorOnFailure(
             InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
                 System::Clock::Seconds16(mMinIntervalFloorSeconds), OnUnblockHoldReportCallback, this));
@@ -682,6 +857,9 @@ void ReadHandler::ResetPathIterator()
 {
     mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributePathList);
     mAttributeEncoderState       = AttributeValueEncoder::AttributeEncodeState();
+#if CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+    mReportScratchBuffer.Clear();
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
 }
 
 void ReadHandler::SetDirty(const AttributePathParams & aAttributeChanged)
@@ -711,6 +889,9 @@ void ReadHandler::SetDirty(const AttributePathParams & aAttributeChanged)
         // the state of the cluster as present on the server
         mAttributePathExpandIterator.ResetCurrentCluster();
         mAttributeEncoderState = AttributeValueEncoder::AttributeEncodeState();
+#if CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+        mReportScratchBuffer.Clear();
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
     }
 
     if (IsReportable())
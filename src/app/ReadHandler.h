@@ -36,6 +36,10 @@
 #include <app/MessageDef/EventFilterIBs.h>
 #include <app/MessageDef/EventPathIBs.h>
 #include <app/ObjectList.h>
+#include <app/OperationalSessionSetup.h>
+#include <app/SubscriptionResumptionStorage.h>
+#include <app/reporting/ReportScratchBuffer.h>
+#include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLVDebug.hpp>
 #include <lib/support/CodeUtils.h>
@@ -51,6 +55,9 @@
 constexpr uint16_t kSubscriptionMaxIntervalPublisherLimit = 3600; // 3600 seconds
 
 namespace chip {
+
+class CASESessionManager;
+
 namespace app {
 
 //
@@ -165,6 +172,25 @@ public:
      */
     ReadHandler(ManagementCallback & apCallback, Messaging::ExchangeContext * apExchangeContext, InteractionType aInteractionType);
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    /**
+     *
+     *  Constructor for a subscription persisted before the device restarted, to be resumed by ResumeSubscription.
+     *
+     *  The callback passed in has to outlive this handler object.
+     *
+     */
+    ReadHandler(ManagementCallback & apCallback);
+
+    /**
+     *  Resume a persisted subscription: establish a CASE session to the subscriber, then send it a full report of the
+     *  subscription, skipping the clusters whose data version matches the data version filters of the subscribe request.
+     *  The subscriber receives it as a regular report of its existing subscription. If the session cannot be established,
+     *  or if the subscriber no longer knows of the subscription, the handler closes and the subscription is forgotten.
+     */
+    CHIP_ERROR ResumeSubscription(CASESessionManager & aCaseSessionManager, const SubscriptionInfo & aSubscriptionInfo);
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
     const ObjectList<AttributePathParams> * GetAttributePathList() const { return mpAttributePathList; }
     const ObjectList<EventPathParams> * GetEventPathList() const { return mpEventPathList; }
     const ObjectList<DataVersionFilter> * GetDataVersionFilterList() const { return mpDataVersionFilterList; }
@@ -195,7 +221,7 @@ private:
     PriorityLevel GetCurrentPriority() const { return mCurrentPriority; }
     EventNumber & GetEventMin() { return mEventMin; }
 
-    enum class ReadHandlerFlags : uint8_t
+    enum class ReadHandlerFlags : uint16_t
     {
         // mHoldReport is used to prevent subscription data delivery while we are
         // waiting for the min reporting interval to elapse.
@@ -230,6 +256,10 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 7),
+
+        // The subscription is being resumed after the device restarted: its priming reports are sent to a subscriber which
+        // already knows of it, as regular reports, and are not followed by a subscribe response.
+        Resuming = (1 << 8),
     };
 
     /**
@@ -288,6 +318,7 @@ private:
     // and clear that flag on the last chunk, we can use mIsChunkedReport to indicate this state.
     bool IsReporting() const { return mFlags.Has(ReadHandlerFlags::ChunkedReport); }
     bool IsPriming() const { return mFlags.Has(ReadHandlerFlags::PrimingReports); }
+    bool IsResuming() const { return mFlags.Has(ReadHandlerFlags::Resuming); }
     bool IsActiveSubscription() const { return mFlags.Has(ReadHandlerFlags::ActiveSubscription); }
     bool IsFabricFiltered() const { return mFlags.Has(ReadHandlerFlags::FabricFiltered); }
     CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
@@ -362,7 +393,16 @@ private:
     static void OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState);
     static void OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState);
     CHIP_ERROR RefreshSubscribeSyncTimer();
+    // Lets the empty keep-alive report go out now rather than at the max interval, provided the min interval has elapsed and
+    // the max interval elapses no later than aDeadline. Used by InteractionModelEngine::AlignKeepAlives.
+    bool AdvanceKeepAlive(System::Clock::Timestamp aDeadline);
     CHIP_ERROR SendSubscribeResponse();
+    CHIP_ERROR FinishResumption();
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    void PersistSubscription();
+    static void HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr, SessionHandle & sessionHandle);
+    static void HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePaths(AttributePathIBs::Parser & aAttributePathListParser);
@@ -427,6 +467,9 @@ private:
     uint16_t mMinIntervalFloorSeconds = 0;
     uint16_t mMaxInterval             = 0;
 
+    // When the max interval of the current reporting period elapses.
+    System::Clock::Timestamp mMaxIntervalDeadline = System::Clock::kZero;
+
     EventNumber mEventMin = 0;
 
     // The last schedule event number snapshoted in the beginning when preparing to fill new events to reports
@@ -449,11 +492,23 @@ private:
     // The size of AttributeEncoderState is 2 bytes for now.
     AttributeValueEncoder::AttributeEncodeState mAttributeEncoderState;
 
+#if CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+    // The encoded rest of the list attribute being chunked, copied into the following chunks by the report engine.
+    reporting::ReportScratchBuffer mReportScratchBuffer;
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+
     // Current Handler state
     HandlerState mState            = HandlerState::Idle;
     PriorityLevel mCurrentPriority = PriorityLevel::Invalid;
     BitFlags<ReadHandlerFlags> mFlags;
     InteractionType mInteractionType = InteractionType::Read;
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    // The subscriber, once the subscription has been persisted.
+    ScopedNodeId mPersistedPeer;
+    Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
+    Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 };
 } // namespace app
 } // namespace chip
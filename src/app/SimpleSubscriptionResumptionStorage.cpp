@@ -0,0 +1,318 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a SubscriptionResumptionStorage using
+ *      PersistentStorageDelegate as its backend.
+ */
+
+#include <app/SimpleSubscriptionResumptionStorage.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+namespace chip {
+namespace app {
+
+constexpr size_t SimpleSubscriptionResumptionStorage::kMaxCount;
+constexpr size_t SimpleSubscriptionResumptionStorage::kMaxPaths;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kFabricIndexTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kPeerNodeIdTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kSubscriptionIdTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kMinIntervalTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kMaxIntervalTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kFabricFilteredTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kAttributePathsTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kEventPathsTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kDataVersionFiltersTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kEndpointIdTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kClusterIdTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kItemIdTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kListIndexTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kUrgentTag;
+constexpr TLV::Tag SimpleSubscriptionResumptionStorage::kDataVersionTag;
+
+namespace {
+
+// Calls aDecodeItem for each structure of the list at the current position of aReader, storing them in aItems.
+template <typename T, size_t N, typename DecodeItem>
+CHIP_ERROR DecodeList(TLV::TLVReader & aReader, T (&aItems)[N], size_t & aCount, DecodeItem aDecodeItem)
+{
+    TLV::TLVType listType;
+    CHIP_ERROR err;
+
+    aCount = 0;
+    ReturnErrorOnFailure(aReader.EnterContainer(listType));
+    while ((err = aReader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(aCount < N, CHIP_ERROR_NO_MEMORY);
+        TLV::TLVType itemType;
+        ReturnErrorOnFailure(aReader.EnterContainer(itemType));
+        ReturnErrorOnFailure(aDecodeItem(aItems[aCount]));
+        ReturnErrorOnFailure(aReader.ExitContainer(itemType));
+        aCount++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return aReader.ExitContainer(listType);
+}
+
+template <typename T, typename EncodeItem>
+CHIP_ERROR EncodeList(TLV::TLVWriter & aWriter, TLV::Tag aTag, const T * aItems, size_t aCount, EncodeItem aEncodeItem)
+{
+    TLV::TLVType listType;
+    ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Array, listType));
+    for (size_t i = 0; i < aCount; i++)
+    {
+        TLV::TLVType itemType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, itemType));
+        ReturnErrorOnFailure(aEncodeItem(aItems[i]));
+        ReturnErrorOnFailure(aWriter.EndContainer(itemType));
+    }
+    return aWriter.EndContainer(listType);
+}
+
+} // namespace
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::ReadSlot(size_t aIndex, uint8_t * aBuffer, TLV::TLVReader & aReader,
+                                                         TLV::TLVType & aOuterType, ScopedNodeId & aPeer,
+                                                         SubscriptionId & aSubscriptionId)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aIndex < kMaxCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    DefaultStorageKeyAllocator keyAlloc;
+    uint16_t len   = static_cast<uint16_t>(MaxSubscriptionSize());
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(keyAlloc.SubscriptionResumption(aIndex), aBuffer, len);
+    VerifyOrReturnError(err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, CHIP_ERROR_NOT_FOUND);
+    ReturnErrorOnFailure(err);
+
+    aReader.Init(aBuffer, len);
+    ReturnErrorOnFailure(aReader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(aReader.EnterContainer(aOuterType));
+
+    FabricIndex fabricIndex;
+    NodeId nodeId;
+    ReturnErrorOnFailure(aReader.Next(kFabricIndexTag));
+    ReturnErrorOnFailure(aReader.Get(fabricIndex));
+    ReturnErrorOnFailure(aReader.Next(kPeerNodeIdTag));
+    ReturnErrorOnFailure(aReader.Get(nodeId));
+    ReturnErrorOnFailure(aReader.Next(kSubscriptionIdTag));
+    ReturnErrorOnFailure(aReader.Get(aSubscriptionId));
+    aPeer = ScopedNodeId(nodeId, fabricIndex);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteSlot(size_t aIndex)
+{
+    DefaultStorageKeyAllocator keyAlloc;
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(keyAlloc.SubscriptionResumption(aIndex));
+    return err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND ? CHIP_NO_ERROR : err;
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::Load(size_t aIndex, SubscriptionInfo & aInfo)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(MaxSubscriptionSize()), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    ScopedNodeId peer;
+    ReturnErrorOnFailure(ReadSlot(aIndex, buf.Get(), reader, outerType, peer, aInfo.mSubscriptionId));
+    aInfo.mNodeId      = peer.GetNodeId();
+    aInfo.mFabricIndex = peer.GetFabricIndex();
+
+    ReturnErrorOnFailure(reader.Next(kMinIntervalTag));
+    ReturnErrorOnFailure(reader.Get(aInfo.mMinInterval));
+    ReturnErrorOnFailure(reader.Next(kMaxIntervalTag));
+    ReturnErrorOnFailure(reader.Get(aInfo.mMaxInterval));
+    ReturnErrorOnFailure(reader.Next(kFabricFilteredTag));
+    ReturnErrorOnFailure(reader.Get(aInfo.mFabricFiltered));
+
+    ReturnErrorOnFailure(reader.Next(kAttributePathsTag));
+    auto decodeAttributePath = [&reader](AttributePathParams & path) {
+        ReturnErrorOnFailure(reader.Next(kEndpointIdTag));
+        ReturnErrorOnFailure(reader.Get(path.mEndpointId));
+        ReturnErrorOnFailure(reader.Next(kClusterIdTag));
+        ReturnErrorOnFailure(reader.Get(path.mClusterId));
+        ReturnErrorOnFailure(reader.Next(kItemIdTag));
+        ReturnErrorOnFailure(reader.Get(path.mAttributeId));
+        ReturnErrorOnFailure(reader.Next(kListIndexTag));
+        return reader.Get(path.mListIndex);
+    };
+    ReturnErrorOnFailure(DecodeList(reader, aInfo.mAttributePaths, aInfo.mAttributePathCount, decodeAttributePath));
+
+    ReturnErrorOnFailure(reader.Next(kEventPathsTag));
+    auto decodeEventPath = [&reader](EventPathParams & path) {
+        ReturnErrorOnFailure(reader.Next(kEndpointIdTag));
+        ReturnErrorOnFailure(reader.Get(path.mEndpointId));
+        ReturnErrorOnFailure(reader.Next(kClusterIdTag));
+        ReturnErrorOnFailure(reader.Get(path.mClusterId));
+        ReturnErrorOnFailure(reader.Next(kItemIdTag));
+        ReturnErrorOnFailure(reader.Get(path.mEventId));
+        ReturnErrorOnFailure(reader.Next(kUrgentTag));
+        return reader.Get(path.mIsUrgentEvent);
+    };
+    ReturnErrorOnFailure(DecodeList(reader, aInfo.mEventPaths, aInfo.mEventPathCount, decodeEventPath));
+
+    ReturnErrorOnFailure(reader.Next(kDataVersionFiltersTag));
+    auto decodeDataVersionFilter = [&reader](DataVersionFilter & filter) {
+        DataVersion version;
+        ReturnErrorOnFailure(reader.Next(kEndpointIdTag));
+        ReturnErrorOnFailure(reader.Get(filter.mEndpointId));
+        ReturnErrorOnFailure(reader.Next(kClusterIdTag));
+        ReturnErrorOnFailure(reader.Get(filter.mClusterId));
+        ReturnErrorOnFailure(reader.Next(kDataVersionTag));
+        ReturnErrorOnFailure(reader.Get(version));
+        filter.mDataVersion.SetValue(version);
+        return CHIP_NO_ERROR;
+    };
+    ReturnErrorOnFailure(DecodeList(reader, aInfo.mDataVersionFilters, aInfo.mDataVersionFilterCount, decodeDataVersionFilter));
+
+    return reader.ExitContainer(outerType);
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::Save(const SubscriptionInfo & aInfo)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aInfo.mAttributePathCount <= kMaxPaths && aInfo.mEventPathCount <= kMaxPaths &&
+                            aInfo.mDataVersionFilterCount <= kMaxPaths,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(MaxSubscriptionSize()), CHIP_ERROR_NO_MEMORY);
+
+    // Replace the subscription if already stored, or else take the first free slot.
+    Optional<size_t> slot;
+    for (size_t i = 0; i < kMaxCount; i++)
+    {
+        TLV::TLVReader reader;
+        TLV::TLVType outerType;
+        ScopedNodeId peer;
+        SubscriptionId subscriptionId;
+        CHIP_ERROR err = ReadSlot(i, buf.Get(), reader, outerType, peer, subscriptionId);
+        if (err == CHIP_NO_ERROR && peer == aInfo.GetPeer() && subscriptionId == aInfo.mSubscriptionId)
+        {
+            slot.SetValue(i);
+            break;
+        }
+        if (err != CHIP_NO_ERROR && !slot.HasValue())
+        {
+            // Empty, or unreadable and as good as empty.
+            slot.SetValue(i);
+        }
+    }
+    VerifyOrReturnError(slot.HasValue(), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(buf.Get(), MaxSubscriptionSize());
+
+    TLV::TLVType outerType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(kFabricIndexTag, aInfo.mFabricIndex));
+    ReturnErrorOnFailure(writer.Put(kPeerNodeIdTag, aInfo.mNodeId));
+    ReturnErrorOnFailure(writer.Put(kSubscriptionIdTag, aInfo.mSubscriptionId));
+    ReturnErrorOnFailure(writer.Put(kMinIntervalTag, aInfo.mMinInterval));
+    ReturnErrorOnFailure(writer.Put(kMaxIntervalTag, aInfo.mMaxInterval));
+    ReturnErrorOnFailure(writer.PutBoolean(kFabricFilteredTag, aInfo.mFabricFiltered));
+
+    auto encodeAttributePath = [&writer](const AttributePathParams & path) {
+        ReturnErrorOnFailure(writer.Put(kEndpointIdTag, path.mEndpointId));
+        ReturnErrorOnFailure(writer.Put(kClusterIdTag, path.mClusterId));
+        ReturnErrorOnFailure(writer.Put(kItemIdTag, path.mAttributeId));
+        return writer.Put(kListIndexTag, path.mListIndex);
+    };
+    ReturnErrorOnFailure(
+        EncodeList(writer, kAttributePathsTag, aInfo.mAttributePaths, aInfo.mAttributePathCount, encodeAttributePath));
+
+    auto encodeEventPath = [&writer](const EventPathParams & path) {
+        ReturnErrorOnFailure(writer.Put(kEndpointIdTag, path.mEndpointId));
+        ReturnErrorOnFailure(writer.Put(kClusterIdTag, path.mClusterId));
+        ReturnErrorOnFailure(writer.Put(kItemIdTag, path.mEventId));
+        return writer.PutBoolean(kUrgentTag, path.mIsUrgentEvent);
+    };
+    ReturnErrorOnFailure(EncodeList(writer, kEventPathsTag, aInfo.mEventPaths, aInfo.mEventPathCount, encodeEventPath));
+
+    auto encodeDataVersionFilter = [&writer](const DataVersionFilter & filter) {
+        VerifyOrReturnError(filter.mDataVersion.HasValue(), CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.Put(kEndpointIdTag, filter.mEndpointId));
+        ReturnErrorOnFailure(writer.Put(kClusterIdTag, filter.mClusterId));
+        return writer.Put(kDataVersionTag, filter.mDataVersion.Value());
+    };
+    ReturnErrorOnFailure(EncodeList(writer, kDataVersionFiltersTag, aInfo.mDataVersionFilters, aInfo.mDataVersionFilterCount,
+                                    encodeDataVersionFilter));
+
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    DefaultStorageKeyAllocator keyAlloc;
+    return mStorage->SyncSetKeyValue(keyAlloc.SubscriptionResumption(slot.Value()), buf.Get(), static_cast<uint16_t>(len));
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::Delete(const ScopedNodeId & aPeer, SubscriptionId aSubscriptionId)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(MaxSubscriptionSize()), CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < kMaxCount; i++)
+    {
+        TLV::TLVReader reader;
+        TLV::TLVType outerType;
+        ScopedNodeId peer;
+        SubscriptionId subscriptionId;
+        if (ReadSlot(i, buf.Get(), reader, outerType, peer, subscriptionId) == CHIP_NO_ERROR && peer == aPeer &&
+            subscriptionId == aSubscriptionId)
+        {
+            return DeleteSlot(i);
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SimpleSubscriptionResumptionStorage::DeleteAll(FabricIndex aFabricIndex)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(MaxSubscriptionSize()), CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR result = CHIP_NO_ERROR;
+    for (size_t i = 0; i < kMaxCount; i++)
+    {
+        TLV::TLVReader reader;
+        TLV::TLVType outerType;
+        ScopedNodeId peer;
+        SubscriptionId subscriptionId;
+        if (ReadSlot(i, buf.Get(), reader, outerType, peer, subscriptionId) == CHIP_NO_ERROR &&
+            peer.GetFabricIndex() == aFabricIndex)
+        {
+            CHIP_ERROR err = DeleteSlot(i);
+            if (result == CHIP_NO_ERROR)
+            {
+                result = err;
+            }
+        }
+    }
+
+    return result;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a SubscriptionResumptionStorage using
+ *      PersistentStorageDelegate as its backend.
+ */
+
+#pragma once
+
+#include <app/SubscriptionResumptionStorage.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * A SubscriptionResumptionStorage keeping each subscription, encoded in TLV, under its own key.
+ */
+class SimpleSubscriptionResumptionStorage : public SubscriptionResumptionStorage
+{
+public:
+    static constexpr size_t kMaxCount = CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+    static constexpr size_t kMaxPaths = SubscriptionInfo::kMaxPaths;
+
+    // Passed-in storage must outlive this object.
+    CHIP_ERROR Init(PersistentStorageDelegate * storage)
+    {
+        VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        mStorage = storage;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t GetMaxCount() const override { return kMaxCount; }
+    CHIP_ERROR Load(size_t aIndex, SubscriptionInfo & aInfo) override;
+    CHIP_ERROR Save(const SubscriptionInfo & aInfo) override;
+    CHIP_ERROR Delete(const ScopedNodeId & aPeer, SubscriptionId aSubscriptionId) override;
+    CHIP_ERROR DeleteAll(FabricIndex aFabricIndex) override;
+
+private:
+    static constexpr size_t MaxListSize(size_t itemSize) { return TLV::EstimateStructOverhead((1 + itemSize) * kMaxPaths); }
+
+    static constexpr size_t MaxAttributePathSize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(EndpointId), sizeof(ClusterId), sizeof(AttributeId), sizeof(ListIndex));
+    }
+
+    static constexpr size_t MaxEventPathSize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(EndpointId), sizeof(ClusterId), sizeof(EventId), sizeof(bool));
+    }
+
+    static constexpr size_t MaxDataVersionFilterSize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(EndpointId), sizeof(ClusterId), sizeof(DataVersion));
+    }
+
+    static constexpr size_t MaxSubscriptionSize()
+    {
+        return TLV::EstimateStructOverhead(sizeof(FabricIndex), sizeof(NodeId), sizeof(SubscriptionId), sizeof(uint16_t),
+                                           sizeof(uint16_t), sizeof(bool), MaxListSize(MaxAttributePathSize()),
+                                           MaxListSize(MaxEventPathSize()), MaxListSize(MaxDataVersionFilterSize()));
+    }
+
+    static constexpr TLV::Tag kFabricIndexTag        = TLV::ContextTag(1);
+    static constexpr TLV::Tag kPeerNodeIdTag         = TLV::ContextTag(2);
+    static constexpr TLV::Tag kSubscriptionIdTag     = TLV::ContextTag(3);
+    static constexpr TLV::Tag kMinIntervalTag        = TLV::ContextTag(4);
+    static constexpr TLV::Tag kMaxIntervalTag        = TLV::ContextTag(5);
+    static constexpr TLV::Tag kFabricFilteredTag     = TLV::ContextTag(6);
+    static constexpr TLV::Tag kAttributePathsTag     = TLV::ContextTag(7);
+    static constexpr TLV::Tag kEventPathsTag         = TLV::ContextTag(8);
+    static constexpr TLV::Tag kDataVersionFiltersTag = TLV::ContextTag(9);
+
+    static constexpr TLV::Tag kEndpointIdTag  = TLV::ContextTag(1);
+    static constexpr TLV::Tag kClusterIdTag   = TLV::ContextTag(2);
+    static constexpr TLV::Tag kItemIdTag      = TLV::ContextTag(3);
+    static constexpr TLV::Tag kListIndexTag   = TLV::ContextTag(4);
+    static constexpr TLV::Tag kUrgentTag      = TLV::ContextTag(4);
+    static constexpr TLV::Tag kDataVersionTag = TLV::ContextTag(3);
+
+    // Reads slot aIndex into aBuffer, which must hold MaxSubscriptionSize() bytes, and enters the subscription structure,
+    // leaving aReader positioned after the subscription ID.
+    CHIP_ERROR ReadSlot(size_t aIndex, uint8_t * aBuffer, TLV::TLVReader & aReader, TLV::TLVType & aOuterType, ScopedNodeId & aPeer,
+                        SubscriptionId & aSubscriptionId);
+    CHIP_ERROR DeleteSlot(size_t aIndex);
+
+    PersistentStorageDelegate * mStorage = nullptr;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the interface to persist the subscriptions of the
+ *      server, so that they can be resumed after a reboot.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/DataVersionFilter.h>
+#include <app/EventPathParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/ScopedNodeId.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * The parameters of a subscription established by a peer, as needed to resume it. Subscriptions with more than
+ * kMaxPaths attribute paths, event paths or data version filters cannot be resumed.
+ */
+struct SubscriptionInfo
+{
+    static constexpr size_t kMaxPaths = CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_PATHS;
+
+    NodeId mNodeId                 = kUndefinedNodeId;
+    FabricIndex mFabricIndex       = kUndefinedFabricIndex;
+    SubscriptionId mSubscriptionId = 0;
+    uint16_t mMinInterval          = 0;
+    uint16_t mMaxInterval          = 0;
+    bool mFabricFiltered           = false;
+
+    AttributePathParams mAttributePaths[kMaxPaths];
+    size_t mAttributePathCount = 0;
+    EventPathParams mEventPaths[kMaxPaths];
+    size_t mEventPathCount = 0;
+    // The data version filters of the subscribe request: a resumed subscription does not report the clusters whose
+    // data version still matches.
+    DataVersionFilter mDataVersionFilters[kMaxPaths];
+    size_t mDataVersionFilterCount = 0;
+
+    ScopedNodeId GetPeer() const { return ScopedNodeId(mNodeId, mFabricIndex); }
+};
+
+/**
+ * Storage of the subscriptions of the server, used by InteractionModelEngine to resume them after a reboot instead of
+ * waiting for every subscriber to notice, through its liveness timeout, that they are gone.
+ *
+ * Subscriptions are stored in a fixed number of slots.
+ */
+class SubscriptionResumptionStorage
+{
+public:
+    virtual ~SubscriptionResumptionStorage() = default;
+
+    /**
+     * Number of slots, and therefore of subscriptions, the storage holds.
+     */
+    virtual size_t GetMaxCount() const = 0;
+
+    /**
+     * Load the subscription stored in a slot.
+     *
+     * @retval CHIP_ERROR_NOT_FOUND if the slot is empty.
+     */
+    virtual CHIP_ERROR Load(size_t aIndex, SubscriptionInfo & aInfo) = 0;
+
+    /**
+     * Store a subscription, replacing the one with the same peer and subscription ID if any.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if every slot is in use.
+     */
+    virtual CHIP_ERROR Save(const SubscriptionInfo & aInfo) = 0;
+
+    /**
+     * Forget a subscription. Forgetting a subscription that is not stored is not an error.
+     */
+    virtual CHIP_ERROR Delete(const ScopedNodeId & aPeer, SubscriptionId aSubscriptionId) = 0;
+
+    /**
+     * Forget every subscription of a fabric.
+     */
+    virtual CHIP_ERROR DeleteAll(FabricIndex aFabricIndex) = 0;
+};
+
+} // namespace app
+} // namespace chip
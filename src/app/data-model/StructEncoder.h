@@ -0,0 +1,280 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Encode.h>
+#include <app/data-model/Nullable.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/Optional.h>
+#include <lib/support/BitFlags.h>
+#include <lib/support/BitMask.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+
+#include <type_traits>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+namespace detail {
+
+/*
+ * InPlaceField<X> encodes a struct field of type X with a TLV::InPlaceWriter, exactly as DataModel::Encode encodes it
+ * with a TLVWriter.  kMaxSize is the largest encoded size of the field, or 0 for types which cannot be encoded in place
+ * (strings, lists, structs).
+ */
+template <typename X, typename = void>
+struct InPlaceField
+{
+    static constexpr uint32_t kMaxSize = 0;
+};
+
+template <typename X>
+struct InPlaceField<X, std::enable_if_t<std::is_integral<X>::value && !std::is_same<X, bool>::value>>
+{
+    static constexpr uint32_t kMaxSize = 2 + sizeof(X);
+
+    template <typename U = X, std::enable_if_t<std::is_signed<U>::value, int> = 0>
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, X x)
+    {
+        writer.PutSigned(tagNum, static_cast<int64_t>(x));
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename U = X, std::enable_if_t<!std::is_signed<U>::value, int> = 0>
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, X x)
+    {
+        writer.PutUnsigned(tagNum, static_cast<uint64_t>(x));
+        return CHIP_NO_ERROR;
+    }
+};
+
+template <>
+struct InPlaceField<bool>
+{
+    static constexpr uint32_t kMaxSize = 2;
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, bool x)
+    {
+        writer.PutBoolean(tagNum, x);
+        return CHIP_NO_ERROR;
+    }
+};
+
+template <>
+struct InPlaceField<float>
+{
+    static constexpr uint32_t kMaxSize = 2 + sizeof(float);
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, float x)
+    {
+        writer.PutFloat(tagNum, x);
+        return CHIP_NO_ERROR;
+    }
+};
+
+template <>
+struct InPlaceField<double>
+{
+    static constexpr uint32_t kMaxSize = 2 + sizeof(double);
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, double x)
+    {
+        writer.PutDouble(tagNum, x);
+        return CHIP_NO_ERROR;
+    }
+};
+
+template <typename X>
+struct InPlaceField<X, std::enable_if_t<std::is_enum<X>::value>>
+{
+    static constexpr uint32_t kMaxSize = InPlaceField<std::underlying_type_t<X>>::kMaxSize;
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, X x)
+    {
+        return InPlaceField<std::underlying_type_t<X>>::Encode(writer, tagNum, to_underlying(x));
+    }
+};
+
+template <typename X, typename StorageType>
+struct InPlaceField<BitFlags<X, StorageType>>
+{
+    static constexpr uint32_t kMaxSize = InPlaceField<StorageType>::kMaxSize;
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, BitFlags<X, StorageType> x)
+    {
+        return InPlaceField<StorageType>::Encode(writer, tagNum, x.Raw());
+    }
+};
+
+template <typename X, typename StorageType>
+struct InPlaceField<BitMask<X, StorageType>> : InPlaceField<BitFlags<X, StorageType>>
+{
+};
+
+template <typename X>
+struct InPlaceField<Optional<X>>
+{
+    static constexpr uint32_t kMaxSize = InPlaceField<X>::kMaxSize;
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, const Optional<X> & x)
+    {
+        if (x.HasValue())
+        {
+            return InPlaceField<X>::Encode(writer, tagNum, x.Value());
+        }
+        return CHIP_NO_ERROR;
+    }
+};
+
+template <typename X>
+struct InPlaceField<Nullable<X>>
+{
+    // A null takes 2 bytes, which is less than any value.
+    static constexpr uint32_t kMaxSize = InPlaceField<X>::kMaxSize;
+
+    static CHIP_ERROR Encode(TLV::InPlaceWriter & writer, uint8_t tagNum, const Nullable<X> & x)
+    {
+        if (x.IsNull())
+        {
+            writer.PutNull(tagNum);
+            return CHIP_NO_ERROR;
+        }
+
+        // Same as DataModel::Encode of a nullable value.
+#if !CONFIG_BUILD_FOR_HOST_UNIT_TEST
+        if (!x.HasValidValue())
+        {
+            return CHIP_IM_GLOBAL_STATUS(ConstraintError);
+        }
+#endif // !CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
+#pragma GCC diagnostic push
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif // !defined(__clang__)
+        return InPlaceField<X>::Encode(writer, tagNum, x.Value());
+#pragma GCC diagnostic pop
+    }
+};
+
+/*
+ * InPlaceStruct<FieldId, X, ...> describes the fields of a struct, given as (field id, field type) pairs: kMaxSize is the
+ * largest encoded size of all the fields, or 0 if any of them cannot be encoded in place.
+ */
+constexpr uint32_t AddMaxSizes(uint32_t a, uint32_t b)
+{
+    return (a == 0 || b == 0) ? 0 : a + b;
+}
+
+template <typename... FieldIdsAndTypes>
+struct InPlaceStruct
+{
+    static constexpr uint32_t kMaxSize = 0;
+};
+
+template <typename FieldId, typename X>
+struct InPlaceStruct<FieldId, X>
+{
+    static constexpr uint32_t kMaxSize = InPlaceField<X>::kMaxSize;
+};
+
+template <typename FieldId, typename X, typename... Rest>
+struct InPlaceStruct<FieldId, X, Rest...>
+{
+    static constexpr uint32_t kMaxSize = AddMaxSizes(InPlaceField<X>::kMaxSize, InPlaceStruct<Rest...>::kMaxSize);
+};
+
+inline CHIP_ERROR EncodeFields(TLV::TLVWriter &)
+{
+    return CHIP_NO_ERROR;
+}
+
+template <typename FieldId, typename X, typename... Rest>
+CHIP_ERROR EncodeFields(TLV::TLVWriter & writer, FieldId fieldId, const X & x, const Rest &... rest)
+{
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(static_cast<uint8_t>(to_underlying(fieldId))), x));
+    return EncodeFields(writer, rest...);
+}
+
+inline CHIP_ERROR EncodeFieldsInPlace(TLV::InPlaceWriter &)
+{
+    return CHIP_NO_ERROR;
+}
+
+template <typename FieldId, typename X, typename... Rest>
+CHIP_ERROR EncodeFieldsInPlace(TLV::InPlaceWriter & writer, FieldId fieldId, const X & x, const Rest &... rest)
+{
+    ReturnErrorOnFailure(InPlaceField<X>::Encode(writer, static_cast<uint8_t>(to_underlying(fieldId)), x));
+    return EncodeFieldsInPlace(writer, rest...);
+}
+
+template <typename... FieldIdsAndValues>
+CHIP_ERROR EncodeStructFields(std::false_type, TLV::TLVWriter & writer, const FieldIdsAndValues &... fieldIdsAndValues)
+{
+    return EncodeFields(writer, fieldIdsAndValues...);
+}
+
+template <typename... FieldIdsAndValues>
+CHIP_ERROR EncodeStructFields(std::true_type, TLV::TLVWriter & writer, const FieldIdsAndValues &... fieldIdsAndValues)
+{
+    TLV::InPlaceWriter inPlaceWriter(writer, InPlaceStruct<FieldIdsAndValues...>::kMaxSize);
+    if (!inPlaceWriter.IsActive())
+    {
+        return EncodeFields(writer, fieldIdsAndValues...);
+    }
+
+    // Finalize even on failure, to leave the writer where the field by field encoding would have.
+    CHIP_ERROR err = EncodeFieldsInPlace(inPlaceWriter, fieldIdsAndValues...);
+    inPlaceWriter.Finalize();
+    return err;
+}
+
+} // namespace detail
+
+/*
+ * @brief
+ *
+ * Encodes a struct (the fields of a cluster struct, command or event) given as a list of its field ids, each followed by
+ * the value of the field.  This produces the same encoding as encoding each field with DataModel::Encode within a
+ * structure container.
+ *
+ * When all the fields are scalars (integers, enums, bitmaps, booleans, floating point numbers, and optional or nullable
+ * ones), and the current buffer of the writer has room for the largest encoding of all of them, the fields are encoded
+ * straight into the buffer, without checking the space left for each of them.
+ */
+template <typename... FieldIdsAndValues>
+CHIP_ERROR EncodeStruct(TLV::TLVWriter & writer, TLV::Tag tag, const FieldIdsAndValues &... fieldIdsAndValues)
+{
+    static_assert(sizeof...(FieldIdsAndValues) % 2 == 0, "Each field id must be followed by the value of the field");
+
+    constexpr bool kInPlace =
+        CHIP_CONFIG_IN_PLACE_CLUSTER_OBJECT_ENCODING && detail::InPlaceStruct<FieldIdsAndValues...>::kMaxSize != 0;
+
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(detail::EncodeStructFields(std::integral_constant<bool, kInPlace>(), writer, fieldIdsAndValues...));
+    return writer.EndContainer(outer);
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
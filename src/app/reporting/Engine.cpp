@@ -28,6 +28,8 @@
 #include <app/RequiredPrivilege.h>
 #include <app/reporting/Engine.h>
 #include <app/util/MatterCallbacks.h>
+#include <system/SystemMetrics.h>
+#include <trace/trace.h>
 
 using namespace chip::Access;
 
@@ -84,10 +86,69 @@ Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool a
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR Engine::RetrieveChunkedClusterData(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
+                                              const ConcreteReadAttributePath & aPath,
+                                              AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+{
+#if CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+    ReportScratchBuffer & scratch = apReadHandler->mReportScratchBuffer;
+
+    // A partial data state means this is the rest of a list which did not fit in the previous chunk: read it once into the
+    // scratch buffer and copy it from there, for this chunk and the following ones.
+    while (apEncoderState->AllowPartialData())
+    {
+        if (scratch.IsEmpty())
+        {
+            TLV::TLVWriter scratchWriter;
+            AttributeReportIBs::Builder scratchReportIBs;
+            AttributeValueEncoder::AttributeEncodeState nextState = *apEncoderState;
+
+            CHIP_ERROR err = scratch.StartFill(scratchWriter, scratchReportIBs);
+            if (err == CHIP_NO_ERROR)
+            {
+                err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                                          scratchReportIBs, aPath, &nextState);
+            }
+
+            if (err == CHIP_NO_ERROR)
+            {
+                scratch.EndFill(scratchWriter, true /* aIsListEnd */, nextState);
+            }
+            else if (nextState.AllowPartialData() && err == CHIP_ERROR_BUFFER_TOO_SMALL)
+            {
+                scratch.EndFill(scratchWriter, false /* aIsListEnd */, nextState);
+            }
+
+            if (scratch.IsEmpty() && !scratch.IsListEnd())
+            {
+                // Nothing fits in the scratch buffer, or it could not be allocated: read straight into the chunk.
+                scratch.Clear();
+                break;
+            }
+        }
+
+        // On failure, apEncoderState still allows partial data, which keeps what was copied in this chunk.
+        ReturnErrorOnFailure(scratch.CopyTo(aAttributeReportIBs));
+
+        if (scratch.IsListEnd())
+        {
+            scratch.Clear();
+            return CHIP_NO_ERROR;
+        }
+        // The scratch buffer is used up but the list goes on: read the next items into it.
+        *apEncoderState = scratch.GetNextState();
+    }
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+
+    return RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), aAttributeReportIBs,
+                               aPath, apEncoderState);
+}
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
                                                            bool * apHasEncodedData)
 {
+    MATTER_TRACE_EVENT_SCOPE("BuildSingleReportDataAttributeReportIBs", "ReportingEngine");
     CHIP_ERROR err            = CHIP_NO_ERROR;
     bool attributeDataWritten = false;
     bool hasMoreChunks        = true;
@@ -177,8 +238,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), attributeReportIBs,
-                                      pathForRetrieval, &encodeState);
+            err = RetrieveChunkedClusterData(apReadHandler, attributeReportIBs, pathForRetrieval, &encodeState);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(DataManagement,
@@ -200,6 +260,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                     // attributeReportIB to avoid any partial data.
                     attributeReportIBs.Rollback(attributeBackup);
                     apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
+#if CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+                    apReadHandler->mReportScratchBuffer.Clear();
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
 
                     if (err != CHIP_ERROR_NO_MEMORY && err != CHIP_ERROR_BUFFER_TOO_SMALL)
                     {
@@ -335,6 +398,7 @@ CHIP_ERROR Engine::CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool &
 CHIP_ERROR Engine::BuildSingleReportDataEventReports(ReportDataMessage::Builder & aReportDataBuilder, ReadHandler * apReadHandler,
                                                      bool aBufferIsUsed, bool * apHasMoreChunks, bool * apHasEncodedData)
 {
+    MATTER_TRACE_EVENT_SCOPE("BuildSingleReportDataEventReports", "ReportingEngine");
     CHIP_ERROR err        = CHIP_NO_ERROR;
     size_t eventCount     = 0;
     bool hasEncodedStatus = false;
@@ -445,6 +509,7 @@ exit:
 
 CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 {
+    MATTER_TRACE_EVENT_SCOPE("BuildAndSendSingleReportData", "ReportingEngine");
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportDataMessage::Builder reportDataBuilder;
@@ -611,6 +676,7 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
+    MATTER_TRACE_EVENT_SCOPE("Run", "ReportingEngine");
     uint32_t numReadHandled = 0;
 
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
@@ -843,8 +909,12 @@ CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
 
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aHasMoreChunks)
 {
+    MATTER_TRACE_EVENT_SCOPE("SendReport", "ReportingEngine");
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_ReportsSent);
+    SYSTEM_METRICS_RECORD(System::Metrics::kHistogram_ReportSizeBytes, aPayload->TotalLength());
+
     // We can only have 1 report in flight for any given read - increment and break out.
     mNumReportsInFlight++;
     err = apReadHandler->SendReportData(std::move(aPayload), aHasMoreChunks);
@@ -164,6 +164,11 @@ private:
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
                                    AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+    // Same as RetrieveClusterData for the current path of apReadHandler, except that the rest of a list chunked over several
+    // reports is read once into the scratch buffer of the read handler, and copied from there.
+    CHIP_ERROR RetrieveChunkedClusterData(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
+                                          const ConcreteReadAttributePath & aPath,
+                                          AttributeValueEncoder::AttributeEncodeState * apEncoderState);
     CHIP_ERROR CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool & aHasEncodedData, ReadHandler * apReadHandler);
 
     // If version match, it means don't send, if version mismatch, it means send.
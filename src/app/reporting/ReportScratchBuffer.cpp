@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportScratchBuffer.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR ReportScratchBuffer::StartFill(TLV::TLVWriter & aWriter, AttributeReportIBs::Builder & aBuilder)
+{
+    mReadOffset = mLength = 0;
+    mIsListEnd            = false;
+    if (!mBuffer)
+    {
+        mBuffer.Alloc(kSize);
+        VerifyOrReturnError(mBuffer, CHIP_ERROR_NO_MEMORY);
+    }
+
+    // The IBs are read back as top level elements, after the start of this array, which is never ended.
+    aWriter.Init(mBuffer.Get(), kSize);
+    ReturnErrorOnFailure(aBuilder.Init(&aWriter));
+    mReadOffset = mLength = aWriter.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+void ReportScratchBuffer::EndFill(const TLV::TLVWriter & aWriter, bool aIsListEnd,
+                                  const AttributeValueEncoder::AttributeEncodeState & aNextState)
+{
+    mLength    = aWriter.GetLengthWritten();
+    mIsListEnd = aIsListEnd;
+    mNextState = aNextState;
+}
+
+CHIP_ERROR ReportScratchBuffer::CopyTo(AttributeReportIBs::Builder & aBuilder)
+{
+    TLV::TLVReader reader;
+    reader.Init(mBuffer.Get() + mReadOffset, mLength - mReadOffset);
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        // Copy each IB atomically, so that the chunk only has whole IBs.
+        TLV::TLVWriter backup;
+        aBuilder.Checkpoint(backup);
+        err = aBuilder.GetWriter()->CopyContainer(TLV::AnonymousTag(), reader);
+        if (err != CHIP_NO_ERROR)
+        {
+            aBuilder.Rollback(backup);
+            return err;
+        }
+        mReadOffset = static_cast<uint32_t>(reader.GetReadPoint() - mBuffer.Get());
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    mReadOffset = mLength;
+    return CHIP_NO_ERROR;
+}
+
+void ReportScratchBuffer::Clear()
+{
+    mBuffer.Free();
+    mReadOffset = mLength = 0;
+    mIsListEnd            = false;
+    mNextState            = AttributeValueEncoder::AttributeEncodeState();
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the scratch buffer a read handler keeps the encoded rest of a chunked list attribute in.
+ *
+ */
+
+#pragma once
+
+#include <app/AttributeAccessInterface.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/ScopedBuffer.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * When a list attribute does not fit in a chunk of a report, the report engine reads it once into a ReportScratchBuffer
+ * from the first list item which did not fit, and copies the AttributeReportIBs of the items from the buffer into the
+ * following chunks, instead of reading the attribute again (and skipping the items already sent) for each chunk.
+ *
+ * The buffer is allocated by the first fill, reused by the next ones when the rest of the list does not fit in it, and
+ * freed by Clear() once the list is sent.
+ */
+class ReportScratchBuffer
+{
+public:
+    static constexpr uint32_t kSize = CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE;
+
+    /**
+     * Starts filling the buffer with the AttributeReportIBs of a list, dropping any earlier content.
+     *
+     * @param[out] aWriter   The writer to use for aBuilder, which must outlive it.
+     * @param[out] aBuilder  An AttributeReportIBs builder writing into the buffer.
+     */
+    CHIP_ERROR StartFill(TLV::TLVWriter & aWriter, AttributeReportIBs::Builder & aBuilder);
+
+    /**
+     * Ends filling the buffer with what aWriter wrote since StartFill.
+     *
+     * @param[in] aWriter      The writer passed to StartFill.
+     * @param[in] aIsListEnd   Whether the buffer holds the end of the list.
+     * @param[in] aNextState   The encode state to read the items after the buffer with, when aIsListEnd is false.
+     */
+    void EndFill(const TLV::TLVWriter & aWriter, bool aIsListEnd, const AttributeValueEncoder::AttributeEncodeState & aNextState);
+
+    /**
+     * Copies the AttributeReportIBs of the buffer, in order, into aBuilder, as long as they fit.  The copied IBs are
+     * removed from the buffer.
+     *
+     * @retval #CHIP_NO_ERROR once the buffer is empty.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL or #CHIP_ERROR_NO_MEMORY if an IB does not fit, in which case the writer of
+     *         aBuilder is left after the last whole IB copied.
+     */
+    CHIP_ERROR CopyTo(AttributeReportIBs::Builder & aBuilder);
+
+    bool IsEmpty() const { return mReadOffset == mLength; }
+    bool IsListEnd() const { return mIsListEnd; }
+    const AttributeValueEncoder::AttributeEncodeState & GetNextState() const { return mNextState; }
+
+    /**
+     * Drops the content of the buffer and frees it.
+     */
+    void Clear();
+
+private:
+    Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
+    uint32_t mReadOffset = 0;
+    uint32_t mLength     = 0;
+    bool mIsListEnd      = false;
+    AttributeValueEncoder::AttributeEncodeState mNextState;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
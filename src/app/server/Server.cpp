@@ -87,6 +87,13 @@ public:
     }
 } sDeviceTypeResolver;
 
+void FlushAttributesOnCommissioningComplete(const chip::DeviceLayer::ChipDeviceEvent * event, intptr_t arg)
+{
+    // The fail-safe is committed: the attribute changes made while it was armed must not be lost.
+    VerifyOrReturn(event->Type == chip::DeviceLayer::DeviceEventType::kCommissioningComplete);
+    reinterpret_cast<chip::app::DeferredAttributePersistenceProvider *>(arg)->Flush();
+}
+
 } // namespace
 
 namespace chip {
@@ -127,9 +134,10 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     // Initialize PersistentStorageDelegate-based storage
     mDeviceStorage            = initParams.persistentStorageDelegate;
-    mSessionResumptionStorage = initParams.sessionResumptionStorage;
-    mOperationalKeystore      = initParams.operationalKeystore;
-    mOpCertStore              = initParams.opCertStore;
+    mSessionResumptionStorage      = initParams.sessionResumptionStorage;
+    mSubscriptionResumptionStorage = initParams.subscriptionResumptionStorage;
+    mOperationalKeystore           = initParams.operationalKeystore;
+    mOpCertStore                   = initParams.opCertStore;
 
     mCertificateValidityPolicy = initParams.certificateValidityPolicy;
 
@@ -144,7 +152,11 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // Set up attribute persistence before we try to bring up the data model
     // handler.
     SuccessOrExit(mAttributePersister.Init(mDeviceStorage));
-    SetAttributePersistenceProvider(&mAttributePersister);
+    SuccessOrExit(mDeferredAttributePersister.Init(&DeviceLayer::SystemLayer(),
+                                                   System::Clock::Milliseconds32(CHIP_CONFIG_DEFERRED_ATTRIBUTE_WRITE_WINDOW_MS)));
+    SuccessOrExit(PlatformMgr().AddEventHandler(FlushAttributesOnCommissioningComplete,
+                                                reinterpret_cast<intptr_t>(&mDeferredAttributePersister)));
+    SetAttributePersistenceProvider(&mDeferredAttributePersister);
 
     {
         FabricTable::InitParams fabricTableInitParams;
@@ -304,7 +316,8 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
                                                     mCertificateValidityPolicy, mGroupsProvider);
     SuccessOrExit(err);
 
-    err = chip::app::InteractionModelEngine::GetInstance()->Init(&mExchangeMgr, &GetFabricTable(), &mCASESessionManager);
+    err = chip::app::InteractionModelEngine::GetInstance()->Init(&mExchangeMgr, &GetFabricTable(), &mCASESessionManager,
+                                                                 mSubscriptionResumptionStorage);
     SuccessOrExit(err);
 
     // This code is necessary to restart listening to existing groups after a reboot
@@ -351,12 +364,27 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         }
     }
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    if (mSubscriptionResumptionStorage != nullptr)
+    {
+        // Failing to resume the subscriptions only delays them until the subscribers notice and re-subscribe.
+        CHIP_ERROR resumeErr = chip::app::InteractionModelEngine::GetInstance()->ResumeSubscriptions();
+        if (resumeErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Failed to resume subscriptions: %" CHIP_ERROR_FORMAT, resumeErr.Format());
+        }
+    }
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
     PlatformMgr().HandleServerStarted();
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(AppServer, "ERROR setting up transport: %" CHIP_ERROR_FORMAT, err.Format());
+        // Don't leave the handler registered on a server that failed to initialize.
+        PlatformMgr().RemoveEventHandler(FlushAttributesOnCommissioningComplete,
+                                         reinterpret_cast<intptr_t>(&mDeferredAttributePersister));
     }
     else
     {
@@ -431,6 +459,9 @@ void Server::Shutdown()
     mTransports.Close();
     mAccessControl.Finish();
     Credentials::SetGroupDataProvider(nullptr);
+    PlatformMgr().RemoveEventHandler(FlushAttributesOnCommissioningComplete,
+                                     reinterpret_cast<intptr_t>(&mDeferredAttributePersister));
+    mDeferredAttributePersister.Shutdown();
     mAttributePersister.Shutdown();
     // TODO(16969): Remove chip::Platform::MemoryInit() call from Server class, it belongs to outer code
     chip::Platform::MemoryShutdown();
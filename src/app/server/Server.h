@@ -24,8 +24,13 @@
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/DefaultAttributePersistenceProvider.h>
+#include <app/DeferredAttributePersistenceProvider.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+#include <app/SimpleSubscriptionResumptionStorage.h>
+#endif
+#include <app/SubscriptionResumptionStorage.h>
 #include <app/TestEventTriggerDelegate.h>
 #include <app/server/AclStorage.h>
 #include <app/server/AppDelegate.h>
@@ -105,6 +110,9 @@ struct ServerInitParams
     // Session resumption storage: Optional. Support session resumption when provided.
     // Must be initialized before being provided.
     SessionResumptionStorage * sessionResumptionStorage = nullptr;
+    // Subscription resumption storage: Optional. Support subscription resumption when provided.
+    // Must be initialized before being provided.
+    app::SubscriptionResumptionStorage * subscriptionResumptionStorage = nullptr;
     // Certificate validity policy: Optional. If none is injected, CHIPCert
     // enforces a default policy.
     Credentials::CertificateValidityPolicy * certificateValidityPolicy = nullptr;
@@ -220,6 +228,9 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
 
 #if CHIP_CONFIG_ENABLE_SESSION_RESUMPTION
         static chip::SimpleSessionResumptionStorage sSessionResumptionStorage;
+#endif
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+        static chip::app::SimpleSubscriptionResumptionStorage sSubscriptionResumptionStorage;
 #endif
         static chip::app::DefaultAclStorage sAclStorage;
 
@@ -263,6 +274,13 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
         this->sessionResumptionStorage = nullptr;
 #endif
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+        ReturnErrorOnFailure(sSubscriptionResumptionStorage.Init(this->persistentStorageDelegate));
+        this->subscriptionResumptionStorage = &sSubscriptionResumptionStorage;
+#else
+        this->subscriptionResumptionStorage = nullptr;
+#endif
+
         // Inject access control delegate
         this->accessDelegate = Access::Examples::GetAccessControlDelegate();
 
@@ -504,9 +522,12 @@ private:
 
     PersistentStorageDelegate * mDeviceStorage;
     SessionResumptionStorage * mSessionResumptionStorage;
+    app::SubscriptionResumptionStorage * mSubscriptionResumptionStorage;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy;
     Credentials::GroupDataProvider * mGroupsProvider;
     app::DefaultAttributePersistenceProvider mAttributePersister;
+    // Coalesces the writes of mAttributePersister, see CHIP_CONFIG_DEFERRED_ATTRIBUTE_WRITE_WINDOW_MS.
+    app::DeferredAttributePersistenceProvider mDeferredAttributePersister{ mAttributePersister };
     GroupDataProviderListener mListener;
     ServerFabricDelegate mFabricDelegate;
 
@@ -599,10 +599,52 @@ void TestBufferedSequences(nlTestSuite * apSuite, void * apContext)
     });
 }
 
+void TestListArenaReuse(nlTestSuite * apSuite, void * apContext)
+{
+    std::vector<ValidationInstruction> instructionList = {
+        { ValidationInstruction::kListAttributeC_NotEmpty_Chunked },
+        { ValidationInstruction::kListAttributeD_NotEmpty_Chunked },
+    };
+
+    DataSeriesValidator validator(instructionList);
+    BufferedReadCallback bufferedCallback(validator);
+    DataSeriesGenerator generator(bufferedCallback, instructionList);
+
+    NL_TEST_ASSERT(apSuite, bufferedCallback.GetListArenaCapacity() == 0);
+
+    generator.Generate();
+    NL_TEST_ASSERT(apSuite, validator.mCurrentInstruction == instructionList.size());
+
+    size_t capacity      = bufferedCallback.GetListArenaCapacity();
+    size_t highWaterMark = bufferedCallback.GetListArenaHighWaterMark();
+    NL_TEST_ASSERT(apSuite, highWaterMark > 0);
+    NL_TEST_ASSERT(apSuite, capacity >= highWaterMark);
+
+    //
+    // A second report of the same shape is reassembled in the arena allocated for the first one.
+    //
+    generator.Generate();
+    NL_TEST_ASSERT(apSuite, validator.mCurrentInstruction == instructionList.size());
+    NL_TEST_ASSERT(apSuite, bufferedCallback.GetListArenaCapacity() == capacity);
+    NL_TEST_ASSERT(apSuite, bufferedCallback.GetListArenaHighWaterMark() == highWaterMark);
+
+    bufferedCallback.ReleaseListArena();
+    NL_TEST_ASSERT(apSuite, bufferedCallback.GetListArenaCapacity() == 0);
+
+    //
+    // An error ending the interaction frees the arena.
+    //
+    generator.Generate();
+    NL_TEST_ASSERT(apSuite, bufferedCallback.GetListArenaCapacity() > 0);
+    static_cast<ReadClient::Callback &>(bufferedCallback).OnError(CHIP_ERROR_TIMEOUT);
+    NL_TEST_ASSERT(apSuite, bufferedCallback.GetListArenaCapacity() == 0);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestBufferedSequences", TestBufferedSequences),
+    NL_TEST_DEF("TestListArenaReuse", TestListArenaReuse),
     NL_TEST_SENTINEL()
 };
 
@@ -617,10 +617,67 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class ScalarValueCacheCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+/*
+ * This validates that decoded scalar values cached by the typed Get() are dropped when new data or status is received.
+ */
+void TestScalarValueCaching(nlTestSuite * apSuite, void * apContext)
+{
+    ScalarValueCacheCallback callback;
+    ForwardedDataCallbackValidator dataCallbackValidator;
+    ClusterStateCache cache(callback);
+    ConcreteAttributePath path(1, Clusters::TestCluster::Id, Clusters::TestCluster::Attributes::Int16u::Id);
+    Clusters::TestCluster::Attributes::Int16u::TypeInfo::DecodableType value = 0;
+
+    cache.SetScalarValueCachingEnabled(true);
+
+    AttributeInstructionListType firstReport = { AttributeInstruction(AttributeInstruction::kAttributeA, 1,
+                                                                      AttributeInstruction::kData) };
+    DataSeriesGenerator(&cache.GetBufferedCallback(), firstReport).Generate(dataCallbackValidator);
+
+    // Decoded from the TLV, then from the cached value.
+    for (int i = 0; i < 2; i++)
+    {
+        NL_TEST_ASSERT(apSuite, cache.Get<Clusters::TestCluster::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, value == firstReport[0].mInstructionId);
+    }
+
+    AttributeInstructionListType secondReport = { AttributeInstruction(AttributeInstruction::kAttributeA, 1,
+                                                                       AttributeInstruction::kData) };
+    DataSeriesGenerator(&cache.GetBufferedCallback(), secondReport).Generate(dataCallbackValidator);
+
+    NL_TEST_ASSERT(apSuite, cache.Get<Clusters::TestCluster::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == secondReport[0].mInstructionId);
+
+    AttributeInstructionListType statusReport = { AttributeInstruction(AttributeInstruction::kAttributeA, 1,
+                                                                       AttributeInstruction::kStatus) };
+    DataSeriesGenerator(&cache.GetBufferedCallback(), statusReport).Generate(dataCallbackValidator);
+
+    NL_TEST_ASSERT(apSuite,
+                   cache.Get<Clusters::TestCluster::Attributes::Int16u::TypeInfo>(path, value) ==
+                       CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+
+    // Non-scalar attributes are still decoded from the TLV.
+    AttributeInstructionListType structReport = { AttributeInstruction(AttributeInstruction::kAttributeC, 1,
+                                                                       AttributeInstruction::kData) };
+    DataSeriesGenerator(&cache.GetBufferedCallback(), structReport).Generate(dataCallbackValidator);
+
+    Clusters::TestCluster::Attributes::StructAttr::TypeInfo::DecodableType structValue;
+    path.mAttributeId = Clusters::TestCluster::Attributes::StructAttr::Id;
+    NL_TEST_ASSERT(apSuite,
+                   cache.Get<Clusters::TestCluster::Attributes::StructAttr::TypeInfo>(path, structValue) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, structValue.a == structReport[0].mInstructionId);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestScalarValueCaching", TestScalarValueCaching),
     NL_TEST_SENTINEL()
 };
 
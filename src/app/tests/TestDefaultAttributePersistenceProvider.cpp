@@ -0,0 +1,222 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <app/DefaultAttributePersistenceProvider.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Counts the values looked up and stored.
+class CountingStorage : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        mGetCount++;
+        return TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mSetCount++;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    unsigned mGetCount = 0;
+    unsigned mSetCount = 0;
+};
+
+const EmberAfAttributeMetadata kUint8Metadata = {
+    0, ZCL_INT8U_ATTRIBUTE_TYPE, 1, ATTRIBUTE_MASK_NONVOLATILE, EmberAfDefaultOrMinMaxAttributeValue(uint32_t(0))
+};
+
+CHIP_ERROR WriteUint8(AttributePersistenceProvider & provider, const ConcreteAttributePath & path, uint8_t value)
+{
+    return provider.WriteValue(path, &kUint8Metadata, ByteSpan(&value, sizeof(value)));
+}
+
+CHIP_ERROR ReadUint8(AttributePersistenceProvider & provider, const ConcreteAttributePath & path, uint8_t & value)
+{
+    MutableByteSpan span(&value, sizeof(value));
+    return provider.ReadValue(path, &kUint8Metadata, span);
+}
+
+// Loads the given attributes of an endpoint as its initialization would, and returns how many values were looked up.
+unsigned BulkRead(DefaultAttributePersistenceProvider & provider, CountingStorage & storage, EndpointId endpoint,
+                  AttributeId attributeCount)
+{
+    unsigned getCount = storage.mGetCount;
+    provider.StartBulkRead(endpoint);
+    for (AttributeId attribute = 0; attribute < attributeCount; attribute++)
+    {
+        uint8_t value;
+        ReadUint8(provider, ConcreteAttributePath(endpoint, 0x0008, attribute), value);
+    }
+    provider.EndBulkRead();
+    return storage.mGetCount - getCount;
+}
+
+void TestBulkReadSkipsUnstoredValues(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage storage;
+    DefaultAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(&storage) == CHIP_NO_ERROR);
+
+    const ConcreteAttributePath storedPath(1, 0x0008, 2);
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, storedPath, 42) == CHIP_NO_ERROR);
+
+    // Without an index, every value is looked up, and the index is built.  The write looked the index up already.
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, 10) == 10);
+
+    // With it, only the stored value is.
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, 10) == 1);
+
+    provider.StartBulkRead(1);
+    uint8_t value = 0;
+    NL_TEST_ASSERT(inSuite, ReadUint8(provider, storedPath, value) == CHIP_NO_ERROR && value == 42);
+    NL_TEST_ASSERT(inSuite,
+                   ReadUint8(provider, ConcreteAttributePath(1, 0x0008, 3), value) ==
+                       CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    provider.EndBulkRead();
+
+    // Values stored later are added to the index.
+    const ConcreteAttributePath newPath(1, 0x0008, 5);
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, newPath, 7) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, 10) == 2);
+
+    provider.StartBulkRead(1);
+    NL_TEST_ASSERT(inSuite, ReadUint8(provider, newPath, value) == CHIP_NO_ERROR && value == 7);
+    provider.EndBulkRead();
+
+    // Reads outside of a bulk read are not affected by the index.
+    NL_TEST_ASSERT(inSuite, ReadUint8(provider, storedPath, value) == CHIP_NO_ERROR && value == 42);
+
+    // After a restart, the index is looked up again.
+    provider.Shutdown();
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, 10) == 1 + 2);
+    provider.Shutdown();
+}
+
+void TestWritesTouchIndexOnce(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage storage;
+    DefaultAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(&storage) == CHIP_NO_ERROR);
+
+    // Build an empty index.
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, 10) == 1 + 10);
+
+    // Writing a value for the first time stores it and the index, without looking anything up.
+    const ConcreteAttributePath path(1, 0x0008, 2);
+    unsigned getCount = storage.mGetCount;
+    unsigned setCount = storage.mSetCount;
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, path, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.mGetCount == getCount && storage.mSetCount == setCount + 2);
+
+    // Writing it again only stores it.
+    for (uint8_t value = 2; value < 6; value++)
+    {
+        setCount = storage.mSetCount;
+        NL_TEST_ASSERT(inSuite, WriteUint8(provider, path, value) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, storage.mGetCount == getCount && storage.mSetCount == setCount + 1);
+    }
+
+    // After a restart, the first write looks the index up, and the next ones do not.
+    provider.Shutdown();
+    setCount = storage.mSetCount;
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, path, 6) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, path, 7) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.mGetCount == getCount + 1 && storage.mSetCount == setCount + 2);
+
+    // So do writes to an endpoint without an index, which are not listed.
+    getCount = storage.mGetCount;
+    setCount = storage.mSetCount;
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, ConcreteAttributePath(2, 0x0008, 2), 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WriteUint8(provider, ConcreteAttributePath(2, 0x0008, 3), 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.mGetCount == getCount + 1 && storage.mSetCount == setCount + 2);
+
+    uint8_t value = 0;
+    provider.StartBulkRead(1);
+    NL_TEST_ASSERT(inSuite, ReadUint8(provider, path, value) == CHIP_NO_ERROR && value == 7);
+    provider.EndBulkRead();
+    provider.Shutdown();
+}
+
+void TestFullIndex(nlTestSuite * inSuite, void * inContext)
+{
+    CountingStorage storage;
+    DefaultAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(&storage) == CHIP_NO_ERROR);
+
+    // Build an empty index, then store one more value than it can list.
+    constexpr AttributeId kAttributeCount = CHIP_CONFIG_PERSISTED_ATTRIBUTE_INDEX_MAX_ENTRIES + 1;
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, kAttributeCount) == 1 + kAttributeCount);
+    NL_TEST_ASSERT(inSuite, storage.HasKey(DefaultStorageKeyAllocator().AttributeValueIndex(1)));
+    for (AttributeId attribute = 0; attribute < kAttributeCount; attribute++)
+    {
+        NL_TEST_ASSERT(inSuite, WriteUint8(provider, ConcreteAttributePath(1, 0x0008, attribute), 1) == CHIP_NO_ERROR);
+    }
+
+    // The endpoint has no index anymore: every value is looked up, and found.
+    NL_TEST_ASSERT(inSuite, !storage.HasKey(DefaultStorageKeyAllocator().AttributeValueIndex(1)));
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, kAttributeCount) == kAttributeCount);
+    NL_TEST_ASSERT(inSuite, BulkRead(provider, storage, 1, kAttributeCount) == kAttributeCount);
+
+    provider.StartBulkRead(1);
+    uint8_t value = 0;
+    NL_TEST_ASSERT(inSuite,
+                   ReadUint8(provider, ConcreteAttributePath(1, 0x0008, kAttributeCount - 1), value) == CHIP_NO_ERROR &&
+                       value == 1);
+    provider.EndBulkRead();
+    provider.Shutdown();
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test bulk read skips unstored values", TestBulkReadSkipsUnstoredValues),
+                          NL_TEST_DEF("Test writes touch the index once", TestWritesTouchIndexOnce),
+                          NL_TEST_DEF("Test full index", TestFullIndex), NL_TEST_SENTINEL() };
+
+int TestSetup(void * inContext)
+{
+    return (Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestDefaultAttributePersistenceProvider()
+{
+    nlTestSuite theSuite = { "Default attribute persistence provider tests", &sTests[0], TestSetup, TestTeardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDefaultAttributePersistenceProvider)
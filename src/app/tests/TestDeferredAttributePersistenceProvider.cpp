@@ -0,0 +1,162 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/DeferredAttributePersistenceProvider.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using TestContext = chip::Test::AppContext;
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Remembers the last value written for a single attribute, and counts the writes.
+class CountingPersister : public AttributePersistenceProvider
+{
+public:
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                          const ByteSpan & aValue) override
+    {
+        mWriteCount++;
+        mPath = aPath;
+        memcpy(mValue, aValue.data(), aValue.size());
+        mValueSize = aValue.size();
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override
+    {
+        VerifyOrReturnError(mWriteCount > 0 && aPath == mPath, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return CopySpanToMutableSpan(ByteSpan(mValue, mValueSize), aValue);
+    }
+
+    unsigned mWriteCount = 0;
+    ConcreteAttributePath mPath;
+    uint8_t mValue[8];
+    size_t mValueSize = 0;
+};
+
+const ConcreteAttributePath kCurrentLevelPath(1, 0x0008, 0x0000);
+
+CHIP_ERROR WriteLevel(AttributePersistenceProvider & provider, const ConcreteAttributePath & path, uint8_t level)
+{
+    return provider.WriteValue(path, nullptr, ByteSpan(&level, sizeof(level)));
+}
+
+void TestCoalescing(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CountingPersister persister;
+    DeferredAttributePersistenceProvider provider(persister);
+    NL_TEST_ASSERT(apSuite, provider.Init(&ctx.GetSystemLayer(), System::Clock::Milliseconds32(50)) == CHIP_NO_ERROR);
+
+    for (uint8_t level = 1; level <= 20; level++)
+    {
+        NL_TEST_ASSERT(apSuite, WriteLevel(provider, kCurrentLevelPath, level) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 0);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 1);
+
+    // Reads see the held value.
+    uint8_t buffer[1];
+    MutableByteSpan value(buffer);
+    NL_TEST_ASSERT(apSuite, provider.ReadValue(kCurrentLevelPath, nullptr, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value.size() == 1 && buffer[0] == 20);
+
+    // The end of the write window writes the last value only.
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(1), [&]() { return persister.mWriteCount > 0; });
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 1);
+    NL_TEST_ASSERT(apSuite, persister.mValueSize == 1 && persister.mValue[0] == 20);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+
+    provider.Shutdown();
+}
+
+void TestFlush(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CountingPersister persister;
+    DeferredAttributePersistenceProvider provider(persister);
+    NL_TEST_ASSERT(apSuite, provider.Init(&ctx.GetSystemLayer(), System::Clock::Milliseconds32(60000)) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, kCurrentLevelPath, 7) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 1 && persister.mValue[0] == 7);
+
+    // Nothing is left to write on shutdown but the new value.
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, kCurrentLevelPath, 8) == CHIP_NO_ERROR);
+    provider.Shutdown();
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 2 && persister.mValue[0] == 8);
+
+    // Once shut down, writes are written through.
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, kCurrentLevelPath, 9) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 3 && persister.mValue[0] == 9);
+}
+
+void TestWriteThroughWhenFull(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CountingPersister persister;
+    DeferredAttributePersistenceProvider provider(persister);
+    NL_TEST_ASSERT(apSuite, provider.Init(&ctx.GetSystemLayer(), System::Clock::Milliseconds32(60000)) == CHIP_NO_ERROR);
+
+    for (EndpointId endpoint = 0; endpoint < DeferredAttributePersistenceProvider::kMaxPendingWrites; endpoint++)
+    {
+        NL_TEST_ASSERT(apSuite, WriteLevel(provider, ConcreteAttributePath(endpoint, 0x0008, 0x0000), 1) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 0);
+
+    const ConcreteAttributePath extraPath(DeferredAttributePersistenceProvider::kMaxPendingWrites, 0x0008, 0x0000);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, extraPath, 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 1 && persister.mPath == extraPath);
+
+    provider.Shutdown();
+    NL_TEST_ASSERT(apSuite, persister.mWriteCount == 1 + DeferredAttributePersistenceProvider::kMaxPendingWrites);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestCoalescing", TestCoalescing), NL_TEST_DEF("TestFlush", TestFlush),
+                          NL_TEST_DEF("TestWriteThroughWhenFull", TestWriteThroughWhenFull), NL_TEST_SENTINEL() };
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestDeferredAttributePersistenceProvider",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestDeferredAttributePersistenceProvider()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeferredAttributePersistenceProvider)
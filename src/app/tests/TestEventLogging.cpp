@@ -27,7 +27,9 @@
 #include <app/EventLoggingTypes.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
 #include <app/ObjectList.h>
+#include <app/PersistentEventLog.h>
 #include <app/tests/AppTestContext.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
@@ -52,6 +54,7 @@ static const chip::ClusterId kLivenessClusterId   = 0x00000022;
 static const uint32_t kLivenessChangeEvent        = 1;
 static const chip::EndpointId kTestEndpointId1    = 2;
 static const chip::EndpointId kTestEndpointId2    = 3;
+static const chip::EndpointId kTestEndpointId3    = 4;
 static const chip::TLV::Tag kLivenessDeviceStatus = chip::TLV::ContextTag(1);
 
 static uint8_t gDebugEventBuffer[128];
@@ -311,12 +314,206 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+class TestPersistentEventLog : public chip::app::PersistentEventLog
+{
+public:
+    CHIP_ERROR AppendEvictedEvent(chip::EventNumber aEventNumber, const chip::TLV::TLVReader & aReader) override
+    {
+        chip::app::EventReportIB::Parser report;
+        chip::app::EventDataIB::Parser eventData;
+        uint8_t priority;
+        ReturnErrorOnFailure(report.Init(aReader));
+        ReturnErrorOnFailure(report.GetEventData(&eventData));
+        ReturnErrorOnFailure(eventData.GetPriority(&priority));
+        VerifyOrReturnError(mEventCount < ArraySize(mEvents) && priority < ArraySize(mPriorityCounts), CHIP_ERROR_NO_MEMORY);
+
+        chip::TLV::TLVReader reader;
+        chip::TLV::TLVWriter writer;
+        reader.Init(aReader);
+        writer.Init(&mBuffer[mLength], sizeof(mBuffer) - mLength);
+        ReturnErrorOnFailure(writer.CopyElement(reader));
+        ReturnErrorOnFailure(writer.Finalize());
+
+        if (mEventCount > 0 && aEventNumber < mEvents[mEventCount - 1].mEventNumber)
+        {
+            mOutOfOrderCount++;
+        }
+        mEvents[mEventCount++] = { aEventNumber, mLength, writer.GetLengthWritten() };
+        mLength += writer.GetLengthWritten();
+        mPriorityCounts[priority]++;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextEvent(chip::EventNumber aEventMin, chip::EventNumber & aEventNumber, chip::ByteSpan & aEncodedEvent) override
+    {
+        const Event * next = nullptr;
+        for (size_t i = 0; i < mEventCount; i++)
+        {
+            if (mEvents[i].mEventNumber >= aEventMin && (next == nullptr || mEvents[i].mEventNumber < next->mEventNumber))
+            {
+                next = &mEvents[i];
+            }
+        }
+        VerifyOrReturnError(next != nullptr, CHIP_ERROR_NOT_FOUND);
+
+        aEventNumber  = next->mEventNumber;
+        aEncodedEvent = chip::ByteSpan(&mBuffer[next->mOffset], next->mLength);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR FabricRemoved(chip::FabricIndex aFabricIndex) override { return CHIP_NO_ERROR; }
+
+    size_t GetEventCount() const { return mEventCount; }
+    size_t GetEventCount(chip::app::PriorityLevel aPriority) const { return mPriorityCounts[static_cast<uint8_t>(aPriority)]; }
+    // Number of events appended with a lower event number than the event appended before them.
+    size_t GetOutOfOrderCount() const { return mOutOfOrderCount; }
+
+private:
+    struct Event
+    {
+        chip::EventNumber mEventNumber;
+        size_t mOffset;
+        size_t mLength;
+    };
+
+    uint8_t mBuffer[4096];
+    Event mEvents[64];
+    size_t mLength                            = 0;
+    size_t mEventCount                        = 0;
+    size_t mOutOfOrderCount                   = 0;
+    size_t mPriorityCounts[kNumPriorityLevel] = {};
+};
+
+static void CheckLogEventWithPersistentTier(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid1, eid2, eid3, eid4, eid5;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Debug;
+    TestEventGenerator testEventGenerator;
+    TestPersistentEventLog persistentEventLog;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    logMgmt.SetPersistentEventLog(&persistentEventLog);
+
+    // The debug buffer is full of debug events, so every new debug event pushes the oldest one to the persistent tier
+    // instead of dropping it.
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(1);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid2);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid3);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(1);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid4);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid5);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
+    NL_TEST_ASSERT(apSuite, persistentEventLog.GetEventCount() == 5);
+
+    chip::app::ObjectList<chip::app::EventPathParams> paths;
+    paths.mValue.mEndpointId = kTestEndpointId1;
+    paths.mValue.mClusterId  = kLivenessClusterId;
+
+    // eid1 and eid2 only exist in the persistent tier, eid3 to eid5 are still in RAM.
+    CheckLogReadOut(apSuite, logMgmt, eid1, 5, &paths);
+    CheckLogReadOut(apSuite, logMgmt, eid2, 4, &paths);
+    CheckLogReadOut(apSuite, logMgmt, eid4, 2, &paths);
+
+    logMgmt.SetPersistentEventLog(nullptr);
+}
+
+static void CheckLogEventWithPersistentTierAndMixedPriorities(nlTestSuite * apSuite, void * apContext)
+{
+    // Each event goes to the persistent tier when it leaves the buffer of its own priority, so interleaving priorities
+    // persists Debug events before the Info and Critical events logged before them.
+    const chip::app::PriorityLevel kPriorities[] = { chip::app::PriorityLevel::Critical, chip::app::PriorityLevel::Debug,
+                                                     chip::app::PriorityLevel::Info,     chip::app::PriorityLevel::Debug,
+                                                     chip::app::PriorityLevel::Debug,    chip::app::PriorityLevel::Info };
+    constexpr size_t kEventCount = 36;
+    // Fits one or two events, so that the events are fetched over many chunks.
+    constexpr size_t kChunkSize = 100;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eventNumbers[kEventCount];
+    chip::app::EventOptions options;
+    options.mPath = { kTestEndpointId3, kLivenessClusterId, kLivenessChangeEvent };
+    TestEventGenerator testEventGenerator;
+    TestPersistentEventLog persistentEventLog;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    logMgmt.SetPersistentEventLog(&persistentEventLog);
+
+    for (size_t i = 0; i < kEventCount; i++)
+    {
+        options.mPriority = kPriorities[i % ArraySize(kPriorities)];
+        testEventGenerator.SetStatus(static_cast<int32_t>(i));
+        err = logMgmt.LogEvent(&testEventGenerator, options, eventNumbers[i]);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    // Every buffer overflowed into the persistent tier, out of event number order.
+    NL_TEST_ASSERT(apSuite, persistentEventLog.GetEventCount(chip::app::PriorityLevel::Debug) > 0);
+    NL_TEST_ASSERT(apSuite, persistentEventLog.GetEventCount(chip::app::PriorityLevel::Info) > 0);
+    NL_TEST_ASSERT(apSuite, persistentEventLog.GetEventCount(chip::app::PriorityLevel::Critical) > 0);
+    NL_TEST_ASSERT(apSuite, persistentEventLog.GetOutOfOrderCount() > 0);
+
+    chip::app::ObjectList<chip::app::EventPathParams> paths;
+    paths.mValue.mEndpointId = kTestEndpointId3;
+    paths.mValue.mClusterId  = kLivenessClusterId;
+
+    // Resume each chunk where the previous one stopped, as a report does: every event, wherever it is stored, comes out
+    // exactly once and in event number order, so none of the persisted events was lost.
+    chip::EventNumber eventMin = eventNumbers[0];
+    size_t fetchedCount        = 0;
+    bool done                  = false;
+    for (size_t chunk = 0; !done && chunk < 2 * kEventCount; chunk++)
+    {
+        uint8_t backingStore[kChunkSize];
+        chip::TLV::TLVWriter writer;
+        chip::TLV::TLVReader reader;
+        size_t eventCount = 0;
+
+        writer.Init(backingStore, sizeof(backingStore));
+        err = logMgmt.FetchEventsSince(writer, &paths, eventMin, eventCount, chip::Access::SubjectDescriptor{});
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        done = (err == CHIP_NO_ERROR);
+
+        reader.Init(backingStore, writer.GetLengthWritten());
+        while (reader.Next() == CHIP_NO_ERROR)
+        {
+            chip::app::EventReportIB::Parser report;
+            chip::app::EventDataIB::Parser eventData;
+            chip::EventNumber eventNumber = 0;
+            NL_TEST_ASSERT(apSuite, report.Init(reader) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, report.GetEventData(&eventData) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, eventData.GetEventNumber(&eventNumber) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, fetchedCount < kEventCount && eventNumber == eventNumbers[fetchedCount]);
+            fetchedCount++;
+        }
+    }
+    NL_TEST_ASSERT(apSuite, done && fetchedCount == kEventCount);
+
+    logMgmt.SetPersistentEventLog(nullptr);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckLogEventWithPersistentTier", CheckLogEventWithPersistentTier),
+                          NL_TEST_DEF("CheckLogEventWithPersistentTierAndMixedPriorities",
+                                      CheckLogEventWithPersistentTierAndMixedPriorities),
+                          NL_TEST_SENTINEL() };
 
 // clang-format off
 nlTestSuite sSuite =
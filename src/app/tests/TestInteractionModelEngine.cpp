@@ -48,6 +48,7 @@ class TestInteractionModelEngine
 public:
     static void TestAttributePathParamsPushRelease(nlTestSuite * apSuite, void * apContext);
     static void TestRemoveDuplicateConcreteAttribute(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerDispatch(nlTestSuite * apSuite, void * apContext);
     static int GetAttributePathListLength(ObjectList<AttributePathParams> * apattributePathParamsList);
 };
 
@@ -223,6 +224,75 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 }
 
+namespace {
+class TestCommandHandler : public CommandHandlerInterface
+{
+public:
+    TestCommandHandler(Optional<EndpointId> aEndpointId, ClusterId aClusterId) : CommandHandlerInterface(aEndpointId, aClusterId) {}
+    void InvokeCommand(HandlerContext & handlerContext) override {}
+};
+} // namespace
+
+void TestInteractionModelEngine::TestCommandHandlerDispatch(nlTestSuite * apSuite, void * apContext)
+{
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    // Enough handlers for several of them to share each bucket of the dispatch table.
+    constexpr EndpointId kEndpointCount = 4 * CHIP_IM_INTERFACE_DISPATCH_TABLE_SIZE;
+    constexpr ClusterId kClusterId      = 6;
+    constexpr ClusterId kOtherClusterId = 8;
+
+    TestCommandHandler * handlers[kEndpointCount];
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        handlers[endpoint] = new TestCommandHandler(MakeOptional(endpoint), kClusterId);
+        NL_TEST_ASSERT(apSuite, engine->RegisterCommandHandler(handlers[endpoint]) == CHIP_NO_ERROR);
+    }
+    TestCommandHandler wildcardHandler(NullOptional, kOtherClusterId);
+    NL_TEST_ASSERT(apSuite, engine->RegisterCommandHandler(&wildcardHandler) == CHIP_NO_ERROR);
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(endpoint, kClusterId) == handlers[endpoint]);
+        NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(endpoint, kOtherClusterId) == &wildcardHandler);
+    }
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(kEndpointCount, kClusterId) == nullptr);
+
+    // Overlapping registrations are refused.
+    TestCommandHandler duplicateHandler(MakeOptional(EndpointId(1)), kClusterId);
+    TestCommandHandler duplicateWildcardHandler(NullOptional, kClusterId);
+    TestCommandHandler overlappedHandler(MakeOptional(EndpointId(1)), kOtherClusterId);
+    NL_TEST_ASSERT(apSuite, engine->RegisterCommandHandler(&duplicateHandler) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(apSuite, engine->RegisterCommandHandler(&duplicateWildcardHandler) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(apSuite, engine->RegisterCommandHandler(&overlappedHandler) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(apSuite, engine->UnregisterCommandHandler(handlers[1]) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(1, kClusterId) == nullptr);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(1, kOtherClusterId) == &wildcardHandler);
+
+    // Only the handlers specific to the endpoint go away with it.
+    TestCommandHandler otherClusterHandler(MakeOptional(EndpointId(2)), 0x28);
+    NL_TEST_ASSERT(apSuite, engine->RegisterCommandHandler(&otherClusterHandler) == CHIP_NO_ERROR);
+    engine->UnregisterCommandHandlers(2);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(2, kClusterId) == nullptr);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(2, 0x28) == nullptr);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(2, kOtherClusterId) == &wildcardHandler);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(3, kClusterId) == handlers[3]);
+
+    NL_TEST_ASSERT(apSuite, engine->UnregisterCommandHandler(&wildcardHandler) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(3, kOtherClusterId) == nullptr);
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        if (endpoint != 1 && endpoint != 2)
+        {
+            NL_TEST_ASSERT(apSuite, engine->UnregisterCommandHandler(handlers[endpoint]) == CHIP_NO_ERROR);
+        }
+        delete handlers[endpoint];
+    }
+    NL_TEST_ASSERT(apSuite, engine->FindCommandHandler(3, kClusterId) == nullptr);
+}
+
 } // namespace app
 } // namespace chip
 
@@ -233,6 +303,7 @@ const nlTest sTests[] =
         {
                 NL_TEST_DEF("TestAttributePathParamsPushRelease", chip::app::TestInteractionModelEngine::TestAttributePathParamsPushRelease),
                 NL_TEST_DEF("TestRemoveDuplicateConcreteAttribute", chip::app::TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute),
+                NL_TEST_DEF("TestCommandHandlerDispatch", chip::app::TestInteractionModelEngine::TestCommandHandlerDispatch),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
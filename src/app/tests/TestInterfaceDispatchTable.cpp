@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributeAccessInterface.h>
+#include <app/InterfaceDispatchTable.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#include <cinttypes>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+class TestAttributeAccess : public AttributeAccessInterface
+{
+public:
+    TestAttributeAccess() : AttributeAccessInterface(NullOptional, 0) {}
+    TestAttributeAccess(Optional<EndpointId> aEndpointId, ClusterId aClusterId) : AttributeAccessInterface(aEndpointId, aClusterId)
+    {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override { return CHIP_NO_ERROR; }
+};
+
+// A bridge: 100 endpoints with an override for each of their 5 clusters, plus overrides for all endpoints.
+constexpr EndpointId kEndpointCount           = 100;
+constexpr ClusterId kOverriddenClusters[]     = { 0x0006, 0x0008, 0x0039, 0x0300, 0x0402 };
+constexpr ClusterId kAllEndpointsClusters[]   = { 0x001D, 0x0028 };
+constexpr size_t kOverrideCount               = kEndpointCount * ArraySize(kOverriddenClusters);
+constexpr ClusterId kWildcardReadClusters[]   = { 0x0003, 0x0004, 0x0005, 0x0006, 0x0008, 0x001D,
+                                                  0x0028, 0x0039, 0x0300, 0x0402, 0x0405, 0xFC00 };
+constexpr AttributeId kWildcardReadAttributes = 20;
+
+TestAttributeAccess gOverrides[kOverrideCount];
+TestAttributeAccess gAllEndpointsOverrides[ArraySize(kAllEndpointsClusters)];
+
+// The lookup the dispatch table replaced: walk every registered override.
+AttributeAccessInterface * FindInList(AttributeAccessInterface * aList, EndpointId aEndpointId, ClusterId aClusterId)
+{
+    for (AttributeAccessInterface * cur = aList; cur != nullptr; cur = cur->GetNext())
+    {
+        if (cur->Matches(aEndpointId, aClusterId))
+        {
+            return cur;
+        }
+    }
+    return nullptr;
+}
+
+// Looks the override up for every attribute of a wildcard read of all the endpoints (and the root one), as the reporting
+// engine does, and returns the number of lookups.
+template <typename Lookup>
+size_t RunWildcardRead(Lookup aLookup)
+{
+    size_t lookupCount = 0;
+    for (EndpointId endpoint = 0; endpoint <= kEndpointCount; endpoint++)
+    {
+        for (ClusterId cluster : kWildcardReadClusters)
+        {
+            for (AttributeId attribute = 0; attribute < kWildcardReadAttributes; attribute++)
+            {
+                aLookup(endpoint, cluster);
+                lookupCount++;
+            }
+        }
+    }
+    return lookupCount;
+}
+
+template <typename Lookup>
+void LogWildcardReadThroughput(const char * aName, Lookup aLookup)
+{
+    constexpr int kRunCount = 20;
+    size_t lookupCount      = 0;
+
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (int run = 0; run < kRunCount; run++)
+    {
+        lookupCount += RunWildcardRead(aLookup);
+    }
+    const uint64_t elapsedUs = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+
+    ChipLogProgress(Test, "%s: %u lookups in %" PRIu64 " us, %" PRIu64 " lookups/s", aName, static_cast<unsigned>(lookupCount),
+                    elapsedUs, elapsedUs > 0 ? lookupCount * 1000000 / elapsedUs : 0);
+}
+
+void TestWildcardReadWithManyOverrides(nlTestSuite * apSuite, void * apContext)
+{
+    InterfaceDispatchTable<AttributeAccessInterface> table;
+    AttributeAccessInterface * list = nullptr;
+
+    size_t i = 0;
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        for (ClusterId cluster : kOverriddenClusters)
+        {
+            gOverrides[i] = TestAttributeAccess(MakeOptional(endpoint), cluster);
+            gOverrides[i].SetNext(list);
+            list = &gOverrides[i];
+            table.Insert(&gOverrides[i]);
+            i++;
+        }
+    }
+    for (size_t j = 0; j < ArraySize(kAllEndpointsClusters); j++)
+    {
+        gAllEndpointsOverrides[j] = TestAttributeAccess(NullOptional, kAllEndpointsClusters[j]);
+        gAllEndpointsOverrides[j].SetNext(list);
+        list = &gAllEndpointsOverrides[j];
+        table.Insert(&gAllEndpointsOverrides[j]);
+    }
+    NL_TEST_ASSERT(apSuite, i == kOverrideCount);
+
+    // The table finds the same override as the walk for every path of the wildcard read.
+    size_t mismatchCount = 0;
+    size_t foundCount    = 0;
+    RunWildcardRead([&](EndpointId aEndpointId, ClusterId aClusterId) {
+        AttributeAccessInterface * found = table.Find(aEndpointId, aClusterId);
+        mismatchCount += (found != FindInList(list, aEndpointId, aClusterId)) ? 1 : 0;
+        foundCount += (found != nullptr) ? 1 : 0;
+    });
+    NL_TEST_ASSERT(apSuite, mismatchCount == 0);
+    NL_TEST_ASSERT(apSuite, foundCount ==
+                       (kOverrideCount + (kEndpointCount + 1) * ArraySize(kAllEndpointsClusters)) * kWildcardReadAttributes);
+
+    // Not asserted, timings depend on the host: compare them in the test output.
+    volatile uintptr_t sink = 0;
+    LogWildcardReadThroughput("Registration list", [&](EndpointId aEndpointId, ClusterId aClusterId) {
+        sink = sink + reinterpret_cast<uintptr_t>(FindInList(list, aEndpointId, aClusterId));
+    });
+    LogWildcardReadThroughput("Dispatch table", [&](EndpointId aEndpointId, ClusterId aClusterId) {
+        sink = sink + reinterpret_cast<uintptr_t>(table.Find(aEndpointId, aClusterId));
+    });
+
+    table.Clear();
+}
+
+} // namespace
+
+int TestInterfaceDispatchTable()
+{
+    static nlTest sTests[] = {
+        NL_TEST_DEF("TestWildcardReadWithManyOverrides", TestWildcardReadWithManyOverrides),
+        NL_TEST_SENTINEL(),
+    };
+
+    nlTestSuite theSuite = {
+        "InterfaceDispatchTable",
+        &sTests[0],
+        nullptr,
+        nullptr,
+    };
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInterfaceDispatchTable)
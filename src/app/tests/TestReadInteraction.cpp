@@ -25,20 +25,26 @@
 #include "lib/support/CHIPMem.h"
 #include <access/examples/PermissiveAccessControlDelegate.h>
 #include <app/AttributeAccessInterface.h>
+#include <app/CASEClientPool.h>
+#include <app/CASESessionManager.h>
 #include <app/InteractionModelEngine.h>
 #include <app/InteractionModelHelper.h>
 #include <app/MessageDef/AttributeReportIBs.h>
 #include <app/MessageDef/EventDataIB.h>
+#include <app/OperationalSessionSetupPool.h>
+#include <app/SimpleSubscriptionResumptionStorage.h>
 #include <app/tests/AppTestContext.h>
 #include <app/util/basic-types.h>
 #include <app/util/mock/Constants.h>
 #include <app/util/mock/Functions.h>
+#include <credentials/GroupDataProviderImpl.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/core/CHIPTLVDebug.hpp>
 #include <lib/core/CHIPTLVUtilities.hpp>
 #include <lib/support/CHIPCounter.h>
 #include <lib/support/ErrorStr.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <messaging/ExchangeContext.h>
@@ -230,6 +236,59 @@ public:
     chip::app::ReadHandler::ApplicationCallback * GetAppCallback() override { return nullptr; }
 };
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+// The session IDs of the CASE sessions between Alice and Bob injected for the subscription resumption tests.
+constexpr uint16_t kAliceCaseKeyId = 5;
+constexpr uint16_t kBobCaseKeyId   = 6;
+
+chip::CASEClientPool<1> gCASEClientPool;
+chip::Credentials::GroupDataProviderImpl gGroupDataProvider;
+
+//
+// Fails to allocate any session setup, so that the CASESessionManager reports the failure to establish a session
+// synchronously.
+//
+class FailingSessionSetupPool : public chip::OperationalSessionSetupPoolDelegate
+{
+public:
+    chip::OperationalSessionSetup * Allocate(chip::DeviceProxyInitParams & params, chip::ScopedNodeId peerId,
+                                             chip::OperationalSessionReleaseDelegate * releaseDelegate) override
+    {
+        mAllocateCount++;
+        return nullptr;
+    }
+    void Release(chip::OperationalSessionSetup * device) override {}
+    chip::OperationalSessionSetup * FindSessionSetup(chip::ScopedNodeId peerId, bool forAddressUpdate) override { return nullptr; }
+    void ReleaseAllSessionSetupsForFabric(chip::FabricIndex fabricIndex) override {}
+    void ReleaseAllSessionSetup() override {}
+
+    int mAllocateCount = 0;
+};
+
+//
+// Sets up a CASESessionManager over the sessions of the test context. It never gets to establish CASE: the resumption
+// tests either inject the session it finds or make it fail.
+//
+CHIP_ERROR InitCASESessionManager(TestContext & ctx, chip::CASESessionManager & caseSessionManager,
+                                  chip::OperationalSessionSetupPoolDelegate & sessionSetupPool)
+{
+    chip::CASESessionManagerConfig config;
+    config.sessionInitParams.sessionManager    = &ctx.GetSecureSessionManager();
+    config.sessionInitParams.exchangeMgr       = &ctx.GetExchangeManager();
+    config.sessionInitParams.fabricTable       = &ctx.GetFabricTable();
+    config.sessionInitParams.clientPool        = &gCASEClientPool;
+    config.sessionInitParams.groupDataProvider = &gGroupDataProvider;
+    config.sessionSetupPool                    = &sessionSetupPool;
+    return caseSessionManager.Init(&ctx.GetSystemLayer(), config);
+}
+
+void ShutdownCASESessionManager(TestContext & ctx)
+{
+    // CASESessionManager::Init registered the manager for the address updates of the sessions.
+    ctx.GetExchangeManager().GetReliableMessageMgr()->RegisterSessionUpdateDelegate(nullptr);
+}
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 } // namespace
 
 namespace chip {
@@ -317,6 +376,9 @@ public:
     static void TestReadShutdown(nlTestSuite * apSuite, void * apContext);
     static void TestResubscribeRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeRoundtripStatusReportTimeout(nlTestSuite * apSuite, void * apContext);
+    static void TestClientSubscriptionManagerLiveness(nlTestSuite * apSuite, void * apContext);
+    static void TestClientSubscriptionManagerResubscribeRateLimit(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeKeepAliveAlignment(nlTestSuite * apSuite, void * apContext);
     static void TestPostSubscribeRoundtripStatusReportTimeout(nlTestSuite * apSuite, void * apContext);
     static void TestReadChunkingStatusReportTimeout(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeRoundtripChunkStatusReportTimeout(nlTestSuite * apSuite, void * apContext);
@@ -339,6 +401,10 @@ public:
     static void TestSubscribeInvalidateFabric(nlTestSuite * apSuite, void * apContext);
     static void TestShutdownSubscription(nlTestSuite * apSuite, void * apContext);
     static void TestReadHandlerMalformedSubscribeRequest(nlTestSuite * apSuite, void * apContext);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    static void TestSubscriptionResumption(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscriptionResumptionFailure(nlTestSuite * apSuite, void * apContext);
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
 private:
     static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
@@ -2407,6 +2473,233 @@ void TestReadInteraction::TestPostSubscribeRoundtripStatusReportTimeout(nlTestSu
     ctx.CreateSessionBobToAlice();
 }
 
+void TestReadInteraction::TestClientSubscriptionManagerLiveness(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ClientSubscriptionManager subscriptionManager(ctx.GetSystemLayer());
+    engine->SetClientSubscriptionManager(&subscriptionManager);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 5;
+    readPrepareParams.mKeepSubscriptions           = true;
+
+    {
+        MockInteractionModelApp delegate1;
+        MockInteractionModelApp delegate2;
+        app::ReadClient readClient1(engine, &ctx.GetExchangeManager(), delegate1,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient2(engine, &ctx.GetExchangeManager(), delegate2,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+
+        NL_TEST_ASSERT(apSuite, readClient1.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, readClient2.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate1.mGotReport && delegate2.mGotReport);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 2);
+
+        // Both subscriptions go to the same peer, so their liveness is checked by one timer.
+        NL_TEST_ASSERT(apSuite, subscriptionManager.GetArmedTimerCount() == 1);
+
+        // Bring the deadline of the first subscription forward; it times out on its own.
+        readClient1.OverrideLivenessTimeout(System::Clock::Milliseconds32(50));
+        NL_TEST_ASSERT(apSuite, subscriptionManager.GetArmedTimerCount() == 1);
+
+        ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(2), [&]() { return delegate1.mReadError; });
+
+        NL_TEST_ASSERT(apSuite, delegate1.mReadError && delegate1.mError == CHIP_ERROR_TIMEOUT);
+        NL_TEST_ASSERT(apSuite, !delegate2.mReadError);
+        NL_TEST_ASSERT(apSuite, subscriptionManager.GetArmedTimerCount() == 1);
+    }
+
+    NL_TEST_ASSERT(apSuite, subscriptionManager.GetArmedTimerCount() == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+
+    engine->SetClientSubscriptionManager(nullptr);
+    engine->Shutdown();
+    ctx.DrainAndServiceIO();
+
+    // The liveness timeout marked our session defunct.
+    ctx.ExpireSessionAliceToBob();
+    ctx.ExpireSessionBobToAlice();
+    ctx.CreateSessionAliceToBob();
+    ctx.CreateSessionBobToAlice();
+}
+
+void TestReadInteraction::TestClientSubscriptionManagerResubscribeRateLimit(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                     = *static_cast<TestContext *>(apContext);
+    constexpr size_t kNumPeers            = 5;
+    constexpr size_t kClientsPerPeer      = 2;
+    constexpr size_t kNumClients          = kNumPeers * kClientsPerPeer;
+    constexpr uint32_t kMaxPeersPerSecond = 2;
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    NL_TEST_ASSERT(apSuite, engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable()) == CHIP_NO_ERROR);
+
+    // No jitter, so that rate-limited releases are deferred to the end of the window exactly.
+    ClientSubscriptionManager subscriptionManager(ctx.GetSystemLayer(), kMaxPeersPerSecond, System::Clock::Milliseconds32(0));
+    engine->SetClientSubscriptionManager(&subscriptionManager);
+
+    MockInteractionModelApp delegate;
+    app::ReadClient * pClients[kNumPeers][kClientsPerPeer];
+    for (size_t peer = 0; peer < kNumPeers; peer++)
+    {
+        ScopedNodeId peerId(static_cast<NodeId>(peer + 1), ctx.GetAliceFabricIndex());
+        for (auto *& client : pClients[peer])
+        {
+            client = Platform::New<app::ReadClient>(engine, &ctx.GetExchangeManager(), delegate,
+                                                    chip::app::ReadClient::InteractionType::Subscribe);
+            NL_TEST_ASSERT(apSuite,
+                           subscriptionManager.ScheduleResubscription(*client, peerId, System::Clock::Milliseconds32(0)) ==
+                               CHIP_NO_ERROR);
+        }
+    }
+    NL_TEST_ASSERT(apSuite, subscriptionManager.GetPendingResubscriptionCount() == kNumClients);
+
+    // Released subscriptions have no CASESessionManager to re-establish their session with, so they fail without being
+    // scheduled again. The subscriptions to a peer must all be released at once.
+    auto countReleasedPeers = [&]() {
+        size_t count = 0;
+        for (auto & peerClients : pClients)
+        {
+            bool released = peerClients[0]->mNumRetries > 0;
+            for (auto * client : peerClients)
+            {
+                NL_TEST_ASSERT(apSuite, (client->mNumRetries > 0) == released);
+            }
+            count += released ? 1 : 0;
+        }
+        return count;
+    };
+
+    // Every subscription is due, but only kMaxPeersPerSecond peers are released; the timer is re-armed for the end of
+    // the one second window.
+    subscriptionManager.HandleResubscribeTimer();
+    NL_TEST_ASSERT(apSuite, countReleasedPeers() == kMaxPeersPerSecond);
+    NL_TEST_ASSERT(apSuite,
+                   subscriptionManager.GetPendingResubscriptionCount() == kNumClients - kMaxPeersPerSecond * kClientsPerPeer);
+    NL_TEST_ASSERT(apSuite, subscriptionManager.mResubscribeTimerArmed);
+    NL_TEST_ASSERT(apSuite,
+                   subscriptionManager.mResubscribeTimerDeadline == subscriptionManager.mWindowStart + System::Clock::Seconds16(1));
+
+    // Firing again within the window releases nothing more.
+    subscriptionManager.HandleResubscribeTimer();
+    NL_TEST_ASSERT(apSuite, countReleasedPeers() == kMaxPeersPerSecond);
+    NL_TEST_ASSERT(apSuite, subscriptionManager.mResubscribeTimerArmed);
+
+    // The next window releases the next peers.
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(2), [&]() {
+        return subscriptionManager.GetPendingResubscriptionCount() < kNumClients - kMaxPeersPerSecond * kClientsPerPeer;
+    });
+    NL_TEST_ASSERT(apSuite, countReleasedPeers() == 2 * kMaxPeersPerSecond);
+    NL_TEST_ASSERT(apSuite, subscriptionManager.mResubscribeTimerArmed);
+
+    // The last one goes in the window after, which leaves nothing to re-arm the timer for.
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(2),
+                                    [&]() { return subscriptionManager.GetPendingResubscriptionCount() == 0; });
+    NL_TEST_ASSERT(apSuite, countReleasedPeers() == kNumPeers);
+    NL_TEST_ASSERT(apSuite, !subscriptionManager.mResubscribeTimerArmed);
+    NL_TEST_ASSERT(apSuite, delegate.mReadError && delegate.mError == CHIP_ERROR_INCORRECT_STATE);
+
+    for (auto & peerClients : pClients)
+    {
+        for (auto * client : peerClients)
+        {
+            Platform::Delete(client);
+        }
+    }
+
+    engine->SetClientSubscriptionManager(nullptr);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestReadInteraction::TestSubscribeKeepAliveAlignment(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    engine->SetKeepAliveAlignmentWindow(System::Clock::Seconds16(2));
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams.mKeepSubscriptions           = true;
+
+    {
+        MockInteractionModelApp delegate1;
+        MockInteractionModelApp delegate2;
+        app::ReadClient readClient1(engine, &ctx.GetExchangeManager(), delegate1,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient2(engine, &ctx.GetExchangeManager(), delegate2,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+
+        readPrepareParams.mMaxIntervalCeilingSeconds = 1;
+        NL_TEST_ASSERT(apSuite, readClient1.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+        readPrepareParams.mMaxIntervalCeilingSeconds = 3;
+        NL_TEST_ASSERT(apSuite, readClient2.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate1.mGotReport && delegate2.mGotReport);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 2);
+
+        ReadHandler * shortHandler = engine->ActiveHandlerAt(0);
+        ReadHandler * longHandler  = engine->ActiveHandlerAt(1);
+        NL_TEST_ASSERT(apSuite, shortHandler != nullptr && longHandler != nullptr);
+        if (shortHandler->mMaxInterval > longHandler->mMaxInterval)
+        {
+            std::swap(shortHandler, longHandler);
+        }
+
+        System::Clock::Timestamp shortDeadline = shortHandler->mMaxIntervalDeadline;
+        System::Clock::Timestamp longDeadline  = longHandler->mMaxIntervalDeadline;
+
+        // The keep-alive of the 1s subscription is due first; the one of the 3s subscription, due within the 2s window, goes
+        // out with it.
+        ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(2),
+                                        [&]() { return shortHandler->mMaxIntervalDeadline != shortDeadline; });
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, shortHandler->mMaxIntervalDeadline != shortDeadline);
+        // Sending the keep-alive rearms the 3s deadline from then: had it gone out at its own deadline, the next one would
+        // be 3s after that.
+        NL_TEST_ASSERT(apSuite, longHandler->mMaxIntervalDeadline != longDeadline);
+        NL_TEST_ASSERT(apSuite,
+                       longHandler->mMaxIntervalDeadline < longDeadline + System::Clock::Seconds16(longHandler->mMaxInterval));
+        NL_TEST_ASSERT(apSuite, !delegate1.mReadError && !delegate2.mReadError);
+    }
+
+    engine->SetKeepAliveAlignmentWindow(System::Clock::Seconds16(CHIP_IM_SUBSCRIPTION_KEEPALIVE_ALIGNMENT_WINDOW_SECONDS));
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 void TestReadInteraction::TestSubscribeRoundtripStatusReportTimeout(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -4101,6 +4394,157 @@ void TestReadInteraction::TestShutdownSubscription(nlTestSuite * apSuite, void *
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+void TestReadInteraction::TestSubscriptionResumption(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    chip::TestPersistentStorageDelegate persistentStorage;
+    SimpleSubscriptionResumptionStorage subscriptionStorage;
+    NL_TEST_ASSERT(apSuite, subscriptionStorage.Init(&persistentStorage) == CHIP_NO_ERROR);
+
+    OperationalSessionSetupPool<1> sessionSetupPool;
+    CASESessionManager caseSessionManager;
+    NL_TEST_ASSERT(apSuite, InitCASESessionManager(ctx, caseSessionManager, sessionSetupPool) == CHIP_NO_ERROR);
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(), &caseSessionManager, &subscriptionStorage);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 10;
+
+    SessionHolder caseSessionAliceToBob;
+    SessionHolder caseSessionBobToAlice;
+
+    {
+        MockInteractionModelApp delegate;
+        app::ReadClient readClient(engine, &ctx.GetExchangeManager(), delegate, chip::app::ReadClient::InteractionType::Subscribe);
+
+        NL_TEST_ASSERT(apSuite, readClient.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+        NL_TEST_ASSERT(apSuite, readClient.IsSubscriptionActive());
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 1);
+        NL_TEST_ASSERT(apSuite, persistentStorage.GetNumKeys() == 1);
+
+        // Restart the server: its handlers are gone without their subscriptions being closed, so these stay persisted. The
+        // engine itself is kept, since it also serves the subscriber.
+        engine->GetReadHandlerPool().ReleaseAll();
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 0);
+        NL_TEST_ASSERT(apSuite, persistentStorage.GetNumKeys() == 1);
+
+        // The CASE sessions the CASESessionManager finds, instead of establishing one.
+        SessionManager & sessionManager = ctx.GetSecureSessionManager();
+        NodeId aliceNodeId              = ctx.GetAliceFabric()->GetNodeId();
+        NodeId bobNodeId                = ctx.GetBobFabric()->GetNodeId();
+        err = sessionManager.InjectCaseSessionWithTestKey(caseSessionAliceToBob, kAliceCaseKeyId, kBobCaseKeyId, aliceNodeId,
+                                                          bobNodeId, ctx.GetAliceFabricIndex(), ctx.GetBobAddress(),
+                                                          CryptoContext::SessionRole::kResponder);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = sessionManager.InjectCaseSessionWithTestKey(caseSessionBobToAlice, kBobCaseKeyId, kAliceCaseKeyId, bobNodeId,
+                                                          aliceNodeId, ctx.GetBobFabricIndex(), ctx.GetAliceAddress(),
+                                                          CryptoContext::SessionRole::kInitiator);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
+        NL_TEST_ASSERT(apSuite, engine->ResumeSubscriptions() == CHIP_NO_ERROR);
+
+        // The session was found at once: the resumed handler is about to send its priming report.
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 1);
+        ReadHandler * handler = engine->ActiveHandlerAt(0);
+        NL_TEST_ASSERT(apSuite, handler != nullptr);
+        NL_TEST_ASSERT(apSuite, handler->IsResuming() && handler->IsPriming() && handler->IsGeneratingReports());
+        NL_TEST_ASSERT(apSuite, handler->mSubscriptionId == readClient.GetSubscriptionId().Value());
+        NL_TEST_ASSERT(apSuite, handler->GetSession() == caseSessionAliceToBob.Get().Value()->AsSecureSession());
+
+        ctx.DrainAndServiceIO();
+
+        // The subscriber took the priming report as a report of its subscription, and the status response it sent back
+        // finished the resumption.
+        NL_TEST_ASSERT(apSuite, delegate.mGotReport && delegate.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+        NL_TEST_ASSERT(apSuite, readClient.IsSubscriptionActive());
+        NL_TEST_ASSERT(apSuite, !handler->IsResuming() && !handler->IsPriming());
+        NL_TEST_ASSERT(apSuite, handler->IsActiveSubscription() && handler->IsGeneratingReports());
+        NL_TEST_ASSERT(apSuite, persistentStorage.GetNumKeys() == 1);
+    }
+
+    engine->Shutdown();
+    ShutdownCASESessionManager(ctx);
+    caseSessionAliceToBob.Get().Value()->AsSecureSession()->MarkForEviction();
+    caseSessionBobToAlice.Get().Value()->AsSecureSession()->MarkForEviction();
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestReadInteraction::TestSubscriptionResumptionFailure(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    chip::TestPersistentStorageDelegate persistentStorage;
+    SimpleSubscriptionResumptionStorage subscriptionStorage;
+    NL_TEST_ASSERT(apSuite, subscriptionStorage.Init(&persistentStorage) == CHIP_NO_ERROR);
+
+    FailingSessionSetupPool sessionSetupPool;
+    CASESessionManager caseSessionManager;
+    NL_TEST_ASSERT(apSuite, InitCASESessionManager(ctx, caseSessionManager, sessionSetupPool) == CHIP_NO_ERROR);
+
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable(), &caseSessionManager, &subscriptionStorage);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // A subscription of Bob's to Alice, persisted before Alice restarted.
+    SubscriptionInfo info;
+    info.mFabricIndex        = ctx.GetAliceFabricIndex();
+    info.mNodeId             = ctx.GetBobFabric()->GetNodeId();
+    info.mSubscriptionId     = 0x1234;
+    info.mMinInterval        = 0;
+    info.mMaxInterval        = 10;
+    info.mAttributePaths[0]  = AttributePathParams(kTestEndpointId, kTestClusterId, 1);
+    info.mAttributePathCount = 1;
+    NL_TEST_ASSERT(apSuite, subscriptionStorage.Save(info) == CHIP_NO_ERROR);
+
+    // Until its session is established, a resumed subscription is matched to its subscriber by the persisted identity.
+    {
+        NullReadHandlerCallback nullCallback;
+        ReadHandler resumingHandler(nullCallback);
+        resumingHandler.mPersistedPeer = info.GetPeer();
+        NL_TEST_ASSERT(apSuite, resumingHandler.GetSession() == nullptr);
+
+        Messaging::ExchangeContext * subscriberExchange = ctx.NewExchangeToBob(nullptr, false);
+        Messaging::ExchangeContext * otherExchange      = ctx.NewExchangeToAlice(nullptr, false);
+        NL_TEST_ASSERT(apSuite, resumingHandler.IsFromSubscriber(*subscriberExchange));
+        NL_TEST_ASSERT(apSuite, !resumingHandler.IsFromSubscriber(*otherExchange));
+        subscriberExchange->Close();
+        otherExchange->Close();
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->ResumeSubscriptions() == CHIP_NO_ERROR);
+
+    // Setting up CASE failed at once: the handler is gone, and the subscription is forgotten.
+    NL_TEST_ASSERT(apSuite, sessionSetupPool.mAllocateCount == 1);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, persistentStorage.GetNumKeys() == 0);
+
+    engine->Shutdown();
+    ShutdownCASESessionManager(ctx);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
 } // namespace app
 } // namespace chip
 
@@ -4164,6 +4608,13 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestPostSubscribeRoundtripChunkStatusReportTimeout", chip::app::TestReadInteraction::TestPostSubscribeRoundtripChunkStatusReportTimeout),
     NL_TEST_DEF("TestPostSubscribeRoundtripChunkReportTimeout", chip::app::TestReadInteraction::TestPostSubscribeRoundtripChunkReportTimeout),
     NL_TEST_DEF("TestReadShutdown", chip::app::TestReadInteraction::TestReadShutdown),
+    NL_TEST_DEF("TestClientSubscriptionManagerLiveness", chip::app::TestReadInteraction::TestClientSubscriptionManagerLiveness),
+    NL_TEST_DEF("TestClientSubscriptionManagerResubscribeRateLimit", chip::app::TestReadInteraction::TestClientSubscriptionManagerResubscribeRateLimit),
+    NL_TEST_DEF("TestSubscribeKeepAliveAlignment", chip::app::TestReadInteraction::TestSubscribeKeepAliveAlignment),
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    NL_TEST_DEF("TestSubscriptionResumption", chip::app::TestReadInteraction::TestSubscriptionResumption),
+    NL_TEST_DEF("TestSubscriptionResumptionFailure", chip::app::TestReadInteraction::TestSubscriptionResumptionFailure),
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SimpleSubscriptionResumptionStorage.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+SubscriptionInfo MakeSubscription(FabricIndex fabricIndex, NodeId nodeId, SubscriptionId subscriptionId)
+{
+    SubscriptionInfo info;
+    info.mFabricIndex    = fabricIndex;
+    info.mNodeId         = nodeId;
+    info.mSubscriptionId = subscriptionId;
+    info.mMinInterval    = 1;
+    info.mMaxInterval    = 60;
+    info.mFabricFiltered = true;
+
+    info.mAttributePaths[0]  = AttributePathParams(EndpointId(1), ClusterId(6), AttributeId(0));
+    info.mAttributePaths[1]  = AttributePathParams(EndpointId(2), ClusterId(8));
+    info.mAttributePathCount = 2;
+
+    info.mEventPaths[0]  = EventPathParams(1, 0x28, 0, true);
+    info.mEventPathCount = 1;
+
+    info.mDataVersionFilters[0].mEndpointId = 1;
+    info.mDataVersionFilters[0].mClusterId  = 6;
+    info.mDataVersionFilters[0].mDataVersion.SetValue(0x12345678);
+    info.mDataVersionFilterCount = 1;
+
+    return info;
+}
+
+// Finds the slot holding the given subscription, loading it into aInfo.
+bool FindSubscription(SubscriptionResumptionStorage & storage, const ScopedNodeId & peer, SubscriptionId subscriptionId,
+                      SubscriptionInfo & aInfo)
+{
+    for (size_t i = 0; i < storage.GetMaxCount(); i++)
+    {
+        if (storage.Load(i, aInfo) == CHIP_NO_ERROR && aInfo.GetPeer() == peer && aInfo.mSubscriptionId == subscriptionId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TestSaveAndLoad(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    SimpleSubscriptionResumptionStorage storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&persistentStorage) == CHIP_NO_ERROR);
+
+    SubscriptionInfo saved = MakeSubscription(1, 0x1111, 0xAAAA);
+    NL_TEST_ASSERT(inSuite, storage.Save(saved) == CHIP_NO_ERROR);
+
+    SubscriptionInfo loaded;
+    NL_TEST_ASSERT(inSuite, FindSubscription(storage, saved.GetPeer(), saved.mSubscriptionId, loaded));
+    NL_TEST_ASSERT(inSuite, loaded.mMinInterval == 1);
+    NL_TEST_ASSERT(inSuite, loaded.mMaxInterval == 60);
+    NL_TEST_ASSERT(inSuite, loaded.mFabricFiltered);
+
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePathCount == 2);
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePaths[0].mEndpointId == 1);
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePaths[0].mClusterId == 6);
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePaths[0].mAttributeId == 0);
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePaths[1].mEndpointId == 2);
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePaths[1].mClusterId == 8);
+    NL_TEST_ASSERT(inSuite, loaded.mAttributePaths[1].HasWildcardAttributeId());
+
+    NL_TEST_ASSERT(inSuite, loaded.mEventPathCount == 1);
+    NL_TEST_ASSERT(inSuite, loaded.mEventPaths[0].mClusterId == 0x28);
+    NL_TEST_ASSERT(inSuite, loaded.mEventPaths[0].mIsUrgentEvent);
+
+    NL_TEST_ASSERT(inSuite, loaded.mDataVersionFilterCount == 1);
+    NL_TEST_ASSERT(inSuite, loaded.mDataVersionFilters[0].mClusterId == 6);
+    NL_TEST_ASSERT(inSuite, loaded.mDataVersionFilters[0].mDataVersion.Value() == 0x12345678);
+
+    // Saving the same subscription again replaces it rather than using another slot.
+    saved.mMaxInterval = 120;
+    NL_TEST_ASSERT(inSuite, storage.Save(saved) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, persistentStorage.GetNumKeys() == 1);
+    NL_TEST_ASSERT(inSuite, FindSubscription(storage, saved.GetPeer(), saved.mSubscriptionId, loaded));
+    NL_TEST_ASSERT(inSuite, loaded.mMaxInterval == 120);
+}
+
+void TestDelete(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    SimpleSubscriptionResumptionStorage storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&persistentStorage) == CHIP_NO_ERROR);
+
+    SubscriptionInfo first  = MakeSubscription(1, 0x1111, 1);
+    SubscriptionInfo second = MakeSubscription(1, 0x2222, 2);
+    SubscriptionInfo third  = MakeSubscription(2, 0x1111, 3);
+    NL_TEST_ASSERT(inSuite, storage.Save(first) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Save(second) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Save(third) == CHIP_NO_ERROR);
+
+    SubscriptionInfo loaded;
+    NL_TEST_ASSERT(inSuite, storage.Delete(second.GetPeer(), second.mSubscriptionId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !FindSubscription(storage, second.GetPeer(), second.mSubscriptionId, loaded));
+    NL_TEST_ASSERT(inSuite, FindSubscription(storage, first.GetPeer(), first.mSubscriptionId, loaded));
+
+    // Deleting a subscription that is not stored is not an error.
+    NL_TEST_ASSERT(inSuite, storage.Delete(second.GetPeer(), second.mSubscriptionId) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, storage.DeleteAll(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !FindSubscription(storage, first.GetPeer(), first.mSubscriptionId, loaded));
+    NL_TEST_ASSERT(inSuite, FindSubscription(storage, third.GetPeer(), third.mSubscriptionId, loaded));
+    NL_TEST_ASSERT(inSuite, persistentStorage.GetNumKeys() == 1);
+}
+
+void TestFull(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistentStorageDelegate persistentStorage;
+    SimpleSubscriptionResumptionStorage storage;
+    NL_TEST_ASSERT(inSuite, storage.Init(&persistentStorage) == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < storage.GetMaxCount(); i++)
+    {
+        NL_TEST_ASSERT(inSuite, storage.Save(MakeSubscription(1, 0x1111, static_cast<SubscriptionId>(i))) == CHIP_NO_ERROR);
+    }
+
+    SubscriptionId extraId = static_cast<SubscriptionId>(storage.GetMaxCount());
+    NL_TEST_ASSERT(inSuite, storage.Save(MakeSubscription(1, 0x1111, extraId)) == CHIP_ERROR_NO_MEMORY);
+
+    NL_TEST_ASSERT(inSuite, storage.Delete(ScopedNodeId(0x1111, 1), 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, storage.Save(MakeSubscription(1, 0x1111, extraId)) == CHIP_NO_ERROR);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test save and load", TestSaveAndLoad), NL_TEST_DEF("Test delete", TestDelete),
+                          NL_TEST_DEF("Test full storage", TestFull), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestSimpleSubscriptionResumptionStorage()
+{
+    nlTestSuite theSuite = { "Subscription resumption storage tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSimpleSubscriptionResumptionStorage)
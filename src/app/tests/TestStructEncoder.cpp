@@ -0,0 +1,486 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for DataModel::EncodeStruct, checking
+ *      that it encodes random values of cluster objects exactly as encoding
+ *      their fields one by one with DataModel::Encode does, in buffers of
+ *      every size, contiguous or not.
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/Encode.h>
+#include <app/data-model/StructEncoder.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+constexpr size_t kBufferSize = 96;
+constexpr size_t kIterations = 200;
+
+const uint8_t sBytes[] = { 0x00, 0x01, 0x7F, 0x80, 0xFF, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B };
+const char sChars[]    = { 'm', 'a', 't', 't', 'e', 'r', ' ', 's', 't', 'r', 'u', 'c', 't' };
+
+/**
+ * Pseudo-random values of the types of struct fields, with magnitudes spread over all the TLV integer widths.
+ */
+class Random
+{
+public:
+    uint64_t Next()
+    {
+        // xorshift64*
+        mState ^= mState >> 12;
+        mState ^= mState << 25;
+        mState ^= mState >> 27;
+        return mState * 0x2545F4914F6CDD1Dull;
+    }
+
+    bool Boolean() { return (Next() & 1) != 0; }
+
+    template <typename T>
+    T Integer()
+    {
+        static const uint64_t kLimits[] = {
+            INT8_MAX, UINT8_MAX, INT16_MAX, UINT16_MAX, INT32_MAX, UINT32_MAX, INT64_MAX, UINT64_MAX,
+        };
+
+        // Half of the values are at, or next to, the limits of the TLV integer widths, or their opposites.
+        uint64_t random = Next();
+        if ((random & 1) == 0)
+        {
+            return static_cast<T>(Next() >> (random % 64));
+        }
+        uint64_t value = kLimits[(random >> 1) % ArraySize(kLimits)] + (random >> 4) % 3 - 1;
+        return static_cast<T>(((random >> 8) & 1) ? 0 - value : value);
+    }
+
+    template <typename T>
+    void Fill(T & value)
+    {
+        value = Integer<T>();
+    }
+
+    void Fill(bool & value) { value = Boolean(); }
+
+    void Fill(float & value) { value = static_cast<float>(Integer<int32_t>()) / 7; }
+
+    void Fill(double & value) { value = static_cast<double>(Integer<int64_t>()) / 7; }
+
+    template <typename T>
+    void Fill(BitMask<T> & value)
+    {
+        value.SetRaw(Integer<typename BitMask<T>::IntegerType>());
+    }
+
+    template <typename T>
+    void Fill(Optional<T> & value)
+    {
+        if (Boolean())
+        {
+            value.ClearValue();
+            return;
+        }
+        Fill(value.Emplace());
+    }
+
+    template <typename T>
+    void Fill(DataModel::Nullable<T> & value)
+    {
+        if (Boolean())
+        {
+            value.SetNull();
+            return;
+        }
+        Fill(value.SetNonNull());
+    }
+
+    void Fill(ByteSpan & value) { value = ByteSpan(sBytes, Next() % sizeof(sBytes)); }
+
+    void Fill(CharSpan & value) { value = CharSpan(sChars, Next() % sizeof(sChars)); }
+
+private:
+    uint64_t mState = 0x9E3779B97F4A7C15ull;
+};
+
+/**
+ * The encoding of the cluster objects before DataModel::EncodeStruct: each field encoded with DataModel::Encode.
+ */
+CHIP_ERROR EncodeFieldByField(TLV::TLVWriter &)
+{
+    return CHIP_NO_ERROR;
+}
+
+template <typename FieldId, typename X, typename... Rest>
+CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, FieldId fieldId, const X & x, const Rest &... rest)
+{
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(static_cast<uint8_t>(to_underlying(fieldId))), x));
+    return EncodeFieldByField(writer, rest...);
+}
+
+template <typename... FieldIdsAndValues>
+CHIP_ERROR EncodeStructFieldByField(TLV::TLVWriter & writer, TLV::Tag tag, const FieldIdsAndValues &... fieldIdsAndValues)
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(EncodeFieldByField(writer, fieldIdsAndValues...));
+    return writer.EndContainer(outer);
+}
+
+enum class SignedEnum : int16_t
+{
+    kNegative = -1,
+};
+
+enum class Bitmap : uint16_t
+{
+    kFirst = 0x1,
+};
+
+/**
+ * A struct with a field of each kind of scalar, encoded the way the generated cluster objects are.
+ */
+struct AllScalars
+{
+    enum class Fields
+    {
+        kU8               = 0,
+        kU16              = 1,
+        kU32              = 2,
+        kU64              = 3,
+        kI8               = 4,
+        kI16              = 5,
+        kI32              = 6,
+        kI64              = 7,
+        kBoolean          = 8,
+        kFloat            = 9,
+        kDouble           = 10,
+        kEnum             = 11,
+        kBitmap           = 12,
+        kOptional         = 13,
+        kNullable         = 14,
+        kOptionalNullable = 254,
+    };
+
+    uint8_t u8;
+    uint16_t u16;
+    uint32_t u32;
+    uint64_t u64;
+    int8_t i8;
+    int16_t i16;
+    int32_t i32;
+    int64_t i64;
+    bool boolean;
+    float f;
+    double d;
+    SignedEnum e;
+    BitMask<Bitmap> bitmap;
+    Optional<int32_t> optional;
+    DataModel::Nullable<uint16_t> nullable;
+    Optional<DataModel::Nullable<double>> optionalNullable;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return DataModel::EncodeStruct(writer, tag, Fields::kU8, u8, Fields::kU16, u16, Fields::kU32, u32, Fields::kU64, u64,
+                                       Fields::kI8, i8, Fields::kI16, i16, Fields::kI32, i32, Fields::kI64, i64, Fields::kBoolean,
+                                       boolean, Fields::kFloat, f, Fields::kDouble, d, Fields::kEnum, e, Fields::kBitmap, bitmap,
+                                       Fields::kOptional, optional, Fields::kNullable, nullable, Fields::kOptionalNullable,
+                                       optionalNullable);
+    }
+};
+
+static_assert(DataModel::detail::InPlaceStruct<AllScalars::Fields, uint8_t, AllScalars::Fields, int64_t, AllScalars::Fields,
+                                               Optional<DataModel::Nullable<double>>>::kMaxSize == 3 + 10 + 10,
+              "The size of fields must be bounded by their largest encoding");
+static_assert(DataModel::detail::InPlaceStruct<AllScalars::Fields, uint8_t, AllScalars::Fields, CharSpan>::kMaxSize == 0,
+              "Strings must not be encoded in place");
+
+// Each case fills a cluster object with random values, and encodes it field by field as its generated Encode() used to.
+
+struct AllScalarsCase : AllScalars
+{
+    void Randomize(Random & random)
+    {
+        random.Fill(u8);
+        random.Fill(u16);
+        random.Fill(u32);
+        random.Fill(u64);
+        random.Fill(i8);
+        random.Fill(i16);
+        random.Fill(i32);
+        random.Fill(i64);
+        random.Fill(boolean);
+        random.Fill(f);
+        random.Fill(d);
+        random.Fill(e);
+        random.Fill(bitmap);
+        random.Fill(optional);
+        random.Fill(nullable);
+        random.Fill(optionalNullable);
+    }
+
+    CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return EncodeStructFieldByField(writer, tag, Fields::kU8, u8, Fields::kU16, u16, Fields::kU32, u32, Fields::kU64, u64,
+                                        Fields::kI8, i8, Fields::kI16, i16, Fields::kI32, i32, Fields::kI64, i64, Fields::kBoolean,
+                                        boolean, Fields::kFloat, f, Fields::kDouble, d, Fields::kEnum, e, Fields::kBitmap, bitmap,
+                                        Fields::kOptional, optional, Fields::kNullable, nullable, Fields::kOptionalNullable,
+                                        optionalNullable);
+    }
+};
+
+struct MoveToHueCase : ColorControl::Commands::MoveToHue::Type
+{
+    using Fields = ColorControl::Commands::MoveToHue::Fields;
+
+    void Randomize(Random & random)
+    {
+        random.Fill(hue);
+        random.Fill(direction);
+        random.Fill(transitionTime);
+        random.Fill(optionsMask);
+        random.Fill(optionsOverride);
+    }
+
+    CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return EncodeStructFieldByField(writer, tag, Fields::kHue, hue, Fields::kDirection, direction, Fields::kTransitionTime,
+                                        transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride,
+                                        optionsOverride);
+    }
+};
+
+struct MoveToLevelWithOnOffCase : LevelControl::Commands::MoveToLevelWithOnOff::Type
+{
+    using Fields = LevelControl::Commands::MoveToLevelWithOnOff::Fields;
+
+    void Randomize(Random & random)
+    {
+        random.Fill(level);
+        random.Fill(transitionTime);
+        random.Fill(optionsMask);
+        random.Fill(optionsOverride);
+    }
+
+    CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return EncodeStructFieldByField(writer, tag, Fields::kLevel, level, Fields::kTransitionTime, transitionTime,
+                                        Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
+    }
+};
+
+struct SeekCase : MediaPlayback::Commands::Seek::Type
+{
+    using Fields = MediaPlayback::Commands::Seek::Fields;
+
+    void Randomize(Random & random) { random.Fill(position); }
+
+    CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return EncodeStructFieldByField(writer, tag, Fields::kPosition, position);
+    }
+};
+
+struct TestNullableOptionalRequestCase : TestCluster::Commands::TestNullableOptionalRequest::Type
+{
+    using Fields = TestCluster::Commands::TestNullableOptionalRequest::Fields;
+
+    void Randomize(Random & random) { random.Fill(arg1); }
+
+    CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return EncodeStructFieldByField(writer, tag, Fields::kArg1, arg1);
+    }
+};
+
+// Has strings, so is never encoded in place.
+struct SimpleStructCase : TestCluster::Structs::SimpleStruct::Type
+{
+    using Fields = TestCluster::Structs::SimpleStruct::Fields;
+
+    void Randomize(Random & random)
+    {
+        random.Fill(a);
+        random.Fill(b);
+        random.Fill(c);
+        random.Fill(d);
+        random.Fill(e);
+        random.Fill(f);
+        random.Fill(g);
+        random.Fill(h);
+    }
+
+    CHIP_ERROR EncodeFieldByField(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        return EncodeStructFieldByField(writer, tag, Fields::kA, a, Fields::kB, b, Fields::kC, c, Fields::kD, d, Fields::kE, e,
+                                        Fields::kF, f, Fields::kG, g, Fields::kH, h);
+    }
+};
+
+/**
+ * A TLVBackingStore handing out consecutive chunks of a single buffer: the encoding ends up contiguous in the buffer, but
+ * the writer sees it in chunks.
+ */
+class ChunkedBackingStore : public TLV::TLVBackingStore
+{
+public:
+    ChunkedBackingStore(uint8_t * buffer, uint32_t length, uint32_t chunkLength) :
+        mNext(buffer), mRemaining(length), mChunkLength(chunkLength)
+    {}
+
+    CHIP_ERROR OnInit(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return GetNewBuffer(writer, bufStart, bufLen);
+    }
+
+    CHIP_ERROR GetNewBuffer(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mNext;
+        bufLen   = (mRemaining < mChunkLength) ? mRemaining : mChunkLength;
+        mNext += bufLen;
+        mRemaining -= bufLen;
+        return (bufLen > 0) ? CHIP_NO_ERROR : CHIP_ERROR_NO_MEMORY;
+    }
+
+    CHIP_ERROR FinalizeBuffer(TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override { return CHIP_NO_ERROR; }
+
+private:
+    uint8_t * mNext;
+    uint32_t mRemaining;
+    uint32_t mChunkLength;
+};
+
+struct Encoding
+{
+    CHIP_ERROR err;
+    uint32_t lengthWritten;
+    // Past the length given to the writer, to catch writes beyond it.
+    uint8_t bytes[kBufferSize + 16];
+};
+
+// Encode into the first length bytes of encoding.bytes, in chunks of chunkLength bytes, or in a single buffer if 0.
+template <typename Case, typename EncodeMethod>
+void EncodeCase(const Case & value, EncodeMethod encode, uint32_t length, uint32_t chunkLength, Encoding & encoding)
+{
+    TLV::TLVWriter writer;
+    ChunkedBackingStore backingStore(encoding.bytes, length, chunkLength);
+
+    memset(encoding.bytes, 0xA5, sizeof(encoding.bytes));
+    encoding.err           = CHIP_NO_ERROR;
+    encoding.lengthWritten = 0;
+
+    if (chunkLength == 0)
+    {
+        writer.Init(encoding.bytes, length);
+    }
+    else
+    {
+        encoding.err = writer.Init(backingStore, length);
+        VerifyOrReturn(encoding.err == CHIP_NO_ERROR);
+    }
+
+    encoding.err           = (value.*encode)(writer, TLV::AnonymousTag());
+    encoding.lengthWritten = writer.GetLengthWritten();
+}
+
+template <typename Case>
+void CheckEquivalence(nlTestSuite * inSuite, void * inContext)
+{
+    static const uint32_t kChunkLengths[] = { 0, 1, 3, 7, 16 };
+
+    Random random;
+    Case value;
+
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        value.Randomize(random);
+
+        for (uint32_t length = 0; length <= kBufferSize; length++)
+        {
+            for (uint32_t chunkLength : kChunkLengths)
+            {
+                Encoding expected;
+                Encoding actual;
+
+                EncodeCase(value, &Case::EncodeFieldByField, length, chunkLength, expected);
+                EncodeCase(value, &Case::Encode, length, chunkLength, actual);
+
+                NL_TEST_ASSERT(inSuite, actual.err == expected.err);
+                NL_TEST_ASSERT(inSuite, actual.lengthWritten == expected.lengthWritten);
+                NL_TEST_ASSERT(inSuite, memcmp(actual.bytes, expected.bytes, sizeof(actual.bytes)) == 0);
+            }
+        }
+    }
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestAllScalars", CheckEquivalence<AllScalarsCase>),
+    NL_TEST_DEF("TestMoveToHue", CheckEquivalence<MoveToHueCase>),
+    NL_TEST_DEF("TestMoveToLevelWithOnOff", CheckEquivalence<MoveToLevelWithOnOffCase>),
+    NL_TEST_DEF("TestSeek", CheckEquivalence<SeekCase>),
+    NL_TEST_DEF("TestNullableOptionalRequest", CheckEquivalence<TestNullableOptionalRequestCase>),
+    NL_TEST_DEF("TestSimpleStruct", CheckEquivalence<SimpleStructCase>),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite theSuite =
+{
+    "TestStructEncoder",
+    &sTests[0],
+    nullptr,
+    nullptr
+};
+// clang-format on
+
+} // namespace
+
+int TestStructEncoder()
+{
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestStructEncoder)
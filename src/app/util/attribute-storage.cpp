@@ -42,10 +42,12 @@
 #include "app/util/common.h"
 #include <app/AttributePersistenceProvider.h>
 #include <app/InteractionModelEngine.h>
+#include <app/InterfaceDispatchTable.h>
 #include <app/reporting/reporting.h>
 #include <app/util/af.h>
 #include <app/util/attribute-storage.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/PerfectHash.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/LockTracker.h>
 
@@ -115,7 +117,275 @@ DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
 #define endpointTypeMacro(x) (&(generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[x]]))
 #endif
 
+#if CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+// Perfect hash tables, built at compile time, of the clusters of the fixed endpoints, keyed by endpoint and cluster id,
+// and of the attributes of the generated clusters, keyed by cluster index and attribute id. Fixed endpoints are the
+// first ones of emAfEndpoints, so the storage offsets of their clusters and attributes are constant too.
+constexpr const EndpointId fixedEndpointIds[]       = FIXED_ENDPOINT_ARRAY;
+constexpr const uint8_t fixedEndpointTypeIndexes[] = FIXED_ENDPOINT_TYPES;
+
+constexpr uint16_t kNoClusterIndex = UINT16_MAX;
+
+struct FixedClusterEntry
+{
+    EndpointId endpoint;
+    ClusterId clusterId;
+    uint16_t endpointIndex;
+    // Indexes in generatedClusters of the first cluster with this id on the endpoint, and of its server and client
+    // clusters, or kNoClusterIndex.
+    uint16_t firstClusterIndex;
+    uint16_t serverClusterIndex;
+    uint16_t clientClusterIndex;
+    // Offset of the storage of the server cluster in attributeData.
+    uint16_t serverStorageOffset;
+};
+
+struct FixedAttributeEntry
+{
+    uint16_t clusterIndex;
+    // Index of the attribute in the attributes of the cluster.
+    uint16_t attributeIndex;
+    // Offset of the attribute in the storage of the cluster, or in singletonAttributeData for a singleton.
+    uint16_t storageOffset;
+};
+
+template <typename T, size_t N>
+struct ConstexprArray
+{
+    T mItems[N];
+};
+
+constexpr uint64_t FixedClusterKey(EndpointId endpoint, ClusterId clusterId)
+{
+    return (static_cast<uint64_t>(endpoint) << 32) | clusterId;
+}
+
+constexpr uint64_t FixedAttributeKey(uint16_t clusterIndex, AttributeId attributeId)
+{
+    return (static_cast<uint64_t>(clusterIndex) << 32) | attributeId;
+}
+
+constexpr const EmberAfEndpointType & FixedEndpointType(size_t endpointIndex)
+{
+    return generatedEmberAfEndpointTypes[fixedEndpointTypeIndexes[endpointIndex]];
+}
+
+// Whether the cluster at index i of an endpoint type is the first one with its id, client and server clusters
+// sharing an entry.
+constexpr bool IsFirstClusterWithId(const EmberAfEndpointType & endpointType, uint8_t i)
+{
+    for (uint8_t j = 0; j < i; j++)
+    {
+        if (endpointType.cluster[j].clusterId == endpointType.cluster[i].clusterId)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr size_t CountFixedClusters()
+{
+    size_t count = 0;
+    for (size_t ep = 0; ep < ArraySize(fixedEndpointTypeIndexes); ep++)
+    {
+        for (uint8_t i = 0; i < FixedEndpointType(ep).clusterCount; i++)
+        {
+            count += IsFirstClusterWithId(FixedEndpointType(ep), i) ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+constexpr size_t CountGeneratedClusterAttributes()
+{
+    size_t count = 0;
+    for (const EmberAfCluster & cluster : generatedClusters)
+    {
+        count += cluster.attributeCount;
+    }
+    return count;
+}
+
+constexpr size_t kFixedClusterCount   = CountFixedClusters();
+constexpr size_t kFixedAttributeCount = CountGeneratedClusterAttributes();
+
+// Arrays can not be empty.
+template <typename T, size_t N>
+using FixedEntries = ConstexprArray<T, (N > 0) ? N : 1>;
+
+constexpr FixedEntries<FixedClusterEntry, kFixedClusterCount> MakeFixedClusterEntries()
+{
+    FixedEntries<FixedClusterEntry, kFixedClusterCount> entries = {};
+    size_t count                                                = 0;
+    uint16_t endpointStorageOffset                              = 0;
+
+    for (size_t ep = 0; ep < ArraySize(fixedEndpointTypeIndexes); ep++)
+    {
+        const EmberAfEndpointType & endpointType = FixedEndpointType(ep);
+
+        uint16_t clusterStorageOffsets[UINT8_MAX] = {};
+        uint16_t clusterStorageOffset             = endpointStorageOffset;
+        for (uint8_t i = 0; i < endpointType.clusterCount; i++)
+        {
+            clusterStorageOffsets[i] = clusterStorageOffset;
+            clusterStorageOffset     = static_cast<uint16_t>(clusterStorageOffset + endpointType.cluster[i].clusterSize);
+        }
+
+        for (uint8_t i = 0; i < endpointType.clusterCount; i++)
+        {
+            if (!IsFirstClusterWithId(endpointType, i))
+            {
+                continue;
+            }
+
+            FixedClusterEntry & entry = entries.mItems[count++];
+            entry.endpoint            = fixedEndpointIds[ep];
+            entry.clusterId           = endpointType.cluster[i].clusterId;
+            entry.endpointIndex       = static_cast<uint16_t>(ep);
+            entry.firstClusterIndex   = static_cast<uint16_t>(&endpointType.cluster[i] - generatedClusters);
+            entry.serverClusterIndex  = kNoClusterIndex;
+            entry.clientClusterIndex  = kNoClusterIndex;
+            for (uint8_t j = i; j < endpointType.clusterCount; j++)
+            {
+                const EmberAfCluster & cluster = endpointType.cluster[j];
+                if (cluster.clusterId != entry.clusterId)
+                {
+                    continue;
+                }
+                if ((cluster.mask & CLUSTER_MASK_SERVER) && entry.serverClusterIndex == kNoClusterIndex)
+                {
+                    entry.serverClusterIndex  = static_cast<uint16_t>(&cluster - generatedClusters);
+                    entry.serverStorageOffset = clusterStorageOffsets[j];
+                }
+                if ((cluster.mask & CLUSTER_MASK_CLIENT) && entry.clientClusterIndex == kNoClusterIndex)
+                {
+                    entry.clientClusterIndex = static_cast<uint16_t>(&cluster - generatedClusters);
+                }
+            }
+        }
+
+        endpointStorageOffset = static_cast<uint16_t>(endpointStorageOffset + endpointType.endpointSize);
+    }
+    return entries;
+}
+
+constexpr FixedEntries<FixedAttributeEntry, kFixedAttributeCount> MakeFixedAttributeEntries()
+{
+    FixedEntries<FixedAttributeEntry, kFixedAttributeCount> entries = {};
+    size_t count                                                    = 0;
+
+    uint16_t singletonStorageOffsets[ArraySize(generatedAttributes)] = {};
+    uint16_t singletonStorageOffset                                  = 0;
+    for (size_t i = 0; i < ArraySize(generatedAttributes); i++)
+    {
+        singletonStorageOffsets[i] = singletonStorageOffset;
+        EmberAfAttributeMask mask = generatedAttributes[i].mask;
+        if ((mask & ATTRIBUTE_MASK_SINGLETON) && !(mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE))
+        {
+            singletonStorageOffset = static_cast<uint16_t>(singletonStorageOffset + generatedAttributes[i].size);
+        }
+    }
+
+    for (size_t clusterIndex = 0; clusterIndex < ArraySize(generatedClusters); clusterIndex++)
+    {
+        const EmberAfCluster & cluster = generatedClusters[clusterIndex];
+        uint16_t storageOffset         = 0;
+        for (uint16_t i = 0; i < cluster.attributeCount; i++)
+        {
+            const EmberAfAttributeMetadata & am = cluster.attributes[i];
+            FixedAttributeEntry & entry         = entries.mItems[count++];
+            entry.clusterIndex                  = static_cast<uint16_t>(clusterIndex);
+            entry.attributeIndex                = i;
+            if (am.mask & ATTRIBUTE_MASK_SINGLETON)
+            {
+                entry.storageOffset = singletonStorageOffsets[&am - generatedAttributes];
+            }
+            else
+            {
+                entry.storageOffset = storageOffset;
+                if (!(am.mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE))
+                {
+                    storageOffset = static_cast<uint16_t>(storageOffset + am.size);
+                }
+            }
+        }
+    }
+    return entries;
+}
+
+constexpr auto fixedClusters   = MakeFixedClusterEntries();
+constexpr auto fixedAttributes = MakeFixedAttributeEntries();
+
+constexpr FixedEntries<uint64_t, kFixedClusterCount> MakeFixedClusterKeys()
+{
+    FixedEntries<uint64_t, kFixedClusterCount> keys = {};
+    for (size_t i = 0; i < kFixedClusterCount; i++)
+    {
+        keys.mItems[i] = FixedClusterKey(fixedClusters.mItems[i].endpoint, fixedClusters.mItems[i].clusterId);
+    }
+    return keys;
+}
+
+constexpr FixedEntries<uint64_t, kFixedAttributeCount> MakeFixedAttributeKeys()
+{
+    FixedEntries<uint64_t, kFixedAttributeCount> keys = {};
+    for (size_t i = 0; i < kFixedAttributeCount; i++)
+    {
+        const FixedAttributeEntry & entry = fixedAttributes.mItems[i];
+        const EmberAfCluster & cluster    = generatedClusters[entry.clusterIndex];
+        keys.mItems[i] = FixedAttributeKey(entry.clusterIndex, cluster.attributes[entry.attributeIndex].attributeId);
+    }
+    return keys;
+}
+
+// The keys are only used to build the tables: lookups check the entries they find instead.
+constexpr auto fixedClusterKeys   = MakeFixedClusterKeys();
+constexpr auto fixedAttributeKeys = MakeFixedAttributeKeys();
+
+constexpr auto fixedClusterTable   = PerfectHash::Table<kFixedClusterCount>::Build(fixedClusterKeys.mItems);
+constexpr auto fixedAttributeTable = PerfectHash::Table<kFixedAttributeCount>::Build(fixedAttributeKeys.mItems);
+static_assert(fixedClusterTable.IsValid(), "An endpoint of the generated configuration is listed twice");
+static_assert(fixedAttributeTable.IsValid(), "An attribute of the generated configuration is listed twice in its cluster");
+
+// Returns the entry of a cluster of an enabled fixed endpoint, or null.
+const FixedClusterEntry * FindFixedCluster(EndpointId endpoint, ClusterId clusterId)
+{
+    uint16_t index = fixedClusterTable.Find(FixedClusterKey(endpoint, clusterId));
+    if (index == fixedClusterTable.kNoIndex)
+    {
+        return nullptr;
+    }
+
+    const FixedClusterEntry & entry = fixedClusters.mItems[index];
+    if (entry.endpoint != endpoint || entry.clusterId != clusterId || !emberAfEndpointIndexIsEnabled(entry.endpointIndex))
+    {
+        return nullptr;
+    }
+    return &entry;
+}
+
+const FixedAttributeEntry * FindFixedAttribute(uint16_t clusterIndex, AttributeId attributeId)
+{
+    uint16_t index = fixedAttributeTable.Find(FixedAttributeKey(clusterIndex, attributeId));
+    if (index == fixedAttributeTable.kNoIndex)
+    {
+        return nullptr;
+    }
+
+    const FixedAttributeEntry & entry = fixedAttributes.mItems[index];
+    if (entry.clusterIndex != clusterIndex ||
+        generatedClusters[clusterIndex].attributes[entry.attributeIndex].attributeId != attributeId)
+    {
+        return nullptr;
+    }
+    return &entry;
+}
+#endif // CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+
 app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
+// Index of gAttributeAccessOverrides by endpoint and cluster, used by GetAttributeAccessOverride.
+app::InterfaceDispatchTable<app::AttributeAccessInterface> gAttributeAccessOverrideTable;
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -548,11 +818,81 @@ bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMe
 // type.  For strings, the function will copy as many bytes as will fit in the
 // attribute.  This means the resulting string may be truncated.  The length
 // byte(s) in the resulting string will reflect any truncated.
+static EmberAfStatus readOrWriteAttributeAt(EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeMetadata * am,
+                                            uint8_t * attributeLocation, bool isDynamicEndpoint, uint8_t * buffer,
+                                            uint16_t readLength, bool write)
+{
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+    else
+    {
+        if (buffer == nullptr)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+
+    // Is the attribute externally stored?
+    if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+    {
+        return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer)
+                      : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                             emberAfAttributeSize(am)));
+    }
+
+    // Internal storage is only supported for fixed endpoints
+    if (!isDynamicEndpoint)
+    {
+        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+    }
+
+    return EMBER_ZCL_STATUS_FAILURE;
+}
+
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write)
 {
     assertChipStackLockedByCurrentThread();
 
+#if CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+    // Attributes of fixed endpoints are found in the tables; the walk below finds the others.
+    const FixedClusterEntry * clusterEntry = FindFixedCluster(attRecord->endpoint, attRecord->clusterId);
+    if (clusterEntry != nullptr && clusterEntry->serverClusterIndex != kNoClusterIndex)
+    {
+        const FixedAttributeEntry * attributeEntry = FindFixedAttribute(clusterEntry->serverClusterIndex, attRecord->attributeId);
+        if (attributeEntry != nullptr)
+        {
+            const EmberAfAttributeMetadata * am =
+                &generatedClusters[clusterEntry->serverClusterIndex].attributes[attributeEntry->attributeIndex];
+            if (metadata != nullptr)
+            {
+                *metadata = am;
+            }
+
+            uint8_t * attributeLocation =
+                (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeData + attributeEntry->storageOffset
+                                                     : attributeData + clusterEntry->serverStorageOffset +
+                                                           attributeEntry->storageOffset);
+            return readOrWriteAttributeAt(attRecord, am, attributeLocation, false, buffer, readLength, write);
+        }
+    }
+#endif // CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+
     uint16_t attributeOffsetIndex = 0;
 
     for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
@@ -585,54 +925,11 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
                                 *metadata = am;
                             }
 
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                          am, buffer)
-                                                  : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                                         am, buffer, emberAfAttributeSize(am)));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return EMBER_ZCL_STATUS_FAILURE;
-                            }
+                            uint8_t * attributeLocation =
+                                (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
+                                                                     : attributeData + attributeOffsetIndex);
+                            return readOrWriteAttributeAt(attRecord, am, attributeLocation, isDynamicEndpoint, buffer, readLength,
+                                                          write);
                         }
                         else
                         { // Not the attribute we are looking for
@@ -787,6 +1084,19 @@ void EnabledEndpointsWithServerCluster::EnsureMatchingEndpoint()
 // Finds the cluster that matches endpoint, clusterId, direction.
 const EmberAfCluster * emberAfFindCluster(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
+#if CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+    // Enabled fixed endpoints come first, so this is the cluster emberAfFindClusterInType would find.
+    const FixedClusterEntry * entry = FindFixedCluster(endpoint, clusterId);
+    if (entry != nullptr)
+    {
+        uint16_t index = (mask == 0) ? entry->firstClusterIndex
+                                     : (mask == CLUSTER_MASK_SERVER) ? entry->serverClusterIndex
+                                                                     : (mask == CLUSTER_MASK_CLIENT) ? entry->clientClusterIndex
+                                                                                                     : kNoClusterIndex;
+        return (index == kNoClusterIndex) ? nullptr : &generatedClusters[index];
+    }
+#endif // CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+
     uint16_t ep = emberAfIndexFromEndpoint(endpoint);
     if (ep == kEmberInvalidEndpointIndex)
     {
@@ -956,6 +1266,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
                         gAttributeAccessOverrides = next;
                     }
 
+                    gAttributeAccessOverrideTable.Remove(cur);
                     cur->SetNext(nullptr);
 
                     // Do not change prev in this case.
@@ -1217,6 +1528,13 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, bool ignoreStorage, Optional
         }
         de = &(emAfEndpoints[ep]);
 
+        // When loading the whole endpoint, let the provider fetch what all its reads need at once.
+        bool bulkRead = (attrStorage != nullptr && !clusterId.HasValue());
+        if (bulkRead)
+        {
+            attrStorage->StartBulkRead(de->endpoint);
+        }
+
         for (clusterI = 0; clusterI < de->endpointType->clusterCount; clusterI++)
         {
             const EmberAfCluster * cluster = &(de->endpointType->cluster[clusterI]);
@@ -1332,6 +1650,10 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, bool ignoreStorage, Optional
                 }
             }
         }
+        if (bulkRead)
+        {
+            attrStorage->EndBulkRead();
+        }
         if (endpoint != EMBER_BROADCAST_ENDPOINT)
         {
             break;
@@ -1411,16 +1733,29 @@ EmberAfGenericClusterFunction emberAfFindClusterFunction(const EmberAfCluster *
 
 bool registerAttributeAccessOverride(app::AttributeAccessInterface * attrOverride)
 {
-    for (auto * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
+    bool duplicate = false;
+    if (attrOverride->GetEndpointId().HasValue())
     {
-        if (cur->Matches(*attrOverride))
+        duplicate =
+            gAttributeAccessOverrideTable.Find(attrOverride->GetEndpointId().Value(), attrOverride->GetClusterId()) != nullptr;
+    }
+    else
+    {
+        // An override for all endpoints conflicts with any override for its cluster.
+        for (auto * cur = gAttributeAccessOverrides; cur && !duplicate; cur = cur->GetNext())
         {
-            ChipLogError(Zcl, "Duplicate attribute override registration failed");
-            return false;
+            duplicate = cur->Matches(*attrOverride);
         }
     }
+    if (duplicate)
+    {
+        ChipLogError(Zcl, "Duplicate attribute override registration failed");
+        return false;
+    }
+
     attrOverride->SetNext(gAttributeAccessOverrides);
     gAttributeAccessOverrides = attrOverride;
+    gAttributeAccessOverrideTable.Insert(attrOverride);
     return true;
 }
 
@@ -1428,15 +1763,7 @@ namespace chip {
 namespace app {
 app::AttributeAccessInterface * GetAttributeAccessOverride(EndpointId endpointId, ClusterId clusterId)
 {
-    for (app::AttributeAccessInterface * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return gAttributeAccessOverrideTable.Find(endpointId, clusterId);
 }
 } // namespace app
 } // namespace chip
@@ -0,0 +1,581 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/BulkCommissioner.h>
+
+#include <controller/CHIPDeviceControllerFactory.h>
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <setup_payload/ManualSetupPayloadParser.h>
+#include <setup_payload/QRCodeSetupPayloadParser.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+namespace {
+
+constexpr char kQRCodePrefix[] = "MT:";
+
+// Devices that power up after the initial browse announce themselves, but a periodic browse also catches the ones whose
+// announcements were lost.
+constexpr System::Clock::Seconds16 kRediscoveryInterval = System::Clock::Seconds16(5);
+
+System::Clock::Milliseconds32 Since(System::Clock::Timestamp start)
+{
+    return std::chrono::duration_cast<System::Clock::Milliseconds32>(System::SystemClock().GetMonotonicTimestamp() - start);
+}
+
+CHIP_ERROR ParseSetUpCode(const char * setUpCode, SetupPayload & payload)
+{
+    VerifyOrReturnError(setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (strncmp(setUpCode, kQRCodePrefix, strlen(kQRCodePrefix)) == 0)
+    {
+        ReturnErrorOnFailure(QRCodeSetupPayloadParser(setUpCode).populatePayload(payload));
+        VerifyOrReturnError(payload.isValidQRCodePayload(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    else
+    {
+        ReturnErrorOnFailure(ManualSetupPayloadParser(setUpCode).populatePayload(payload));
+        VerifyOrReturnError(payload.isValidManualCode(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+bool BulkCommissioningDevice::HasTriedHost(const char * hostName) const
+{
+    for (uint8_t i = 0; i < mTriedHostCount; i++)
+    {
+        if (strcmp(mTriedHosts[i], hostName) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BulkCommissioningReport::Log() const
+{
+    ChipLogProgress(Controller, "Bulk commissioning: %u succeeded, %u failed in %" PRIu32 " ms",
+                    static_cast<unsigned>(succeeded), static_cast<unsigned>(failed), elapsed.count());
+
+    auto logStage = [](const char * name, const BulkCommissioningStageStatistics & statistics) {
+        if (statistics.count > 0)
+        {
+            ChipLogProgress(Controller, "  %-28s %5" PRIu32 " devices, avg %6" PRIu32 " ms, max %6" PRIu32 " ms", name,
+                            statistics.count, statistics.Average().count(), statistics.max.count());
+        }
+    };
+
+    logStage("Discovery", discovery);
+    logStage("Queued", queued);
+    for (size_t i = 0; i < kCommissioningStageCount; i++)
+    {
+        logStage(StageToString(static_cast<CommissioningStage>(i)), stages[i]);
+    }
+}
+
+BulkCommissioner::~BulkCommissioner()
+{
+    if (IsRunning())
+    {
+        // Don't call back into a delegate that may be going away with us.
+        mDelegate = nullptr;
+        for (size_t i = 0; i < mLaneCount; i++)
+        {
+            Lane & lane = mLanes[i];
+            if (lane.mDevice != nullptr)
+            {
+                lane.mCommissioner->StopPairing(lane.mDevice->nodeId);
+            }
+            lane.mCommissioner->RegisterPairingDelegate(lane.mPreviousDelegate);
+        }
+        mSystemLayer->CancelTimer(DispatchCallback, this);
+        mSystemLayer->CancelTimer(DiscoveryTimerCallback, this);
+        GetResolver().Shutdown();
+    }
+}
+
+CHIP_ERROR BulkCommissioner::Start(const BulkCommissioningParameters & params)
+{
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(params.delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!params.commissioners.empty() && params.commissioners.size() <= kMaxParallelism,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    System::Layer * systemLayer                                   = params.systemLayer;
+    Inet::EndPointManager<Inet::UDPEndPoint> * udpEndPointManager = nullptr;
+    const auto * systemState                                      = DeviceControllerFactory::GetInstance().GetSystemState();
+    if (systemState != nullptr)
+    {
+        systemLayer        = systemLayer != nullptr ? systemLayer : systemState->SystemLayer();
+        udpEndPointManager = systemState->UDPEndPointManager();
+    }
+    // An injected resolver brings its own transport.
+    VerifyOrReturnError(systemLayer != nullptr && (mResolver != nullptr || udpEndPointManager != nullptr),
+                        CHIP_ERROR_INCORRECT_STATE);
+
+    for (auto * commissioner : params.commissioners)
+    {
+        VerifyOrReturnError(commissioner != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    // Validate every setup code before touching anything so that a typo does not leave half a batch running.
+    for (auto & device : params.devices)
+    {
+        SetupPayload payload;
+        VerifyOrReturnError(IsOperationalNodeId(device.nodeId), CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(ParseSetUpCode(device.setUpCode, payload));
+
+        device.error           = CHIP_NO_ERROR;
+        device.failedStage     = CommissioningStage::kError;
+        device.timings         = BulkCommissioningTimings();
+        device.mState          = BulkCommissioningDevice::State::kDiscovering;
+        device.mDiscriminator  = payload.discriminator;
+        device.mSetUpPINCode   = payload.setUpPINCode;
+        device.mHostName[0]    = '\0';
+        device.mTriedHostCount = 0;
+        device.mPairingError   = CHIP_NO_ERROR;
+    }
+
+    mSystemLayer             = systemLayer;
+    mDevices                 = params.devices;
+    mCommissioningParameters = params.commissioningParameters;
+    mRemaining               = params.devices.size();
+    mStartTime               = System::SystemClock().GetMonotonicTimestamp();
+    mDiscoveryDeadline       = mStartTime + params.discoveryTimeout;
+
+    mLaneCount = params.commissioners.size();
+    if (params.parallelism != 0)
+    {
+        mLaneCount = std::min(mLaneCount, params.parallelism);
+    }
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane            = mLanes[i];
+        lane.mOwner            = this;
+        lane.mCommissioner     = params.commissioners.data()[i];
+        lane.mPreviousDelegate = lane.mCommissioner->GetPairingDelegate();
+        lane.mDevice           = nullptr;
+        lane.mFinished         = false;
+        lane.mCommissioner->RegisterPairingDelegate(&lane);
+    }
+
+    mDelegate = params.delegate;
+
+    ChipLogProgress(Controller, "Bulk commissioning %u devices, %u at a time", static_cast<unsigned>(mRemaining),
+                    static_cast<unsigned>(mLaneCount));
+
+    CHIP_ERROR err = GetResolver().Init(udpEndPointManager);
+    if (err == CHIP_NO_ERROR)
+    {
+        GetResolver().SetCommissioningDelegate(this);
+        err = Browse();
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mSystemLayer->StartTimer(kRediscoveryInterval, DiscoveryTimerCallback, this);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        for (size_t i = 0; i < mLaneCount; i++)
+        {
+            mLanes[i].mCommissioner->RegisterPairingDelegate(mLanes[i].mPreviousDelegate);
+        }
+        GetResolver().Shutdown();
+        mDelegate = nullptr;
+        return err;
+    }
+
+    // Nothing to do for an empty batch, but the delegate still gets its report.
+    if (mRemaining == 0)
+    {
+        ScheduleDispatch();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void BulkCommissioner::Stop()
+{
+    VerifyOrReturn(IsRunning());
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+        if (lane.mDevice != nullptr && !lane.mFinished)
+        {
+            StopPairing(*lane.mCommissioner, lane.mDevice->nodeId);
+            lane.mFinished    = true;
+            lane.mError       = CHIP_ERROR_CANCELLED;
+            lane.mFailedStage = GetCommissioningStage(*lane.mCommissioner);
+        }
+    }
+
+    for (auto & device : mDevices)
+    {
+        if (device.mState == BulkCommissioningDevice::State::kDiscovering ||
+            device.mState == BulkCommissioningDevice::State::kQueued)
+        {
+            CompleteDevice(device, CHIP_ERROR_CANCELLED, CommissioningStage::kError);
+        }
+    }
+
+    Dispatch();
+}
+
+CHIP_ERROR BulkCommissioner::Browse()
+{
+    // A single browse for everything in commissioning mode serves all devices; matching against the setup codes happens
+    // in OnNodeDiscovered.
+    return GetResolver().DiscoverCommissionableNodes(Dnssd::DiscoveryFilter(Dnssd::DiscoveryFilterType::kCommissioningMode));
+}
+
+void BulkCommissioner::OnNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData)
+{
+    VerifyOrReturn(IsRunning());
+    VerifyOrReturn(nodeData.commissionData.commissioningMode != 0 && nodeData.resolutionData.IsValid());
+
+    // Devices keep answering queries until they are commissioned; a host that was already claimed must not be matched
+    // again, in particular not by another device sharing its discriminator.
+    for (const auto & device : mDevices)
+    {
+        if (device.mState != BulkCommissioningDevice::State::kDiscovering &&
+            strcmp(device.mHostName, nodeData.resolutionData.hostName) == 0)
+        {
+            return;
+        }
+    }
+
+    for (auto & device : mDevices)
+    {
+        if (device.mState != BulkCommissioningDevice::State::kDiscovering ||
+            !device.mDiscriminator.MatchesLongDiscriminator(nodeData.commissionData.longDiscriminator) ||
+            device.HasTriedHost(nodeData.resolutionData.hostName))
+        {
+            continue;
+        }
+
+        const Inet::IPAddress & address = nodeData.resolutionData.ipAddress[0];
+        Inet::InterfaceId interfaceId =
+            address.IsIPv6LinkLocal() ? nodeData.resolutionData.interfaceId : Inet::InterfaceId::Null();
+        device.mPeerAddress = Transport::PeerAddress::UDP(address, nodeData.resolutionData.port, interfaceId);
+        Platform::CopyString(device.mHostName, nodeData.resolutionData.hostName);
+
+        device.mState    = BulkCommissioningDevice::State::kQueued;
+        device.mLastMark = System::SystemClock().GetMonotonicTimestamp();
+        if (device.mTriedHostCount == 0)
+        {
+            device.timings.discovery = Since(mStartTime);
+        }
+
+        ChipLogProgress(Controller, "Bulk commissioning: discovered node 0x" ChipLogFormatX64 " at %s",
+                        ChipLogValueX64(device.nodeId), device.mHostName);
+
+        Dispatch();
+        return;
+    }
+}
+
+void BulkCommissioner::StartOnLane(Lane & lane, BulkCommissioningDevice & device)
+{
+    MarkStage(device, device.timings.queued);
+
+    lane.mDevice      = &device;
+    lane.mFinished    = false;
+    lane.mError       = CHIP_NO_ERROR;
+    lane.mFailedStage = CommissioningStage::kError;
+    device.mState     = BulkCommissioningDevice::State::kCommissioning;
+
+    RendezvousParameters rendezvousParams;
+    rendezvousParams.SetPeerAddress(device.mPeerAddress).SetSetupPINCode(device.mSetUpPINCode);
+    CommissioningParameters commissioningParams = mCommissioningParameters;
+
+    // The commissioner may call back synchronously, e.g. when PASE cannot even be started.
+    CHIP_ERROR err = PairDevice(*lane.mCommissioner, device.nodeId, rendezvousParams, commissioningParams);
+    if (err != CHIP_NO_ERROR && !lane.mFinished)
+    {
+        lane.mFinished    = true;
+        lane.mError       = err;
+        lane.mFailedStage = CommissioningStage::kSecurePairing;
+    }
+    if (lane.mFinished)
+    {
+        ScheduleDispatch();
+    }
+}
+
+void BulkCommissioner::MarkStage(BulkCommissioningDevice & device, System::Clock::Milliseconds32 & duration)
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    duration += std::chrono::duration_cast<System::Clock::Milliseconds32>(now - device.mLastMark);
+    device.mLastMark = now;
+}
+
+void BulkCommissioner::CompleteDevice(BulkCommissioningDevice & device, CHIP_ERROR error, CommissioningStage failedStage)
+{
+    device.mState        = BulkCommissioningDevice::State::kDone;
+    device.error         = error;
+    device.failedStage   = error == CHIP_NO_ERROR ? CommissioningStage::kError : failedStage;
+    device.timings.total = Since(mStartTime);
+    mRemaining--;
+
+    if (error == CHIP_NO_ERROR)
+    {
+        ChipLogProgress(Controller, "Bulk commissioning: node 0x" ChipLogFormatX64 " commissioned in %" PRIu32 " ms",
+                        ChipLogValueX64(device.nodeId), device.timings.total.count());
+    }
+    else
+    {
+        ChipLogError(Controller, "Bulk commissioning: node 0x" ChipLogFormatX64 " failed in stage %s: %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(device.nodeId), StageToString(device.failedStage), error.Format());
+    }
+
+    mDelegate->OnDeviceCommissioningComplete(device);
+}
+
+bool BulkCommissioner::RetryDevice(BulkCommissioningDevice & device, CHIP_ERROR error, CommissioningStage failedStage)
+{
+    // Failing PASE with our PIN is what tells that the host may belong to another device sharing the discriminator.
+    VerifyOrReturnValue(error != CHIP_NO_ERROR && error != CHIP_ERROR_CANCELLED &&
+                            failedStage == CommissioningStage::kSecurePairing,
+                        false);
+    VerifyOrReturnValue(device.mTriedHostCount < kBulkCommissioningMaxHostsPerDevice && SharesDiscriminator(device), false);
+
+    // Keep mHostName: the device was discovered, and the host is free for the other devices once we leave kQueued.
+    Platform::CopyString(device.mTriedHosts[device.mTriedHostCount++], device.mHostName);
+    device.mPairingError = error;
+    device.mState        = BulkCommissioningDevice::State::kDiscovering;
+    device.mLastMark     = System::SystemClock().GetMonotonicTimestamp();
+
+    ChipLogProgress(Controller, "Bulk commissioning: PASE with node 0x" ChipLogFormatX64 " failed at %s, looking for another host",
+                    ChipLogValueX64(device.nodeId), device.mHostName);
+
+    // The discovery timer stops once no device is discovering.
+    LogErrorOnFailure(Browse());
+    LogErrorOnFailure(mSystemLayer->StartTimer(kRediscoveryInterval, DiscoveryTimerCallback, this));
+    return true;
+}
+
+bool BulkCommissioner::SharesDiscriminator(const BulkCommissioningDevice & device) const
+{
+    for (const auto & other : mDevices)
+    {
+        if (&other == &device)
+        {
+            continue;
+        }
+        // A manual pairing code only carries the upper bits of the discriminator.
+        bool shortOnly = device.mDiscriminator.IsShortDiscriminator() || other.mDiscriminator.IsShortDiscriminator();
+        if (shortOnly ? device.mDiscriminator.GetShortValue() == other.mDiscriminator.GetShortValue()
+                      : device.mDiscriminator.GetLongValue() == other.mDiscriminator.GetLongValue())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BulkCommissioner::ScheduleDispatch()
+{
+    VerifyOrReturn(!mDispatchScheduled);
+    mDispatchScheduled = (mSystemLayer->ScheduleWork(DispatchCallback, this) == CHIP_NO_ERROR);
+}
+
+void BulkCommissioner::DispatchCallback(System::Layer * layer, void * context)
+{
+    auto * self              = static_cast<BulkCommissioner *>(context);
+    self->mDispatchScheduled = false;
+    VerifyOrReturn(self->IsRunning());
+    self->Dispatch();
+}
+
+void BulkCommissioner::Dispatch()
+{
+    // Release the lanes whose commissioner is done. This runs outside of the commissioner callbacks, so the commissioner
+    // has finished tearing down its commissionee by now and can take the next one.
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+        if (lane.mDevice != nullptr && lane.mFinished)
+        {
+            BulkCommissioningDevice & device = *lane.mDevice;
+            lane.mDevice                     = nullptr;
+            if (!RetryDevice(device, lane.mError, lane.mFailedStage))
+            {
+                CompleteDevice(device, lane.mError, lane.mFailedStage);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+        if (lane.mDevice != nullptr)
+        {
+            continue;
+        }
+        for (auto & device : mDevices)
+        {
+            if (device.mState == BulkCommissioningDevice::State::kQueued)
+            {
+                StartOnLane(lane, device);
+                break;
+            }
+        }
+    }
+
+    if (mRemaining == 0)
+    {
+        Finish();
+    }
+}
+
+void BulkCommissioner::Finish()
+{
+    mSystemLayer->CancelTimer(DiscoveryTimerCallback, this);
+    mSystemLayer->CancelTimer(DispatchCallback, this);
+    mDispatchScheduled = false;
+    GetResolver().Shutdown();
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        mLanes[i].mCommissioner->RegisterPairingDelegate(mLanes[i].mPreviousDelegate);
+    }
+
+    BulkCommissioningReport report;
+    report.elapsed = Since(mStartTime);
+    for (const auto & device : mDevices)
+    {
+        if (device.error == CHIP_NO_ERROR)
+        {
+            report.succeeded++;
+        }
+        else
+        {
+            report.failed++;
+        }
+
+        // Only devices that were discovered have a host name.
+        if (device.mHostName[0] != '\0')
+        {
+            report.discovery.Add(device.timings.discovery);
+            report.queued.Add(device.timings.queued);
+        }
+        for (size_t i = 0; i < kCommissioningStageCount; i++)
+        {
+            if (device.timings.stages[i] > System::Clock::kZero)
+            {
+                report.stages[i].Add(device.timings.stages[i]);
+            }
+        }
+    }
+
+    // Clear the delegate first so that it may start another bulk commissioning from its callback.
+    BulkCommissioningDelegate * delegate = mDelegate;
+    mDelegate                            = nullptr;
+    delegate->OnBulkCommissioningComplete(report);
+}
+
+void BulkCommissioner::DiscoveryTimerCallback(System::Layer * layer, void * context)
+{
+    auto * self = static_cast<BulkCommissioner *>(context);
+    VerifyOrReturn(self->IsRunning());
+
+    bool discovering = false;
+    bool expired     = System::SystemClock().GetMonotonicTimestamp() >= self->mDiscoveryDeadline;
+    for (auto & device : self->mDevices)
+    {
+        if (device.mState != BulkCommissioningDevice::State::kDiscovering)
+        {
+            continue;
+        }
+        if (expired && device.mPairingError != CHIP_NO_ERROR)
+        {
+            // No other host showed up for a device that went back to discovery.
+            self->CompleteDevice(device, device.mPairingError, CommissioningStage::kSecurePairing);
+        }
+        else if (expired)
+        {
+            device.timings.discovery = Since(self->mStartTime);
+            self->CompleteDevice(device, CHIP_ERROR_TIMEOUT, CommissioningStage::kError);
+        }
+        else
+        {
+            discovering = true;
+        }
+    }
+
+    if (discovering)
+    {
+        LogErrorOnFailure(self->Browse());
+        LogErrorOnFailure(layer->StartTimer(kRediscoveryInterval, DiscoveryTimerCallback, self));
+    }
+    else if (self->mRemaining == 0)
+    {
+        self->Finish();
+    }
+}
+
+void BulkCommissioner::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    VerifyOrReturn(mDevice != nullptr && !mFinished);
+
+    mOwner->MarkStage(*mDevice, mDevice->timings.stages[CommissioningStage::kSecurePairing]);
+    if (error != CHIP_NO_ERROR)
+    {
+        mFinished    = true;
+        mError       = error;
+        mFailedStage = CommissioningStage::kSecurePairing;
+        mOwner->ScheduleDispatch();
+    }
+}
+
+void BulkCommissioner::Lane::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    VerifyOrReturn(mDevice != nullptr && !mFinished && peerId.GetNodeId() == mDevice->nodeId);
+    VerifyOrReturn(stageCompleted < kCommissioningStageCount);
+
+    mOwner->MarkStage(*mDevice, mDevice->timings.stages[stageCompleted]);
+}
+
+void BulkCommissioner::Lane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(mDevice != nullptr && !mFinished && deviceId == mDevice->nodeId);
+
+    mFinished = true;
+    mError    = error;
+    // OnCommissioningFailure, which follows for failures, fills in the stage.
+    mFailedStage = CommissioningStage::kError;
+    mOwner->ScheduleDispatch();
+}
+
+void BulkCommissioner::Lane::OnCommissioningFailure(PeerId peerId, CHIP_ERROR error, CommissioningStage stageFailed,
+                                                    Optional<Credentials::AttestationVerificationResult> additionalErrorInfo)
+{
+    VerifyOrReturn(mDevice != nullptr && peerId.GetNodeId() == mDevice->nodeId);
+
+    mFailedStage = stageFailed;
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,283 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Commissioning of many devices at once, e.g. on a factory floor.
+ *
+ *      A DeviceCommissioner drives a single commissionee through the CommissioningStage sequence at a time, so the
+ *      BulkCommissioner runs several of them side by side (typically created on the same fabric with
+ *      permitMultiControllerFabrics). A single DNS-SD browse finds every device in commissioning mode; each discovered
+ *      device is queued and handed, together with its setup PIN, to the next free commissioner, which then runs PASE,
+ *      attestation, NOC issuance and the remaining stages for it. Per-stage timings are recorded for every device and
+ *      aggregated into a report once all devices are done.
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/dnssd/Resolver.h>
+#include <lib/dnssd/ResolverProxy.h>
+#include <lib/support/SetupDiscriminator.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <transport/raw/PeerAddress.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+class BulkCommissioner;
+
+static constexpr size_t kCommissioningStageCount = CommissioningStage::kNeedsNetworkCreds + 1;
+
+// Hosts a device whose discriminator collides with another one may be matched to before PASE succeeds on its own.
+static constexpr size_t kBulkCommissioningMaxHostsPerDevice = 4;
+
+struct BulkCommissioningTimings
+{
+    // From BulkCommissioner::Start until the device was first seen on DNS-SD.
+    System::Clock::Milliseconds32 discovery = System::Clock::kZero;
+    // From discovery until a commissioner was free to take the device.
+    System::Clock::Milliseconds32 queued = System::Clock::kZero;
+    // Time spent in each commissioning stage; kSecurePairing is PASE establishment.
+    System::Clock::Milliseconds32 stages[kCommissioningStageCount] = {};
+    // From BulkCommissioner::Start until the device was done, successfully or not.
+    System::Clock::Milliseconds32 total = System::Clock::kZero;
+};
+
+/**
+ * One device to commission. The caller fills in setUpCode and nodeId; the BulkCommissioner fills in the results.
+ */
+struct BulkCommissioningDevice
+{
+    // QR code or manual pairing code of the device.
+    const char * setUpCode = nullptr;
+    // Operational node ID to assign to the device.
+    NodeId nodeId = kUndefinedNodeId;
+
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    // Stage that failed when error is set. kError means the device was never discovered.
+    CommissioningStage failedStage = CommissioningStage::kError;
+    BulkCommissioningTimings timings;
+
+private:
+    friend class BulkCommissioner;
+
+    enum class State : uint8_t
+    {
+        kIdle,
+        kDiscovering,
+        kQueued,
+        kCommissioning,
+        kDone,
+    };
+
+    bool HasTriedHost(const char * hostName) const;
+
+    State mState           = State::kIdle;
+    uint32_t mSetUpPINCode = 0;
+    SetupDiscriminator mDiscriminator;
+    Transport::PeerAddress mPeerAddress;
+    char mHostName[Dnssd::kHostNameMaxLength + 1] = {};
+    System::Clock::Timestamp mLastMark            = System::Clock::kZero;
+    // Hosts PASE failed on with the PIN of this device, which are not matched to it again, and the last failure, reported
+    // if no other host is found for the device.
+    char mTriedHosts[kBulkCommissioningMaxHostsPerDevice][Dnssd::kHostNameMaxLength + 1] = {};
+    uint8_t mTriedHostCount                                                              = 0;
+    CHIP_ERROR mPairingError                                                             = CHIP_NO_ERROR;
+};
+
+struct BulkCommissioningStageStatistics
+{
+    uint32_t count                      = 0;
+    System::Clock::Milliseconds32 total = System::Clock::kZero;
+    System::Clock::Milliseconds32 max   = System::Clock::kZero;
+
+    System::Clock::Milliseconds32 Average() const
+    {
+        return count == 0 ? System::Clock::kZero : System::Clock::Milliseconds32(total.count() / count);
+    }
+
+    void Add(System::Clock::Milliseconds32 duration)
+    {
+        count++;
+        total += duration;
+        max = std::max(max, duration);
+    }
+};
+
+struct BulkCommissioningReport
+{
+    size_t succeeded                      = 0;
+    size_t failed                         = 0;
+    System::Clock::Milliseconds32 elapsed = System::Clock::kZero;
+
+    BulkCommissioningStageStatistics discovery;
+    BulkCommissioningStageStatistics queued;
+    BulkCommissioningStageStatistics stages[kCommissioningStageCount];
+
+    /**
+     * Log the throughput and the per-stage statistics.
+     */
+    void Log() const;
+};
+
+class DLL_EXPORT BulkCommissioningDelegate
+{
+public:
+    virtual ~BulkCommissioningDelegate() {}
+
+    /**
+     * Called once per device when it has been commissioned or has failed; see device.error.
+     */
+    virtual void OnDeviceCommissioningComplete(const BulkCommissioningDevice & device) {}
+
+    /**
+     * Called once every device is done. The commissioners are back to their previous pairing delegates and may be used
+     * (or handed to another BulkCommissioner::Start) from within this callback.
+     */
+    virtual void OnBulkCommissioningComplete(const BulkCommissioningReport & report) = 0;
+};
+
+struct BulkCommissioningParameters
+{
+    // Commissioners to run devices on. They must not be used for anything else until the bulk commissioning completes.
+    Span<DeviceCommissioner *> commissioners;
+    // Maximum number of devices commissioned at the same time; 0 means one per commissioner.
+    size_t parallelism = 0;
+    // Devices to commission. Must outlive the bulk commissioning.
+    Span<BulkCommissioningDevice> devices;
+    // Applied to every device (network credentials, attestation delegate, ...).
+    CommissioningParameters commissioningParameters;
+    // Devices not seen on DNS-SD within this time fail with CHIP_ERROR_TIMEOUT.
+    System::Clock::Seconds16 discoveryTimeout = System::Clock::Seconds16(120);
+    BulkCommissioningDelegate * delegate      = nullptr;
+    // Layer to run the timers on; defaults to the system layer of the DeviceControllerFactory.
+    System::Layer * systemLayer = nullptr;
+};
+
+/**
+ * Commissions a list of devices identified by their setup codes over the network, running up to one device per
+ * DeviceCommissioner concurrently.
+ *
+ * While a bulk commissioning is running the BulkCommissioner owns commissionable node discovery: other commissioners in
+ * the process must not call DiscoverCommissionableNodes or pair by setup code at the same time.
+ *
+ * A discovered host is matched to a device by discriminator, which several devices of a batch may share. When PASE fails
+ * on a host, the device may have been matched to the host of another one: unless no other device shares its
+ * discriminator, it goes back to discovery, and is matched to hosts it did not try yet. It fails with the PASE error if
+ * it runs out of hosts to try, or if no other host shows up before the discovery timeout.
+ */
+class DLL_EXPORT BulkCommissioner : public Dnssd::CommissioningResolveDelegate
+{
+public:
+    static constexpr size_t kMaxParallelism = CHIP_CONFIG_BULK_COMMISSIONING_MAX_PARALLELISM;
+
+    // resolver defaults to the DNS-SD resolver of the platform.
+    BulkCommissioner(Dnssd::Resolver * resolver = nullptr) : mResolver(resolver) {}
+    ~BulkCommissioner() override;
+
+    /**
+     * Start commissioning params.devices. Returns CHIP_ERROR_INVALID_ARGUMENT if a setup code cannot be parsed or a node
+     * ID is invalid, and CHIP_ERROR_INCORRECT_STATE if a bulk commissioning is already running.
+     */
+    CHIP_ERROR Start(const BulkCommissioningParameters & params);
+
+    /**
+     * Abort the bulk commissioning. Devices that are not done yet fail with CHIP_ERROR_CANCELLED and the delegate is
+     * notified as if they had completed.
+     */
+    void Stop();
+
+    bool IsRunning() const { return mDelegate != nullptr; }
+
+    // Dnssd::CommissioningResolveDelegate
+    void OnNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData) override;
+
+protected:
+    // The operations run on the commissioners, which tests override.
+    virtual CHIP_ERROR PairDevice(DeviceCommissioner & commissioner, NodeId nodeId, RendezvousParameters & rendezvousParams,
+                                  CommissioningParameters & commissioningParams)
+    {
+        return commissioner.PairDevice(nodeId, rendezvousParams, commissioningParams);
+    }
+    virtual void StopPairing(DeviceCommissioner & commissioner, NodeId nodeId) { commissioner.StopPairing(nodeId); }
+    virtual CommissioningStage GetCommissioningStage(DeviceCommissioner & commissioner)
+    {
+        return commissioner.GetCommissioningStage();
+    }
+
+private:
+    // One commissioner working on at most one device; intercepts its pairing delegate callbacks for the duration.
+    class Lane : public DevicePairingDelegate
+    {
+    public:
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+        void OnCommissioningFailure(PeerId peerId, CHIP_ERROR error, CommissioningStage stageFailed,
+                                    Optional<Credentials::AttestationVerificationResult> additionalErrorInfo) override;
+
+        BulkCommissioner * mOwner                 = nullptr;
+        DeviceCommissioner * mCommissioner        = nullptr;
+        DevicePairingDelegate * mPreviousDelegate = nullptr;
+        BulkCommissioningDevice * mDevice         = nullptr;
+        // Set once the commissioner is done with mDevice; the device is completed by the next Dispatch.
+        bool mFinished                  = false;
+        CHIP_ERROR mError               = CHIP_NO_ERROR;
+        CommissioningStage mFailedStage = CommissioningStage::kError;
+    };
+
+    void StartOnLane(Lane & lane, BulkCommissioningDevice & device);
+    void CompleteDevice(BulkCommissioningDevice & device, CHIP_ERROR error, CommissioningStage failedStage);
+    bool RetryDevice(BulkCommissioningDevice & device, CHIP_ERROR error, CommissioningStage failedStage);
+    bool SharesDiscriminator(const BulkCommissioningDevice & device) const;
+    void MarkStage(BulkCommissioningDevice & device, System::Clock::Milliseconds32 & duration);
+    void ScheduleDispatch();
+    void Dispatch();
+    void Finish();
+    CHIP_ERROR Browse();
+    Dnssd::Resolver & GetResolver() { return mResolver != nullptr ? *mResolver : mDNSResolver; }
+
+    static void DispatchCallback(System::Layer * layer, void * context);
+    static void DiscoveryTimerCallback(System::Layer * layer, void * context);
+
+    System::Layer * mSystemLayer          = nullptr;
+    BulkCommissioningDelegate * mDelegate = nullptr;
+    Span<BulkCommissioningDevice> mDevices;
+    CommissioningParameters mCommissioningParameters;
+    System::Clock::Timestamp mStartTime         = System::Clock::kZero;
+    System::Clock::Timestamp mDiscoveryDeadline = System::Clock::kZero;
+    size_t mRemaining                           = 0;
+    bool mDispatchScheduled                     = false;
+
+    Lane mLanes[kMaxParallelism];
+    size_t mLaneCount = 0;
+
+    Dnssd::Resolver * mResolver = nullptr;
+    Dnssd::ResolverProxy mDNSResolver;
+};
+
+} // namespace Controller
+} // namespace chip
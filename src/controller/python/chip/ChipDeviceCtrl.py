@@ -70,6 +70,10 @@ _IssueNOCChainCallbackPythonCallbackFunct = CFUNCTYPE(
 
 _ChipDeviceController_IterateDiscoveredCommissionableNodesFunct = CFUNCTYPE(None, c_char_p, c_size_t)
 
+# Size of the native OperationalSessionSetupPool (CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES): establishing more CASE sessions than
+# this at once fails with CHIP_ERROR_NO_MEMORY.
+_DEFAULT_MAX_CONCURRENT_OPERATIONS = 64
+
 
 @dataclass
 class NOCChain:
@@ -235,6 +239,11 @@ class ChipDeviceController():
         self._fabricId = fabricId
         self._nodeId = nodeId
         self._caIndex = fabricAdmin.caIndex
+        self._maxConcurrentOperations = _DEFAULT_MAX_CONCURRENT_OPERATIONS
+        self._operationSlots = None
+        self._operationSlotsLoop = None
+        # Keeps the ctypes callbacks of pending session establishments alive until the native side calls them.
+        self._pendingDeviceCallbacks = {}
 
         if name is None:
             self._name = "caIndex(%x)/fabricId(0x%016X)/nodeId(0x%016X)" % (fabricAdmin.caIndex, fabricId, nodeId)
@@ -860,6 +869,96 @@ class ChipDeviceController():
 
         return DeviceProxyWrapper(returnDevice, self._dmLib)
 
+    async def GetConnectedDevice(self, nodeid, allowPASE: bool = True, timeoutMs: int = None):
+        ''' Returns DeviceProxyWrapper upon success.
+
+            Unlike GetConnectedDeviceSync, the event loop keeps running while the session is being established, so sessions
+            to many nodes can be set up concurrently. Counts against SetMaxConcurrentOperations.
+        '''
+        self.CheckIsActive()
+
+        async with self._OperationSlots():
+            return await self._GetConnectedDevice(nodeid, allowPASE, timeoutMs)
+
+    async def _GetConnectedDevice(self, nodeid, allowPASE: bool = True, timeoutMs: int = None):
+        if allowPASE:
+            returnDevice = c_void_p(None)
+            res = await self._ChipStack.CallOnChipThreadAsync(lambda: self._dmLib.pychip_GetDeviceBeingCommissioned(
+                self.devCtrl, nodeid, byref(returnDevice)))
+            if res == 0:
+                return DeviceProxyWrapper(returnDevice)
+
+        eventLoop = asyncio.get_running_loop()
+        future = eventLoop.create_future()
+
+        def HandleDeviceAvailable(device, err):
+            self._pendingDeviceCallbacks.pop(id(DeviceAvailableCallback), None)
+            # Wrapping the proxy right away also releases it if the caller timed out in the meantime.
+            returnDevice = DeviceProxyWrapper(c_void_p(device), self._dmLib) if device else None
+            if future.done():
+                return
+            if returnDevice is None:
+                future.set_exception(self._ChipStack.ErrorToException(err))
+            else:
+                future.set_result(returnDevice)
+
+        @_DeviceAvailableFunct
+        def DeviceAvailableCallback(device, err):
+            eventLoop.call_soon_threadsafe(HandleDeviceAvailable, device, err)
+
+        self._pendingDeviceCallbacks[id(DeviceAvailableCallback)] = DeviceAvailableCallback
+        res = await self._ChipStack.CallOnChipThreadAsync(lambda: self._dmLib.pychip_GetConnectedDeviceByNodeId(
+            self.devCtrl, nodeid, DeviceAvailableCallback))
+        if res != 0:
+            self._pendingDeviceCallbacks.pop(id(DeviceAvailableCallback), None)
+            raise self._ChipStack.ErrorToException(res)
+
+        try:
+            return await asyncio.wait_for(future, float(timeoutMs) / 1000 if timeoutMs else None)
+        except asyncio.TimeoutError:
+            raise TimeoutError("Timed out waiting for DNS-SD resolution")
+
+    def SetMaxConcurrentOperations(self, count: int):
+        ''' Bounds how many session establishments, reads, subscriptions, writes and invokes this controller has in flight at
+            once; further ones wait for a slot. The default matches the size of the native session setup pool.
+        '''
+        if count < 1:
+            raise ValueError("count must be at least 1")
+        self._maxConcurrentOperations = count
+        # Operations already in flight hold on to the previous semaphore.
+        self._operationSlots = None
+
+    def _OperationSlots(self) -> asyncio.Semaphore:
+        eventLoop = asyncio.get_running_loop()
+        if self._operationSlots is None or self._operationSlotsLoop is not eventLoop:
+            self._operationSlots = asyncio.Semaphore(self._maxConcurrentOperations)
+            self._operationSlotsLoop = eventLoop
+        return self._operationSlots
+
+    async def RunOnNodes(self, nodeids: typing.Iterable[int], operation: typing.Callable[[int], typing.Awaitable], maxConcurrency: int = None) -> typing.Dict[int, typing.Any]:
+        '''
+        Run operation(nodeid) for all nodes concurrently. Returns a dict mapping each node ID to the result of its operation, or
+        to the exception it raised so that one unreachable node does not hide the results of the others.
+
+        maxConcurrency: Bounds the number of nodes worked on at once, on top of SetMaxConcurrentOperations.
+
+        E.g
+            await devCtrl.RunOnNodes(nodeIds, lambda nodeid: devCtrl.ReadAttribute(nodeid, [Clusters.Basic]))
+        '''
+        self.CheckIsActive()
+
+        nodeids = list(nodeids)
+        limit = asyncio.Semaphore(maxConcurrency) if maxConcurrency else None
+
+        async def RunOnNode(nodeid):
+            if limit is None:
+                return await operation(nodeid)
+            async with limit:
+                return await operation(nodeid)
+
+        results = await asyncio.gather(*[RunOnNode(nodeid) for nodeid in nodeids], return_exceptions=True)
+        return dict(zip(nodeids, results))
+
     def ComputeRoundTripTimeout(self, nodeid, upperLayerProcessingTimeoutMs: int = 0):
         ''' Returns a computed timeout value based on the round-trip time it takes for the peer at the other end of the session to
             receive a message, process it and send it back. This is computed based on the session type, the type of transport, sleepy
@@ -888,16 +987,17 @@ class ChipDeviceController():
         eventLoop = asyncio.get_running_loop()
         future = eventLoop.create_future()
 
-        device = self.GetConnectedDeviceSync(nodeid, timeoutMs=interactionTimeoutMs)
-        res = ClusterCommand.SendCommand(
-            future, eventLoop, responseType, device.deviceProxy, ClusterCommand.CommandPath(
-                EndpointId=endpoint,
-                ClusterId=payload.cluster_id,
-                CommandId=payload.command_id,
-            ), payload, timedRequestTimeoutMs=timedRequestTimeoutMs, interactionTimeoutMs=interactionTimeoutMs)
-        if res != 0:
-            future.set_exception(self._ChipStack.ErrorToException(res))
-        return await future
+        async with self._OperationSlots():
+            device = await self._GetConnectedDevice(nodeid, timeoutMs=interactionTimeoutMs)
+            res = ClusterCommand.SendCommand(
+                future, eventLoop, responseType, device.deviceProxy, ClusterCommand.CommandPath(
+                    EndpointId=endpoint,
+                    ClusterId=payload.cluster_id,
+                    CommandId=payload.command_id,
+                ), payload, timedRequestTimeoutMs=timedRequestTimeoutMs, interactionTimeoutMs=interactionTimeoutMs)
+            if res != 0:
+                future.set_exception(self._ChipStack.ErrorToException(res))
+            return await future
 
     async def WriteAttribute(self, nodeid: int, attributes: typing.List[typing.Tuple[int, ClusterObjects.ClusterAttributeDescriptor, int]], timedRequestTimeoutMs: int = None, interactionTimeoutMs: int = None):
         '''
@@ -917,8 +1017,6 @@ class ChipDeviceController():
         eventLoop = asyncio.get_running_loop()
         future = eventLoop.create_future()
 
-        device = self.GetConnectedDeviceSync(nodeid, timeoutMs=interactionTimeoutMs)
-
         attrs = []
         for v in attributes:
             if len(v) == 2:
@@ -928,11 +1026,13 @@ class ChipDeviceController():
                 attrs.append(ClusterAttribute.AttributeWriteRequest(
                     v[0], v[1], v[2], 1, v[1].value))
 
-        res = ClusterAttribute.WriteAttributes(
-            future, eventLoop, device.deviceProxy, attrs, timedRequestTimeoutMs=timedRequestTimeoutMs, interactionTimeoutMs=interactionTimeoutMs)
-        if res != 0:
-            raise self._ChipStack.ErrorToException(res)
-        return await future
+        async with self._OperationSlots():
+            device = await self._GetConnectedDevice(nodeid, timeoutMs=interactionTimeoutMs)
+            res = ClusterAttribute.WriteAttributes(
+                future, eventLoop, device.deviceProxy, attrs, timedRequestTimeoutMs=timedRequestTimeoutMs, interactionTimeoutMs=interactionTimeoutMs)
+            if res != 0:
+                raise self._ChipStack.ErrorToException(res)
+            return await future
 
     def _parseAttributePathTuple(self, pathTuple: typing.Union[
         None,  # Empty tuple, all wildcard
@@ -1102,7 +1202,6 @@ class ChipDeviceController():
         eventLoop = asyncio.get_running_loop()
         future = eventLoop.create_future()
 
-        device = self.GetConnectedDeviceSync(nodeid)
         attributePaths = [self._parseAttributePathTuple(
             v) for v in attributes] if attributes else None
         clusterDataVersionFilters = [self._parseDataVersionFilterTuple(
@@ -1110,11 +1209,13 @@ class ChipDeviceController():
         eventPaths = [self._parseEventPathTuple(
             v) for v in events] if events else None
 
-        res = ClusterAttribute.Read(future=future, eventLoop=eventLoop, device=device.deviceProxy, devCtrl=self, attributes=attributePaths, dataVersionFilters=clusterDataVersionFilters, events=eventPaths, returnClusterObject=returnClusterObject,
-                                    subscriptionParameters=ClusterAttribute.SubscriptionParameters(reportInterval[0], reportInterval[1]) if reportInterval else None, fabricFiltered=fabricFiltered, keepSubscriptions=keepSubscriptions)
-        if res != 0:
-            raise self._ChipStack.ErrorToException(res)
-        return await future
+        async with self._OperationSlots():
+            device = await self._GetConnectedDevice(nodeid)
+            res = ClusterAttribute.Read(future=future, eventLoop=eventLoop, device=device.deviceProxy, devCtrl=self, attributes=attributePaths, dataVersionFilters=clusterDataVersionFilters, events=eventPaths, returnClusterObject=returnClusterObject,
+                                        subscriptionParameters=ClusterAttribute.SubscriptionParameters(reportInterval[0], reportInterval[1]) if reportInterval else None, fabricFiltered=fabricFiltered, keepSubscriptions=keepSubscriptions)
+            if res != 0:
+                raise self._ChipStack.ErrorToException(res)
+            return await future
 
     async def ReadAttribute(self, nodeid: int, attributes: typing.List[typing.Union[
         None,  # Empty tuple, all wildcard
@@ -26,6 +26,7 @@
 
 from __future__ import absolute_import
 from __future__ import print_function
+import asyncio
 import sys
 import os
 import time
@@ -400,6 +401,34 @@ class ChipStack(object):
             raise self.ErrorToException(res)
         return callObj
 
+    async def CallOnChipThreadAsync(self, callFunct):
+        '''Run a Python function on CHIP stack and await its result.
+        Unlike Call, this does not block the event loop or take the network lock while the task is pending, so any number of
+        these can be in flight at the same time. callFunct must not rely on callbackRes / completeEvent.
+        '''
+        eventLoop = asyncio.get_running_loop()
+        future = eventLoop.create_future()
+
+        def _SetResult(res, exc):
+            # The caller may have stopped waiting (e.g. timed out) in the meantime.
+            if future.done():
+                return
+            if exc is not None:
+                future.set_exception(exc)
+            else:
+                future.set_result(res)
+
+        def _Run():
+            try:
+                res = callFunct()
+            except Exception as ex:
+                eventLoop.call_soon_threadsafe(_SetResult, None, ex)
+            else:
+                eventLoop.call_soon_threadsafe(_SetResult, res, None)
+
+        self.PostTaskOnChipThread(_Run)
+        return await future
+
     def ErrorToException(self, err, devStatusPtr=None):
         if err == 0x2C and devStatusPtr:
             devStatus = devStatusPtr.contents
@@ -648,26 +648,45 @@ class AsyncReadTransaction:
     def GetAllEventValues(self):
         return self._events
 
-    def handleAttributeData(self, path: AttributePathWithListIndex, dataVersion: int, status: int, data: bytes):
+    def _updateAttribute(self, path: AttributePathWithListIndex, dataVersion: int, status: int, decodeValue):
+        imStatus = status
         try:
-            imStatus = status
-            try:
-                imStatus = chip.interaction_model.Status(status)
-            except:
-                pass
+            imStatus = chip.interaction_model.Status(status)
+        except:
+            pass
 
-            if (imStatus != chip.interaction_model.Status.Success):
-                attributeValue = ValueDecodeFailure(
-                    None, chip.interaction_model.InteractionModelError(imStatus))
-            else:
-                tlvData = chip.tlv.TLVReader(data).get().get("Any", {})
-                attributeValue = tlvData
+        if (imStatus != chip.interaction_model.Status.Success):
+            attributeValue = ValueDecodeFailure(
+                None, chip.interaction_model.InteractionModelError(imStatus))
+        else:
+            attributeValue = decodeValue()
+
+        self._cache.UpdateTLV(path, dataVersion, attributeValue)
+        self._changedPathSet.add(path)
 
-            self._cache.UpdateTLV(path, dataVersion, attributeValue)
-            self._changedPathSet.add(path)
+    def handleAttributeData(self, path: AttributePathWithListIndex, dataVersion: int, status: int, data: bytes):
+        try:
+            self._updateAttribute(path, dataVersion, status,
+                                  lambda: chip.tlv.decode(data).get("Any", {}))
+        except Exception as ex:
+            logging.exception(ex)
 
+    def handleAttributeReport(self, report: bytes):
+        ''' Handles all the attributes of a report at once, as decoded by the native TLV decoder into a list of
+            (endpoint, cluster, attribute, dataVersion, status, value) tuples.
+        '''
+        try:
+            attributes = chip.tlv.loadNativeDecoding(report)
         except Exception as ex:
             logging.exception(ex)
+            return
+
+        for (endpoint, cluster, attribute, dataVersion, status, value) in attributes:
+            try:
+                self._updateAttribute(AttributePath(EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute),
+                                      dataVersion, status, lambda: value)
+            except Exception as ex:
+                logging.exception(ex)
 
     def handleEventData(self, header: EventHeader, path: EventPath, data: bytes, status: int):
         try:
@@ -676,7 +695,7 @@ class AsyncReadTransaction:
 
             if data:
                 # data will be an empty buffer when we received an EventStatusIB instead of an EventDataIB.
-                tlvData = chip.tlv.TLVReader(data).get().get("Any", {})
+                tlvData = chip.tlv.decode(data).get("Any", {})
 
                 if eventType is None:
                     eventValue = ValueDecodeFailure(
@@ -827,6 +846,8 @@ class AsyncWriteTransaction:
 
 _OnReadAttributeDataCallbackFunct = CFUNCTYPE(
     None, py_object, c_uint32, c_uint16, c_uint32, c_uint32, c_uint8, c_void_p, c_size_t)
+_OnReadAttributeReportCallbackFunct = CFUNCTYPE(
+    None, py_object, c_void_p, c_size_t)
 _OnSubscriptionEstablishedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32)
 _OnResubscriptionAttemptedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32, c_uint32)
 _OnReadEventDataCallbackFunct = CFUNCTYPE(
@@ -848,6 +869,11 @@ def _OnReadAttributeDataCallback(closure, dataVersion: int, endpoint: int, clust
         EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, dataBytes[:])
 
 
+@_OnReadAttributeReportCallbackFunct
+def _OnReadAttributeReportCallback(closure, data, len):
+    closure.handleAttributeReport(ctypes.string_at(data, len))
+
+
 @_OnReadEventDataCallbackFunct
 def _OnReadEventDataCallback(closure, endpoint: int, cluster: int, event: c_uint64, number: int, priority: int, timestamp: int, timestampType: int, data, len, status):
     dataBytes = ctypes.string_at(data, len)
@@ -1076,13 +1102,13 @@ def Init():
                    _OnWriteResponseCallbackFunct, _OnWriteErrorCallbackFunct, _OnWriteDoneCallbackFunct])
         handle.pychip_ReadClient_Read.restype = c_uint32
         setter.Set('pychip_ReadClient_InitCallbacks', None, [
-                   _OnReadAttributeDataCallbackFunct, _OnReadEventDataCallbackFunct, _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct, _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
+                   _OnReadAttributeDataCallbackFunct, _OnReadAttributeReportCallbackFunct, _OnReadEventDataCallbackFunct, _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct, _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
                    _OnReportBeginCallbackFunct, _OnReportEndCallbackFunct])
 
     handle.pychip_WriteClient_InitCallbacks(
         _OnWriteResponseCallback, _OnWriteErrorCallback, _OnWriteDoneCallback)
     handle.pychip_ReadClient_InitCallbacks(
-        _OnReadAttributeDataCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnResubscriptionAttemptedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
+        _OnReadAttributeDataCallback, _OnReadAttributeReportCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnResubscriptionAttemptedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
         _OnReportBeginCallback, _OnReportEndCallback)
 
     _BuildAttributeIndex()
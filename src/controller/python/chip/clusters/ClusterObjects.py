@@ -170,7 +170,7 @@ class ClusterObjectDescriptor:
         return ret
 
     def TLVToDict(self, tlvBuf: bytes) -> Dict[str, Any]:
-        tlvData = tlv.TLVReader(tlvBuf).get().get('Any', {})
+        tlvData = tlv.decode(tlvBuf).get('Any', {})
         return self.TagDictToLabelDict([], tlvData)
 
     def DictToTLVWithWriter(self, debugPath: str, tag, data: Mapping, writer: tlv.TLVWriter):
@@ -264,7 +264,7 @@ class ClusterAttributeDescriptor:
     @classmethod
     def FromTLV(cls, tlvBuffer: bytes):
         obj_class = cls._cluster_object
-        return obj_class.FromDict(obj_class.descriptor.TagDictToLabelDict('', {0: tlv.TLVReader(tlvBuffer).get().get('Any', {})})).Value
+        return obj_class.FromDict(obj_class.descriptor.TagDictToLabelDict('', {0: tlv.decode(tlvBuffer).get('Any', {})})).Value
 
     @classmethod
     def FromTagDictOrRawValue(cls, val: Any):
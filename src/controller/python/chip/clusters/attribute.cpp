@@ -26,6 +26,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/ReadClient.h>
 #include <app/WriteClient.h>
+#include <controller/python/chip/tlv/TLVToPickle.h>
 #include <lib/support/CodeUtils.h>
 
 #include <cstdio>
@@ -69,6 +70,7 @@ using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, chip::
                                              chip::ClusterId clusterId, chip::AttributeId attributeId,
                                              std::underlying_type_t<Protocols::InteractionModel::Status> imstatus, uint8_t * data,
                                              uint32_t dataLen);
+using OnReadAttributeReportCallback     = void (*)(PyObject * appContext, const uint8_t * data, size_t dataLen);
 using OnReadEventDataCallback           = void (*)(PyObject * appContext, chip::EndpointId endpointId, chip::ClusterId clusterId,
                                          chip::EventId eventId, chip::EventNumber eventNumber, uint8_t priority, uint64_t timestamp,
                                          uint8_t timestampType, uint8_t * data, uint32_t dataLen,
@@ -82,6 +84,7 @@ using OnReportBeginCallback             = void (*)(PyObject * appContext);
 using OnReportEndCallback               = void (*)(PyObject * appContext);
 
 OnReadAttributeDataCallback gOnReadAttributeDataCallback             = nullptr;
+OnReadAttributeReportCallback gOnReadAttributeReportCallback         = nullptr;
 OnReadEventDataCallback gOnReadEventDataCallback                     = nullptr;
 OnSubscriptionEstablishedCallback gOnSubscriptionEstablishedCallback = nullptr;
 OnResubscriptionAttemptedCallback gOnResubscriptionAttemptedCallback = nullptr;
@@ -109,6 +112,21 @@ public:
         // callback. If we do, that's a bug.
         //
         VerifyOrDie(!aPath.IsListItemOperation());
+
+        DataVersion version = 0;
+        if (aPath.mDataVersion.HasValue())
+        {
+            version = aPath.mDataVersion.Value();
+        }
+
+        // Inside a report, attributes are decoded natively and handed to Python all at once in OnReportEnd. Anything the
+        // native decoder does not handle takes the per-attribute path below, which decodes in Python.
+        if (mReportInProgress && gOnReadAttributeReportCallback != nullptr &&
+            AppendToAttributeReport(aPath, version, apData, aStatus) == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
         size_t bufferLen                  = (apData == nullptr ? 0 : apData->GetRemainingLength() + apData->GetLengthRead());
         std::unique_ptr<uint8_t[]> buffer = std::unique_ptr<uint8_t[]>(apData == nullptr ? nullptr : new uint8_t[bufferLen]);
         uint32_t size                     = 0;
@@ -130,12 +148,6 @@ public:
             size = writer.GetLengthWritten();
         }
 
-        DataVersion version = 0;
-        if (aPath.mDataVersion.HasValue())
-        {
-            version = aPath.mDataVersion.Value();
-        }
-
         gOnReadAttributeDataCallback(mAppContext, version, aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId,
                                      to_underlying(aStatus.mStatus), buffer.get(), size);
     }
@@ -194,7 +206,14 @@ public:
 
     void OnError(CHIP_ERROR aError) override { gOnReadErrorCallback(mAppContext, aError.AsInteger()); }
 
-    void OnReportBegin() override { gOnReportBeginCallback(mAppContext); }
+    void OnReportBegin() override
+    {
+        mAttributeReport.Begin();
+        mAttributeReport.StartList();
+        mAttributeReportCount = 0;
+        mReportInProgress     = true;
+        gOnReportBeginCallback(mAppContext);
+    }
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
     {
         if (aReadPrepareParams.mpAttributePathParamsList != nullptr)
@@ -213,10 +232,16 @@ public:
         }
     }
 
-    void OnReportEnd() override { gOnReportEndCallback(mAppContext); }
+    void OnReportEnd() override
+    {
+        FlushAttributeReport();
+        gOnReportEndCallback(mAppContext);
+    }
 
     void OnDone(ReadClient *) override
     {
+        // A report cut short by an error still delivers whatever attributes it carried, as it did before batching.
+        FlushAttributeReport();
         gOnReadDoneCallback(mAppContext);
 
         delete this;
@@ -225,10 +250,60 @@ public:
     void AdoptReadClient(std::unique_ptr<ReadClient> apReadClient) { mReadClient = std::move(apReadClient); }
 
 private:
+    /**
+     * Appends an (endpoint, cluster, attribute, data version, status, value) tuple to the pickled list of attributes of the
+     * current report. On failure nothing is appended.
+     */
+    CHIP_ERROR AppendToAttributeReport(const ConcreteDataAttributePath & aPath, DataVersion aVersion, TLV::TLVReader * apData,
+                                       const StatusIB & aStatus)
+    {
+        size_t checkpoint = mAttributeReport.Checkpoint();
+
+        mAttributeReport.StartTuple();
+        mAttributeReport.PutSigned(aPath.mEndpointId);
+        mAttributeReport.PutSigned(aPath.mClusterId);
+        mAttributeReport.PutSigned(aPath.mAttributeId);
+        mAttributeReport.PutSigned(aVersion);
+        mAttributeReport.PutSigned(to_underlying(aStatus.mStatus));
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        if (apData == nullptr)
+        {
+            mAttributeReport.PutNone();
+        }
+        else
+        {
+            err = mAttributeReport.PutValue(*apData);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            mAttributeReport.Rollback(checkpoint);
+            return err;
+        }
+        mAttributeReport.EndTuple();
+        mAttributeReport.Append();
+        mAttributeReportCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void FlushAttributeReport()
+    {
+        VerifyOrReturn(mReportInProgress);
+        mReportInProgress = false;
+        VerifyOrReturn(mAttributeReportCount > 0);
+
+        mAttributeReport.End();
+        gOnReadAttributeReportCallback(mAppContext, mAttributeReport.Data(), mAttributeReport.Length());
+        mAttributeReportCount = 0;
+    }
+
     BufferedReadCallback mBufferedReadCallback;
 
     PyObject * mAppContext;
 
+    python::TLVToPickle mAttributeReport;
+    size_t mAttributeReportCount = 0;
+    bool mReportInProgress       = false;
+
     std::unique_ptr<ReadClient> mReadClient;
 };
 
@@ -307,6 +382,7 @@ void pychip_WriteClient_InitCallbacks(OnWriteResponseCallback onWriteResponseCal
 }
 
 void pychip_ReadClient_InitCallbacks(OnReadAttributeDataCallback onReadAttributeDataCallback,
+                                     OnReadAttributeReportCallback onReadAttributeReportCallback,
                                      OnReadEventDataCallback onReadEventDataCallback,
                                      OnSubscriptionEstablishedCallback onSubscriptionEstablishedCallback,
                                      OnResubscriptionAttemptedCallback onResubscriptionAttemptedCallback,
@@ -314,6 +390,7 @@ void pychip_ReadClient_InitCallbacks(OnReadAttributeDataCallback onReadAttribute
                                      OnReportBeginCallback onReportBeginCallback, OnReportEndCallback onReportEndCallback)
 {
     gOnReadAttributeDataCallback       = onReadAttributeDataCallback;
+    gOnReadAttributeReportCallback     = onReadAttributeReportCallback;
     gOnReadEventDataCallback           = onReadEventDataCallback;
     gOnSubscriptionEstablishedCallback = onSubscriptionEstablishedCallback;
     gOnResubscriptionAttemptedCallback = onResubscriptionAttemptedCallback;
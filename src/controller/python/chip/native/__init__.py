@@ -70,6 +70,29 @@ class NativeLibraryHandleMethodArguments:
 _nativeLibraryHandle: ctypes.CDLL = None
 
 
+def _InstallNativeTLVDecoder(handle: ctypes.CDLL):
+    """Let chip.tlv.decode() use the native TLV decoder of the library."""
+    try:
+        import chip.tlv
+    except ImportError:
+        # chip.tlv ships with the chip-clusters package, which may not be installed.
+        return
+
+    decodeToPickle = handle.pychip_TLV_DecodeToPickle
+    decodeToPickle.restype = ctypes.c_void_p
+    decodeToPickle.argtypes = [ctypes.c_char_p, ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)]
+
+    def decode(tlv):
+        tlv = bytes(tlv)
+        outLen = ctypes.c_size_t()
+        out = decodeToPickle(tlv, len(tlv), ctypes.byref(outLen))
+        if out is None:
+            return None
+        return chip.tlv.loadNativeDecoding(ctypes.string_at(out, outLen.value))
+
+    chip.tlv.setNativeDecoder(decode)
+
+
 def _GetLibraryHandle(shouldInit: bool) -> ctypes.CDLL:
     """Get a memoized handle to the chip native code dll."""
 
@@ -80,6 +103,7 @@ def _GetLibraryHandle(shouldInit: bool) -> ctypes.CDLL:
         _nativeLibraryHandle = ctypes.CDLL(FindNativeLibraryPath())
         setter = NativeLibraryHandleMethodArguments(_nativeLibraryHandle)
         setter.Set("pychip_CommonStackInit", ctypes.c_uint32, [ctypes.c_char_p])
+        _InstallNativeTLVDecoder(_nativeLibraryHandle)
 
     return _nativeLibraryHandle
 
@@ -0,0 +1,484 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/python/chip/tlv/TLVToPickle.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <cstring>
+
+using namespace chip;
+
+namespace chip {
+namespace python {
+namespace {
+
+// Pickle opcodes, see Lib/pickletools.py. Only opcodes up to protocol 3 are used.
+enum : uint8_t
+{
+    kOpProto         = 0x80,
+    kOpStop          = '.',
+    kOpMark          = '(',
+    kOpPop           = '0',
+    kOpNone          = 'N',
+    kOpNewTrue       = 0x88,
+    kOpNewFalse      = 0x89,
+    kOpBinInt        = 'J',
+    kOpBinInt1       = 'K',
+    kOpBinInt2       = 'M',
+    kOpLong1         = 0x8a,
+    kOpBinFloat      = 'G',
+    kOpBinUnicode    = 'X',
+    kOpShortBinBytes = 'C',
+    kOpBinBytes      = 'B',
+    kOpEmptyDict     = '}',
+    kOpEmptyList     = ']',
+    kOpSetItems      = 'u',
+    kOpAppend        = 'a',
+    kOpAppends       = 'e',
+    kOpTuple         = 't',
+    kOpTuple1        = 0x85,
+    kOpTuple2        = 0x86,
+    kOpGlobal        = 'c',
+    kOpBinPut        = 'q',
+    kOpBinGet        = 'h',
+    kOpNewObj        = 0x81,
+};
+
+constexpr uint8_t kPickleProtocol = 3;
+
+// Memo slots filled in by Begin().
+enum : uint8_t
+{
+    kMemoUInt    = 0,
+    kMemoFloat32 = 1,
+    kMemoAny     = 2,
+};
+
+constexpr char kUIntGlobal[]    = "chip.tlv\nuint\n";
+constexpr char kFloat32Global[] = "chip.tlv\nfloat32\n";
+constexpr char kAnyKey[]        = "Any";
+
+/**
+ * Strict UTF-8 validation (no overlong forms, surrogates or code points above U+10FFFF), matching what Python's
+ * str(val, "utf-8") accepts. chip.tlv.TLVReader keeps strings that fail it as bytes.
+ */
+bool IsValidUtf8(const uint8_t * data, uint32_t length)
+{
+    uint32_t i = 0;
+    while (i < length)
+    {
+        uint8_t c = data[i];
+        if (c < 0x80)
+        {
+            i++;
+            continue;
+        }
+
+        uint32_t continuation;
+        uint8_t lower = 0x80;
+        uint8_t upper = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF)
+        {
+            continuation = 1;
+        }
+        else if (c >= 0xE0 && c <= 0xEF)
+        {
+            continuation = 2;
+            lower        = (c == 0xE0) ? 0xA0 : 0x80;
+            upper        = (c == 0xED) ? 0x9F : 0xBF;
+        }
+        else if (c >= 0xF0 && c <= 0xF4)
+        {
+            continuation = 3;
+            lower        = (c == 0xF0) ? 0x90 : 0x80;
+            upper        = (c == 0xF4) ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (length - i - 1 < continuation)
+        {
+            return false;
+        }
+        // Only the first continuation byte has a narrowed range.
+        if (data[i + 1] < lower || data[i + 1] > upper)
+        {
+            return false;
+        }
+        for (uint32_t j = 2; j <= continuation; j++)
+        {
+            if ((data[i + j] & 0xC0) != 0x80)
+            {
+                return false;
+            }
+        }
+        i += continuation + 1;
+    }
+    return true;
+}
+
+} // namespace
+
+void TLVToPickle::Begin()
+{
+    mBuffer.clear();
+    Put(kOpProto);
+    Put(kPickleProtocol);
+
+    Put(kOpGlobal);
+    Put(reinterpret_cast<const uint8_t *>(kUIntGlobal), sizeof(kUIntGlobal) - 1);
+    Put(kOpBinPut);
+    Put(kMemoUInt);
+    Put(kOpPop);
+
+    Put(kOpGlobal);
+    Put(reinterpret_cast<const uint8_t *>(kFloat32Global), sizeof(kFloat32Global) - 1);
+    Put(kOpBinPut);
+    Put(kMemoFloat32);
+    Put(kOpPop);
+
+    PutUnicode(reinterpret_cast<const uint8_t *>(kAnyKey), sizeof(kAnyKey) - 1);
+    Put(kOpBinPut);
+    Put(kMemoAny);
+    Put(kOpPop);
+}
+
+void TLVToPickle::End()
+{
+    Put(kOpStop);
+}
+
+void TLVToPickle::PutNone()
+{
+    Put(kOpNone);
+}
+
+void TLVToPickle::PutSigned(int64_t value)
+{
+    PutInt(value);
+}
+
+void TLVToPickle::PutUnsigned(uint64_t value)
+{
+    Put(kOpBinGet);
+    Put(kMemoUInt);
+    if (value <= INT64_MAX)
+    {
+        PutInt(static_cast<int64_t>(value));
+    }
+    else
+    {
+        // LONG1 is two's complement, so a trailing zero byte keeps values above INT64_MAX positive.
+        uint8_t bytes[sizeof(uint64_t) + 1];
+        Encoding::LittleEndian::Put64(bytes, value);
+        bytes[sizeof(uint64_t)] = 0;
+        Put(kOpLong1);
+        Put(static_cast<uint8_t>(sizeof(bytes)));
+        Put(bytes, sizeof(bytes));
+    }
+    Put(kOpTuple1);
+    Put(kOpNewObj);
+}
+
+void TLVToPickle::StartList()
+{
+    Put(kOpEmptyList);
+}
+
+void TLVToPickle::Append()
+{
+    Put(kOpAppend);
+}
+
+void TLVToPickle::StartTuple()
+{
+    Put(kOpMark);
+}
+
+void TLVToPickle::EndTuple()
+{
+    Put(kOpTuple);
+}
+
+void TLVToPickle::PutInt(int64_t value)
+{
+    if (value >= 0 && value <= UINT8_MAX)
+    {
+        Put(kOpBinInt1);
+        Put(static_cast<uint8_t>(value));
+    }
+    else if (value >= 0 && value <= UINT16_MAX)
+    {
+        uint8_t bytes[sizeof(uint16_t)];
+        Encoding::LittleEndian::Put16(bytes, static_cast<uint16_t>(value));
+        Put(kOpBinInt2);
+        Put(bytes, sizeof(bytes));
+    }
+    else if (value >= INT32_MIN && value <= INT32_MAX)
+    {
+        uint8_t bytes[sizeof(uint32_t)];
+        Encoding::LittleEndian::Put32(bytes, static_cast<uint32_t>(value));
+        Put(kOpBinInt);
+        Put(bytes, sizeof(bytes));
+    }
+    else
+    {
+        uint8_t bytes[sizeof(uint64_t)];
+        Encoding::LittleEndian::Put64(bytes, static_cast<uint64_t>(value));
+        Put(kOpLong1);
+        Put(static_cast<uint8_t>(sizeof(bytes)));
+        Put(bytes, sizeof(bytes));
+    }
+}
+
+void TLVToPickle::PutDouble(double value)
+{
+    uint64_t bits;
+    static_assert(sizeof(bits) == sizeof(value), "BINFLOAT expects an IEEE 754 double");
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint8_t bytes[sizeof(uint64_t)];
+    Encoding::BigEndian::Put64(bytes, bits);
+    Put(kOpBinFloat);
+    Put(bytes, sizeof(bytes));
+}
+
+void TLVToPickle::PutUnicode(const uint8_t * data, uint32_t length)
+{
+    uint8_t bytes[sizeof(uint32_t)];
+    Encoding::LittleEndian::Put32(bytes, length);
+    Put(kOpBinUnicode);
+    Put(bytes, sizeof(bytes));
+    Put(data, length);
+}
+
+void TLVToPickle::PutBytes(const uint8_t * data, uint32_t length)
+{
+    if (length <= UINT8_MAX)
+    {
+        Put(kOpShortBinBytes);
+        Put(static_cast<uint8_t>(length));
+    }
+    else
+    {
+        uint8_t bytes[sizeof(uint32_t)];
+        Encoding::LittleEndian::Put32(bytes, length);
+        Put(kOpBinBytes);
+        Put(bytes, sizeof(bytes));
+    }
+    Put(data, length);
+}
+
+CHIP_ERROR TLVToPickle::PutTag(TLV::TLVReader & reader)
+{
+    TLV::Tag tag = reader.GetTag();
+
+    switch (static_cast<TLV::TLVTagControl>(reader.GetControlByte() & TLV::kTLVTagControlMask))
+    {
+    case TLV::TLVTagControl::Anonymous:
+        Put(kOpBinGet);
+        Put(kMemoAny);
+        return CHIP_NO_ERROR;
+    case TLV::TLVTagControl::ContextSpecific:
+        PutInt(TLV::TagNumFromTag(tag));
+        return CHIP_NO_ERROR;
+    case TLV::TLVTagControl::CommonProfile_2Bytes:
+    case TLV::TLVTagControl::CommonProfile_4Bytes:
+        PutInt(TLV::kCommonProfileId);
+        break;
+    case TLV::TLVTagControl::ImplicitProfile_2Bytes:
+    case TLV::TLVTagControl::ImplicitProfile_4Bytes:
+        PutNone();
+        break;
+    default:
+        PutInt(TLV::ProfileIdFromTag(tag));
+        break;
+    }
+
+    // Profile tags are keyed by a (profile, tag) tuple.
+    PutInt(TLV::TagNumFromTag(tag));
+    Put(kOpTuple2);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVToPickle::PutContainer(TLV::TLVReader & reader, bool asDict, size_t depth)
+{
+    VerifyOrReturnError(depth < kMaxContainerDepth, CHIP_ERROR_TLV_CONTAINER_OPEN);
+
+    Put(asDict ? kOpEmptyDict : kOpEmptyList);
+    Put(kOpMark);
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (asDict)
+        {
+            ReturnErrorOnFailure(PutTag(reader));
+        }
+        else
+        {
+            // chip.tlv.TLVReader indexes the list with the tag of a tagged element, which is not something we want to mimic;
+            // let the caller fall back to it.
+            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        }
+        ReturnErrorOnFailure(PutValue(reader, depth));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    Put(asDict ? kOpSetItems : kOpAppends);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVToPickle::PutValue(const TLV::TLVReader & reader)
+{
+    TLV::TLVReader elementReader;
+    elementReader.Init(reader);
+    // Any profile works here: implicit tags are recognized from the control byte, but the reader only keeps their tag number
+    // when an implicit profile is set.
+    elementReader.ImplicitProfileId = TLV::kCommonProfileId;
+    return PutValue(elementReader, 0);
+}
+
+CHIP_ERROR TLVToPickle::PutElements(const TLV::TLVReader & reader)
+{
+    TLV::TLVReader elementReader;
+    elementReader.Init(reader);
+    elementReader.ImplicitProfileId = TLV::kCommonProfileId;
+
+    Put(kOpEmptyDict);
+    Put(kOpMark);
+
+    CHIP_ERROR err;
+    while ((err = elementReader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(PutTag(elementReader));
+        ReturnErrorOnFailure(PutValue(elementReader, 0));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    Put(kOpSetItems);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVToPickle::PutValue(TLV::TLVReader & reader, size_t depth)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_SignedInteger: {
+        int64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutSigned(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutUnsigned(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_Boolean: {
+        bool value;
+        ReturnErrorOnFailure(reader.Get(value));
+        Put(value ? kOpNewTrue : kOpNewFalse);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_FloatingPointNumber: {
+        if ((reader.GetControlByte() & TLV::kTLVTypeMask) == static_cast<uint8_t>(TLV::TLVElementType::FloatingPointNumber32))
+        {
+            float value;
+            ReturnErrorOnFailure(reader.Get(value));
+            Put(kOpBinGet);
+            Put(kMemoFloat32);
+            PutDouble(value);
+            Put(kOpTuple1);
+            Put(kOpNewObj);
+        }
+        else
+        {
+            double value;
+            ReturnErrorOnFailure(reader.Get(value));
+            PutDouble(value);
+        }
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_UTF8String:
+    case TLV::kTLVType_ByteString: {
+        const uint8_t * data = nullptr;
+        uint32_t length      = reader.GetLength();
+        if (length > 0)
+        {
+            ReturnErrorOnFailure(reader.GetDataPtr(data));
+        }
+        if (reader.GetType() == TLV::kTLVType_UTF8String && IsValidUtf8(data, length))
+        {
+            PutUnicode(data, length);
+        }
+        else
+        {
+            PutBytes(data, length);
+        }
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_Null:
+        PutNone();
+        return CHIP_NO_ERROR;
+    case TLV::kTLVType_Structure:
+    case TLV::kTLVType_Array:
+    case TLV::kTLVType_List: {
+        TLV::TLVType containerType;
+        bool asDict = (reader.GetType() == TLV::kTLVType_Structure);
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+        ReturnErrorOnFailure(PutContainer(reader, asDict, depth + 1));
+        return reader.ExitContainer(containerType);
+    }
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+    }
+}
+
+} // namespace python
+} // namespace chip
+
+extern "C" {
+
+/**
+ * Decode a TLV buffer into a pickle stream of the dict chip.tlv.TLVReader.get() would return for it.
+ *
+ * Returns nullptr if the buffer cannot be decoded. Otherwise the stream stays valid until the next call on the same thread.
+ */
+const uint8_t * pychip_TLV_DecodeToPickle(const uint8_t * tlv, size_t tlvLen, size_t * outLen)
+{
+    thread_local python::TLVToPickle pickle;
+
+    VerifyOrReturnValue(CanCastTo<uint32_t>(tlvLen), nullptr);
+
+    TLV::TLVReader reader;
+    reader.Init(tlv, static_cast<uint32_t>(tlvLen));
+
+    pickle.Begin();
+    VerifyOrReturnValue(pickle.PutElements(reader) == CHIP_NO_ERROR, nullptr);
+    pickle.End();
+
+    *outLen = pickle.Length();
+    return pickle.Data();
+}
+}
@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Native TLV decoding for the Python controller.
+ *
+ *      Decoded TLV is emitted as a pickle (protocol 3) stream rather than built with the Python C API, which keeps the
+ *      native library free of any dependency on a particular Python ABI. A single pickle.loads() call on the Python side
+ *      then materializes every object of a report, producing the same values chip.tlv.TLVReader.get() would have.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chip {
+namespace python {
+
+class TLVToPickle
+{
+public:
+    /**
+     * Maximum container nesting the encoder will follow; deeper data is reported as CHIP_ERROR_TLV_CONTAINER_OPEN so the
+     * caller can fall back to the pure Python reader.
+     */
+    static constexpr size_t kMaxContainerDepth = 32;
+
+    /**
+     * Start a new stream, discarding any previous content.
+     */
+    void Begin();
+
+    /**
+     * Terminate the stream. Exactly one object must be left on the pickle stack.
+     */
+    void End();
+
+    /**
+     * Encode the value of the element the reader is positioned on, recursing into containers. Structures become dicts
+     * keyed by tag, arrays and lists become lists, exactly as chip.tlv.TLVReader decodes them.
+     */
+    CHIP_ERROR PutValue(const TLV::TLVReader & reader);
+
+    /**
+     * Encode every remaining element at the reader's current level into a dict keyed by tag, which is what
+     * chip.tlv.TLVReader.get() returns for a whole buffer.
+     */
+    CHIP_ERROR PutElements(const TLV::TLVReader & reader);
+
+    void PutNone();
+    void PutSigned(int64_t value);
+    void PutUnsigned(uint64_t value);
+    void StartList();
+    void Append();
+    void StartTuple();
+    void EndTuple();
+
+    /**
+     * Checkpoints allow a caller to drop a partially encoded value, e.g. after running into malformed TLV.
+     */
+    size_t Checkpoint() const { return mBuffer.size(); }
+    void Rollback(size_t checkpoint) { mBuffer.resize(checkpoint); }
+
+    const uint8_t * Data() const { return mBuffer.data(); }
+    size_t Length() const { return mBuffer.size(); }
+
+private:
+    CHIP_ERROR PutValue(TLV::TLVReader & reader, size_t depth);
+    CHIP_ERROR PutContainer(TLV::TLVReader & reader, bool asDict, size_t depth);
+    CHIP_ERROR PutTag(TLV::TLVReader & reader);
+    void PutInt(int64_t value);
+    void PutDouble(double value);
+    void PutUnicode(const uint8_t * data, uint32_t length);
+    void PutBytes(const uint8_t * data, uint32_t length);
+
+    void Put(uint8_t byte) { mBuffer.push_back(byte); }
+    void Put(const uint8_t * data, size_t length) { mBuffer.insert(mBuffer.end(), data, data + length); }
+
+    std::vector<uint8_t> mBuffer;
+};
+
+} // namespace python
+} // namespace chip
@@ -28,6 +28,7 @@
 from __future__ import absolute_import
 from __future__ import print_function
 
+import pickle
 import struct
 from collections import OrderedDict
 from collections.abc import Mapping, Sequence
@@ -691,6 +692,42 @@ class TLVReader(object):
                     raise ValueError("Attempt to decode unsupported TLV tag")
 
 
+def loadNativeDecoding(data: bytes):
+    ''' Build the Python objects described by a pickle stream the native TLV decoder of the chip library produced.
+
+        The stream is generated from the TLV by the library itself, never taken from the network, and only refers to
+        the uint and float32 types of this module.
+    '''
+    return pickle.loads(data)
+
+
+# Installed by chip.native once the chip library is loaded, see decode().
+_nativeDecoder = None
+
+# Below this size, calling into the native library costs more than decoding in Python.
+_NATIVE_DECODE_MIN_LENGTH = 16
+
+
+def setNativeDecoder(decoder):
+    ''' decoder takes a TLV buffer and returns what TLVReader(tlv).get() would, or None if it could not decode it.
+    '''
+    global _nativeDecoder
+    _nativeDecoder = decoder
+
+
+def decode(tlv) -> dict:
+    ''' Decode a TLV buffer into the dictionary TLVReader(tlv).get() returns.
+
+        The native decoder of the chip library is used when it has been loaded, the pure Python reader otherwise or when
+        the native decoder rejects the data, so errors are reported exactly as TLVReader reports them.
+    '''
+    if _nativeDecoder is not None and len(tlv) >= _NATIVE_DECODE_MIN_LENGTH:
+        out = _nativeDecoder(tlv)
+        if out is not None:
+            return out
+    return TLVReader(tlv).get()
+
+
 def tlvTagToSortKey(tag):
     if tag is None:
         return -1
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+
+#
+#    Copyright (c) 2022 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+#
+#    Compares the pure Python chip.tlv.TLVReader with the native decoder of the chip library on
+#    the attribute values of a synthetic wildcard report, e.g.:
+#
+#        python3 tlv_decode_benchmark.py --nodes 500
+#
+#    The chip package and its native library must be importable (e.g. from an activated
+#    out/python_env).
+#
+
+import argparse
+import sys
+import time
+
+import chip.native
+import chip.tlv
+from chip.tlv import TLVReader, TLVWriter, float32, uint
+
+
+def _makeAttributeValues(node: int):
+    ''' Roughly what a wildcard read returns for a node: descriptor lists, basic information strings, a few structs
+        and plenty of scalar attributes.
+    '''
+    values = []
+    for endpoint in range(3):
+        values.append([uint(cluster) for cluster in (0x1d, 0x1e, 0x28, 0x2a, 0x30, 0x31, 0x33, 0x3c, 0x3e, 0x3f)])
+        values.append([{0: uint(0x16), 1: uint(1)}, {0: uint(0x100 + endpoint), 1: uint(2)}])
+        values.append("Node %d endpoint %d" % (node, endpoint))
+        values.append(b"\x00\x01" * 16)
+        values.append([{1: uint(node), 2: "fabric-%d" % node, 3: uint(0xFFF1), 254: uint(1)}])
+        for attribute in range(40):
+            values.append(uint(attribute * node))
+        values.append(-node)
+        values.append(True)
+        values.append(None)
+        values.append(float32(0.5))
+        values.append(1.25)
+    return values
+
+
+def _encode(value) -> bytes:
+    writer = TLVWriter()
+    writer.put(None, value)
+    return bytes(writer.encoding)
+
+
+def _timeIt(label: str, iterations: int, fn):
+    best = None
+    for _ in range(iterations):
+        start = time.perf_counter()
+        result = fn()
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    print("%-40s %10.1f ms" % (label, best * 1000))
+    return result, best
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Benchmark native vs pure Python TLV decoding')
+    parser.add_argument('--nodes', type=int, default=500, help='number of nodes in the synthetic report')
+    parser.add_argument('--iterations', type=int, default=3, help='runs per measurement, the best one is reported')
+    args = parser.parse_args()
+
+    # Loading the library installs the native decoder used by chip.tlv.decode().
+    chip.native._GetLibraryHandle(False)
+
+    attributes = [_encode(value) for node in range(args.nodes) for value in _makeAttributeValues(node)]
+    report = _encode(list(TLVReader(attribute).get()["Any"] for attribute in attributes))
+    print("%d attributes, %d bytes of TLV" % (len(attributes), sum(len(attribute) for attribute in attributes)))
+
+    pythonResult, pythonTime = _timeIt("pure Python, per attribute", args.iterations,
+                                       lambda: [TLVReader(attribute).get() for attribute in attributes])
+    nativeResult, nativeTime = _timeIt("native, per attribute", args.iterations,
+                                       lambda: [chip.tlv.decode(attribute) for attribute in attributes])
+    reportResult, reportTime = _timeIt("native, whole report in one call", args.iterations,
+                                       lambda: chip.tlv.decode(report))
+
+    if nativeResult != pythonResult or reportResult["Any"] != [value["Any"] for value in pythonResult]:
+        print("native and pure Python decoding differ")
+        return 1
+
+    print("speedup: %.1fx per attribute, %.1fx for the whole report" %
+          (pythonTime / nativeTime, pythonTime / reportTime))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
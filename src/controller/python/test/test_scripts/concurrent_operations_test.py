@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+
+#
+#    Copyright (c) 2022 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+# Throughput test for concurrent operations against many nodes.
+#
+# Spawns --nodes local chip-all-clusters-app instances, commissions them, then compares reads done one node at a time with
+# CASE establishment, reads, invokes and subscriptions that are in flight for all nodes at once, e.g.:
+#
+#     python3 concurrent_operations_test.py --app out/linux-x64-all-clusters/chip-all-clusters-app --nodes 16
+
+import asyncio
+import os
+import subprocess
+import sys
+import time
+from optparse import OptionParser
+
+import chip.clusters as Clusters
+from base import BaseTestHelper, FailIfNot, TestFail, TestTimeout, logger
+from chip.ChipDeviceCtrl import DiscoveryFilterType
+
+TEST_SETUPPIN = 20202021
+TEST_BASE_DISCRIMINATOR = 3840
+TEST_BASE_PORT = 5540
+TEST_BASE_NODE_ID = 1
+
+LIGHTING_ENDPOINT_ID = 1
+
+
+def StartApps(appPath: str, count: int):
+    apps = []
+    for i in range(count):
+        kvs = "/tmp/chip_concurrent_operations_kvs_%d" % i
+        if os.path.exists(kvs):
+            os.remove(kvs)
+        apps.append(subprocess.Popen([appPath,
+                                      "--secured-device-port", str(TEST_BASE_PORT + i),
+                                      "--discriminator", str(TEST_BASE_DISCRIMINATOR + i),
+                                      "--KVS", kvs],
+                                     stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL))
+    return apps
+
+
+def StopApps(apps):
+    for app in apps:
+        app.terminate()
+    for app in apps:
+        app.wait()
+
+
+def CheckResults(operationName: str, results: dict):
+    failures = {nodeid: result for nodeid, result in results.items() if isinstance(result, BaseException)}
+    for nodeid, failure in failures.items():
+        logger.error(f"{operationName} failed on node {nodeid}: {failure}")
+    return not failures
+
+
+def LogThroughput(operationName: str, count: int, elapsed: float):
+    logger.info(f"{operationName}: {count} nodes in {elapsed:.2f} s ({count / elapsed:.1f} operations/s)")
+
+
+async def TestConcurrentOperations(test: BaseTestHelper, nodeids: list):
+    devCtrl = test.devCtrl
+    attributes = [(0, Clusters.Basic.Attributes.NodeLabel), (0, Clusters.Basic.Attributes.SoftwareVersion)]
+
+    # Sequential reads over warm sessions are the baseline.
+    start = time.monotonic()
+    for nodeid in nodeids:
+        await devCtrl.ReadAttribute(nodeid, attributes)
+    sequential = time.monotonic() - start
+    LogThroughput("Sequential reads", len(nodeids), sequential)
+
+    # Dropping the sessions makes every node go through DNS-SD resolution and CASE again, all at the same time.
+    for nodeid in nodeids:
+        devCtrl.ExpireSessions(nodeid)
+    start = time.monotonic()
+    results = await devCtrl.RunOnNodes(nodeids, lambda nodeid: devCtrl.ReadAttribute(nodeid, attributes))
+    LogThroughput("Concurrent CASE establishment and reads", len(nodeids), time.monotonic() - start)
+    if not CheckResults("CASE establishment and read", results):
+        return False
+
+    start = time.monotonic()
+    results = await devCtrl.RunOnNodes(nodeids, lambda nodeid: devCtrl.ReadAttribute(nodeid, attributes))
+    concurrent = time.monotonic() - start
+    LogThroughput("Concurrent reads", len(nodeids), concurrent)
+    if not CheckResults("Read", results):
+        return False
+
+    start = time.monotonic()
+    results = await devCtrl.RunOnNodes(nodeids, lambda nodeid: devCtrl.SendCommand(nodeid, LIGHTING_ENDPOINT_ID,
+                                                                                    Clusters.OnOff.Commands.Toggle()))
+    LogThroughput("Concurrent invokes", len(nodeids), time.monotonic() - start)
+    if not CheckResults("Invoke", results):
+        return False
+
+    start = time.monotonic()
+    results = await devCtrl.RunOnNodes(nodeids, lambda nodeid: devCtrl.ReadAttribute(
+        nodeid, [(LIGHTING_ENDPOINT_ID, Clusters.OnOff.Attributes.OnOff)], reportInterval=(0, 10)))
+    LogThroughput("Concurrent subscriptions", len(nodeids), time.monotonic() - start)
+    ok = CheckResults("Subscription", results)
+    for result in results.values():
+        if not isinstance(result, BaseException):
+            result.Shutdown()
+    if not ok:
+        return False
+
+    # Bounding the concurrency must still get every node done.
+    results = await devCtrl.RunOnNodes(nodeids, lambda nodeid: devCtrl.ReadAttribute(nodeid, attributes), maxConcurrency=2)
+    if not CheckResults("Bounded read", results):
+        return False
+
+    logger.info(f"Concurrent reads were {sequential / concurrent:.1f}x faster than sequential reads")
+    return True
+
+
+def main():
+    optParser = OptionParser()
+    optParser.add_option(
+        "-t",
+        "--timeout",
+        action="store",
+        dest="testTimeout",
+        default=300,
+        type='int',
+        help="The program will return with timeout after specified seconds.",
+        metavar="<timeout-second>",
+    )
+    optParser.add_option(
+        "--app",
+        action="store",
+        dest="appPath",
+        default='',
+        type='str',
+        help="Path to the chip-all-clusters-app binary to spawn the nodes from",
+        metavar="<app-path>"
+    )
+    optParser.add_option(
+        "--nodes",
+        action="store",
+        dest="nodes",
+        default=16,
+        type=int,
+        help="Number of nodes to spawn and commission",
+        metavar="<nodes>"
+    )
+    optParser.add_option(
+        "-p",
+        "--paa-trust-store-path",
+        action="store",
+        dest="paaTrustStorePath",
+        default='',
+        type='str',
+        help="Path that contains valid and trusted PAA Root Certificates.",
+        metavar="<paa-trust-store-path>"
+    )
+
+    (options, remainingArgs) = optParser.parse_args(sys.argv[1:])
+
+    if not options.appPath:
+        TestFail("Must provide the path to chip-all-clusters-app")
+
+    timeoutTicker = TestTimeout(options.testTimeout)
+    timeoutTicker.start()
+
+    apps = StartApps(options.appPath, options.nodes)
+
+    try:
+        test = BaseTestHelper(nodeid=112233, paaTrustStorePath=options.paaTrustStorePath)
+
+        nodeids = [TEST_BASE_NODE_ID + i for i in range(options.nodes)]
+        for i, nodeid in enumerate(nodeids):
+            logger.info(f"Commissioning node {nodeid}")
+            FailIfNot(test.devCtrl.CommissionOnNetwork(nodeid, TEST_SETUPPIN, DiscoveryFilterType.LONG_DISCRIMINATOR,
+                                                       TEST_BASE_DISCRIMINATOR + i),
+                      f"Failed to commission node {nodeid}")
+
+        logger.info("Testing concurrent operations")
+        FailIfNot(asyncio.run(TestConcurrentOperations(test, nodeids)), "Failed concurrent operations test")
+    finally:
+        StopApps(apps)
+
+    timeoutTicker.stop()
+
+    logger.info("Test finished")
+
+    # TODO: Python device controller cannot be shutdown clean sometimes and will block on AsyncDNSResolverSockets shutdown.
+    # Call os._exit(0) to force close it.
+    os._exit(0)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except Exception as ex:
+        logger.exception(ex)
+        TestFail("Exception occurred when running tests.")
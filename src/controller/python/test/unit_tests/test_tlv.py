@@ -18,10 +18,21 @@
 
 from chip.tlv import TLVWriter, TLVReader
 from chip.tlv import uint as tlvUint
+from chip.tlv import float32 as tlvFloat32
+import chip.tlv
 
 import unittest
 
 
+def _nativeDecoderAvailable():
+    try:
+        import chip.native
+        chip.native._GetLibraryHandle(False)
+    except Exception:
+        return False
+    return chip.tlv._nativeDecoder is not None
+
+
 class TestTLVWriter(unittest.TestCase):
     def _getEncoded(self, val, tag=None):
         writer = TLVWriter()
@@ -149,5 +160,57 @@ class TestTLVReader(unittest.TestCase):
         self._read_case([0b00000100, 0xab], tlvUint(0xab))
 
 
+@unittest.skipUnless(_nativeDecoderAvailable(), "the chip native library is not available")
+class TestNativeTLVDecoder(unittest.TestCase):
+    def _assertSameDecoding(self, value):
+        writer = TLVWriter()
+        writer.put(None, value)
+        encoded = bytes(writer.encoding)
+        expected = TLVReader(encoded).get()
+        decoded = chip.tlv._nativeDecoder(encoded)
+        self.assertIsNotNone(decoded)
+        self._assertSameValue(decoded, expected)
+
+    def _assertSameValue(self, decoded, expected):
+        self.assertEqual(type(decoded), type(expected))
+        if isinstance(expected, dict):
+            self.assertEqual(list(decoded.keys()), list(expected.keys()))
+            self.assertEqual([type(key) for key in decoded], [type(key) for key in expected])
+            for key in expected:
+                self._assertSameValue(decoded[key], expected[key])
+        elif isinstance(expected, list):
+            self.assertEqual(len(decoded), len(expected))
+            for (d, e) in zip(decoded, expected):
+                self._assertSameValue(d, e)
+        else:
+            self.assertEqual(decoded, expected)
+
+    def test_scalars(self):
+        for value in [0, -1, 0x7cad, -(0x5555555555555555), tlvUint(0), tlvUint(0xffff), tlvUint(0xffffffffffffffff),
+                      True, False, None, 1.5, tlvFloat32(0.25), "", "h\u00e9llo", "x" * 300, b"", b"\xde\xad" * 200]:
+            self._assertSameDecoding(value)
+
+    def test_containers(self):
+        self._assertSameDecoding({})
+        self._assertSameDecoding([])
+        self._assertSameDecoding({1: [tlvUint(1), -2, "three"], 2: {3: None, 254: {4: [[], {}]}}})
+        self._assertSameDecoding([{0: tlvUint(0x16), 1: tlvUint(1)}, {0: tlvUint(0x100), 1: tlvUint(2)}])
+
+    def test_profile_tags(self):
+        self._assertSameDecoding({(0x235A0000, 42): "FOO", (None, 42): "BAR", (0, 7): tlvUint(3)})
+
+    def test_invalid_utf8(self):
+        for data in [b"\xff", b"\xed\xa0\x80", b"\xc0\xaf", b"ok\xe2\x82"]:
+            encoded = bytes([0x0c, len(data)]) + data
+            self._assertSameValue(chip.tlv._nativeDecoder(encoded), TLVReader(encoded).get())
+
+    def test_malformed(self):
+        # Left to the pure Python reader, which reports the error.
+        self.assertIsNone(chip.tlv._nativeDecoder(bytes([0x15, 0x24])))
+        with self.assertRaises(Exception):
+            chip.tlv.decode(bytes([0x15, 0x24, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+                                   0x0e]))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,458 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/BulkCommissioner.h>
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <setup_payload/ManualSetupPayloadGenerator.h>
+#include <system/SystemClock.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <nlunit-test.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+using TestContext = chip::Test::IOContext;
+
+class MockResolver : public Dnssd::Resolver
+{
+public:
+    CHIP_ERROR Init(Inet::EndPointManager<Inet::UDPEndPoint> * udpEndPointManager) override { return CHIP_NO_ERROR; }
+    void Shutdown() override { mDelegate = nullptr; }
+    void SetOperationalDelegate(Dnssd::OperationalResolveDelegate * delegate) override {}
+    void SetCommissioningDelegate(Dnssd::CommissioningResolveDelegate * delegate) override { mDelegate = delegate; }
+    CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR DiscoverCommissioners(Dnssd::DiscoveryFilter filter = Dnssd::DiscoveryFilter()) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR DiscoverCommissionableNodes(Dnssd::DiscoveryFilter filter = Dnssd::DiscoveryFilter()) override
+    {
+        mBrowseCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    Dnssd::CommissioningResolveDelegate * mDelegate = nullptr;
+    size_t mBrowseCount                             = 0;
+};
+
+// A device on the network: its host, its long discriminator and the PIN it accepts for PASE.
+struct Host
+{
+    const char * hostName;
+    uint16_t discriminator;
+    uint32_t setUpPINCode;
+    uint16_t port;
+};
+
+// Runs the commissioners by hand: PairDevice only records the pairing, which the test then completes.
+class TestBulkCommissioner : public BulkCommissioner
+{
+public:
+    struct Pairing
+    {
+        DeviceCommissioner * commissioner;
+        NodeId nodeId;
+        uint32_t setUpPINCode;
+        uint16_t port;
+    };
+
+    TestBulkCommissioner(Dnssd::Resolver * resolver) : BulkCommissioner(resolver) {}
+
+    // Completes the first pairing in progress: PASE succeeds if the PIN is the one of the host, and the other stages
+    // succeed unless commissioningError is set.
+    void CompletePairing(const std::vector<Host> & hosts, CHIP_ERROR commissioningError = CHIP_NO_ERROR,
+                         CommissioningStage failedStage = CommissioningStage::kSendNOC)
+    {
+        Pairing pairing = mPairings.front();
+        mPairings.erase(mPairings.begin());
+
+        auto host = std::find_if(hosts.begin(), hosts.end(), [&](const Host & h) { return h.port == pairing.port; });
+        DevicePairingDelegate * delegate = pairing.commissioner->GetPairingDelegate();
+        if (host == hosts.end() || host->setUpPINCode != pairing.setUpPINCode)
+        {
+            delegate->OnPairingComplete(CHIP_ERROR_INVALID_PASE_PARAMETER);
+            return;
+        }
+
+        delegate->OnPairingComplete(CHIP_NO_ERROR);
+        delegate->OnCommissioningStatusUpdate(PeerId().SetNodeId(pairing.nodeId), CommissioningStage::kSendPAICertificateRequest,
+                                              CHIP_NO_ERROR);
+        delegate->OnCommissioningComplete(pairing.nodeId, commissioningError);
+        if (commissioningError != CHIP_NO_ERROR)
+        {
+            delegate->OnCommissioningFailure(PeerId().SetNodeId(pairing.nodeId), commissioningError, failedStage, NullOptional);
+        }
+    }
+
+    std::vector<Pairing> mPairings;
+    size_t mMaxConcurrentPairings = 0;
+
+protected:
+    CHIP_ERROR PairDevice(DeviceCommissioner & commissioner, NodeId nodeId, RendezvousParameters & rendezvousParams,
+                          CommissioningParameters & commissioningParams) override
+    {
+        mPairings.push_back(
+            { &commissioner, nodeId, rendezvousParams.GetSetupPINCode(), rendezvousParams.GetPeerAddress().GetPort() });
+        mMaxConcurrentPairings = std::max(mMaxConcurrentPairings, mPairings.size());
+        return CHIP_NO_ERROR;
+    }
+
+    void StopPairing(DeviceCommissioner & commissioner, NodeId nodeId) override
+    {
+        mPairings.erase(std::remove_if(mPairings.begin(), mPairings.end(),
+                                       [&](const Pairing & pairing) { return pairing.commissioner == &commissioner; }),
+                        mPairings.end());
+    }
+
+    CommissioningStage GetCommissioningStage(DeviceCommissioner & commissioner) override
+    {
+        return CommissioningStage::kSecurePairing;
+    }
+};
+
+class TestDelegate : public BulkCommissioningDelegate
+{
+public:
+    void OnDeviceCommissioningComplete(const BulkCommissioningDevice & device) override { mCompletedDevices++; }
+    void OnBulkCommissioningComplete(const BulkCommissioningReport & report) override
+    {
+        mReport = report;
+        mDone   = true;
+    }
+
+    size_t mCompletedDevices = 0;
+    bool mDone               = false;
+    BulkCommissioningReport mReport;
+};
+
+std::string ManualCode(uint16_t longDiscriminator, uint32_t setUpPINCode)
+{
+    SetupPayload payload;
+    payload.discriminator.SetLongValue(longDiscriminator);
+    payload.setUpPINCode = setUpPINCode;
+
+    std::string code;
+    ManualSetupPayloadGenerator(payload).payloadDecimalStringRepresentation(code);
+    return code;
+}
+
+void Announce(BulkCommissioner & bulkCommissioner, const Host & host)
+{
+    Dnssd::DiscoveredNodeData nodeData;
+    Platform::CopyString(nodeData.resolutionData.hostName, host.hostName);
+    Inet::IPAddress::FromString("fd00::1", nodeData.resolutionData.ipAddress[0]);
+    nodeData.resolutionData.numIPs            = 1;
+    nodeData.resolutionData.port              = host.port;
+    nodeData.commissionData.longDiscriminator = host.discriminator;
+    nodeData.commissionData.commissioningMode = 1;
+
+    bulkCommissioner.OnNodeDiscovered(nodeData);
+}
+
+// Fixture for one bulk commissioning of the devices whose setup codes are given, over up to two commissioners.
+class BulkCommissioningRun
+{
+public:
+    BulkCommissioningRun(TestContext & ctx, const std::vector<std::string> & setUpCodes, size_t parallelism = 0) :
+        mCtx(ctx), mSetUpCodes(setUpCodes), mBulkCommissioner(&mResolver)
+    {
+        for (size_t i = 0; i < mSetUpCodes.size(); i++)
+        {
+            BulkCommissioningDevice device;
+            device.setUpCode = mSetUpCodes[i].c_str();
+            device.nodeId    = 0x100 + i;
+            mDevices.push_back(device);
+        }
+
+        mParams.commissioners    = Span<DeviceCommissioner *>(mCommissionerPointers);
+        mParams.parallelism      = parallelism;
+        mParams.devices          = Span<BulkCommissioningDevice>(mDevices.data(), mDevices.size());
+        mParams.discoveryTimeout = System::Clock::Seconds16(60);
+        mParams.delegate         = &mDelegate;
+        mParams.systemLayer      = &ctx.GetSystemLayer();
+    }
+
+    CHIP_ERROR Start() { return mBulkCommissioner.Start(mParams); }
+
+    // Runs the dispatches scheduled by the commissioner callbacks.
+    void DriveIO()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            mCtx.DriveIO();
+        }
+    }
+
+    // Declared before the BulkCommissioner, which must not outlive them.
+    TestContext & mCtx;
+    MockResolver mResolver;
+    DeviceCommissioner mCommissioners[2];
+    DeviceCommissioner * mCommissionerPointers[2] = { &mCommissioners[0], &mCommissioners[1] };
+    std::vector<std::string> mSetUpCodes;
+    std::vector<BulkCommissioningDevice> mDevices;
+    TestDelegate mDelegate;
+    TestBulkCommissioner mBulkCommissioner;
+    BulkCommissioningParameters mParams;
+};
+
+void TestDiscriminatorCollision(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    // Manual codes only carry the upper bits of the discriminator, which both devices share.
+    const std::vector<Host> hosts = { { "AAAAAAAAAAAAAAAA", 0xF01, 20202021, 5541 },
+                                      { "BBBBBBBBBBBBBBBB", 0xF02, 20202022, 5542 } };
+    BulkCommissioningRun run(ctx, { ManualCode(0xF01, 20202021), ManualCode(0xF02, 20202022) });
+    NL_TEST_ASSERT(apSuite, run.Start() == CHIP_NO_ERROR);
+
+    // The host of the second device is claimed by the first one, whose PIN it rejects.
+    Announce(run.mBulkCommissioner, hosts[1]);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.size() == 1);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings[0].nodeId == 0x100);
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+
+    // The first device goes back to discovery instead of failing, and the host is now matched to the second one.
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mCompletedDevices == 0);
+    Announce(run.mBulkCommissioner, hosts[1]);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.size() == 1);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings[0].nodeId == 0x101);
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mCompletedDevices == 1);
+
+    Announce(run.mBulkCommissioner, hosts[0]);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.size() == 1);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings[0].nodeId == 0x100);
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mDone);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.succeeded == 2);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.failed == 0);
+    NL_TEST_ASSERT(apSuite, run.mDevices[0].error == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, run.mDevices[1].error == CHIP_NO_ERROR);
+}
+
+void TestCollisionWithoutOtherHost(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    System::Clock::ClockBase * const savedClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    const std::vector<Host> hosts = { { "BBBBBBBBBBBBBBBB", 0xF02, 20202022, 5542 } };
+    BulkCommissioningRun run(ctx, { ManualCode(0xF01, 20202021), ManualCode(0xF02, 20202022) });
+    NL_TEST_ASSERT(apSuite, run.Start() == CHIP_NO_ERROR);
+
+    Announce(run.mBulkCommissioner, hosts[0]);
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+    Announce(run.mBulkCommissioner, hosts[0]);
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mCompletedDevices == 1);
+
+    // The host of the first device never shows up: it fails with the PASE error once discovery times out.
+    mockClock.AdvanceMonotonic(System::Clock::Seconds16(65));
+    run.DriveIO();
+
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mDone);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.succeeded == 1);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.failed == 1);
+    NL_TEST_ASSERT(apSuite, run.mDevices[0].error == CHIP_ERROR_INVALID_PASE_PARAMETER);
+    NL_TEST_ASSERT(apSuite, run.mDevices[0].failedStage == CommissioningStage::kSecurePairing);
+    NL_TEST_ASSERT(apSuite, run.mDevices[1].error == CHIP_NO_ERROR);
+
+    System::Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
+void TestLaneLimit(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    const std::vector<Host> hosts = { { "AAAAAAAAAAAAAAAA", 0x100, 20202021, 5541 },
+                                      { "BBBBBBBBBBBBBBBB", 0x200, 20202022, 5542 },
+                                      { "CCCCCCCCCCCCCCCC", 0x300, 20202023, 5543 },
+                                      { "DDDDDDDDDDDDDDDD", 0x400, 20202024, 5544 } };
+
+    const size_t kParallelisms[] = { 0, 1 };
+    for (size_t parallelism : kParallelisms)
+    {
+        std::vector<std::string> codes;
+        for (const auto & host : hosts)
+        {
+            codes.push_back(ManualCode(host.discriminator, host.setUpPINCode));
+        }
+        BulkCommissioningRun run(ctx, codes, parallelism);
+        NL_TEST_ASSERT(apSuite, run.Start() == CHIP_NO_ERROR);
+
+        for (const auto & host : hosts)
+        {
+            Announce(run.mBulkCommissioner, host);
+        }
+
+        const size_t lanes = parallelism == 0 ? 2 : parallelism;
+        while (!run.mBulkCommissioner.mPairings.empty())
+        {
+            NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.size() <= lanes);
+            run.mBulkCommissioner.CompletePairing(hosts);
+            run.DriveIO();
+        }
+
+        NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mMaxConcurrentPairings == lanes);
+        NL_TEST_ASSERT(apSuite, run.mDelegate.mDone);
+        NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.succeeded == hosts.size());
+        NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.queued.count == hosts.size());
+    }
+}
+
+void TestDuplicateAnnouncements(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    // Two devices sharing a discriminator: the answers of a claimed host must not be matched to the other device.
+    const std::vector<Host> hosts = { { "AAAAAAAAAAAAAAAA", 0xF01, 20202021, 5541 },
+                                      { "BBBBBBBBBBBBBBBB", 0xF02, 20202022, 5542 } };
+    BulkCommissioningRun run(ctx, { ManualCode(0xF01, 20202021), ManualCode(0xF02, 20202022) });
+    NL_TEST_ASSERT(apSuite, run.Start() == CHIP_NO_ERROR);
+
+    Announce(run.mBulkCommissioner, hosts[0]);
+    Announce(run.mBulkCommissioner, hosts[0]);
+    Announce(run.mBulkCommissioner, hosts[0]);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.size() == 1);
+
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+    Announce(run.mBulkCommissioner, hosts[0]);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.empty());
+
+    Announce(run.mBulkCommissioner, hosts[1]);
+    Announce(run.mBulkCommissioner, hosts[1]);
+    NL_TEST_ASSERT(apSuite, run.mBulkCommissioner.mPairings.size() == 1);
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mDone);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.succeeded == 2);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.discovery.count == 2);
+}
+
+void TestFailureAccounting(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    System::Clock::ClockBase * const savedClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    // The first host rejects the PIN of its device, the second one fails NOC issuance, the third one succeeds and the
+    // fourth device never shows up.
+    const std::vector<Host> hosts = { { "AAAAAAAAAAAAAAAA", 0x100, 20202029, 5541 },
+                                      { "BBBBBBBBBBBBBBBB", 0x200, 20202022, 5542 },
+                                      { "CCCCCCCCCCCCCCCC", 0x300, 20202023, 5543 } };
+    BulkCommissioningRun run(ctx,
+                             { ManualCode(0x100, 20202021), ManualCode(0x200, 20202022), ManualCode(0x300, 20202023),
+                               ManualCode(0x400, 20202024) },
+                             1);
+    NL_TEST_ASSERT(apSuite, run.Start() == CHIP_NO_ERROR);
+
+    for (const auto & host : hosts)
+    {
+        Announce(run.mBulkCommissioner, host);
+    }
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+    run.mBulkCommissioner.CompletePairing(hosts, CHIP_ERROR_INTERNAL, CommissioningStage::kSendNOC);
+    run.DriveIO();
+    run.mBulkCommissioner.CompletePairing(hosts);
+    run.DriveIO();
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mCompletedDevices == 3);
+    NL_TEST_ASSERT(apSuite, !run.mDelegate.mDone);
+
+    mockClock.AdvanceMonotonic(System::Clock::Seconds16(65));
+    run.DriveIO();
+
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mDone);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.succeeded == 1);
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.failed == 3);
+    NL_TEST_ASSERT(apSuite, run.mDevices[0].error == CHIP_ERROR_INVALID_PASE_PARAMETER);
+    NL_TEST_ASSERT(apSuite, run.mDevices[0].failedStage == CommissioningStage::kSecurePairing);
+    NL_TEST_ASSERT(apSuite, run.mDevices[1].error == CHIP_ERROR_INTERNAL);
+    NL_TEST_ASSERT(apSuite, run.mDevices[1].failedStage == CommissioningStage::kSendNOC);
+    NL_TEST_ASSERT(apSuite, run.mDevices[2].error == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, run.mDevices[3].error == CHIP_ERROR_TIMEOUT);
+    NL_TEST_ASSERT(apSuite, run.mDevices[3].failedStage == CommissioningStage::kError);
+
+    // Only discovered devices count in the discovery statistics.
+    NL_TEST_ASSERT(apSuite, run.mDelegate.mReport.discovery.count == 3);
+
+    System::Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestDiscriminatorCollision", TestDiscriminatorCollision),
+    NL_TEST_DEF("TestCollisionWithoutOtherHost", TestCollisionWithoutOtherHost),
+    NL_TEST_DEF("TestLaneLimit", TestLaneLimit),
+    NL_TEST_DEF("TestDuplicateAnnouncements", TestDuplicateAnnouncements),
+    NL_TEST_DEF("TestFailureAccounting", TestFailureAccounting),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int Initialize(void * aContext)
+{
+    return static_cast<TestContext *>(aContext)->Init() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    static_cast<TestContext *>(aContext)->Shutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestBulkCommissioner",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestBulkCommissionerTests()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBulkCommissionerTests)
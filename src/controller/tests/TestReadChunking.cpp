@@ -67,6 +67,10 @@ constexpr EndpointId kTestEndpointId5    = 5;
 constexpr AttributeId kTestListAttribute = 6;
 constexpr AttributeId kTestBadAttribute =
     7; // Reading this attribute will return CHIP_ERROR_NO_MEMORY but nothing is actually encoded.
+// A list attribute with gBigListSize items, each holding its index, counting how many times it is read in gBigListReads.
+constexpr AttributeId kTestBigListAttribute = 8;
+uint16_t gBigListSize                       = 0;
+uint32_t gBigListReads                      = 0;
 
 class TestReadChunking
 {
@@ -74,6 +78,7 @@ public:
     TestReadChunking() {}
     static void TestChunking(nlTestSuite * apSuite, void * apContext);
     static void TestListChunking(nlTestSuite * apSuite, void * apContext);
+    static void TestListChunkingReadsOnce(nlTestSuite * apSuite, void * apContext);
     static void TestBadChunking(nlTestSuite * apSuite, void * apContext);
     static void TestDynamicEndpoint(nlTestSuite * apSuite, void * apContext);
     static void TestSetDirtyBetweenChunks(nlTestSuite * apSuite, void * apContext);
@@ -94,7 +99,7 @@ DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
 
 DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testClusterAttrsOnEndpoint3)
 DECLARE_DYNAMIC_ATTRIBUTE(kTestListAttribute, ARRAY, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(kTestBadAttribute, ARRAY, 1, 0),
-    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+    DECLARE_DYNAMIC_ATTRIBUTE(kTestBigListAttribute, ARRAY, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
 
 DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpoint3Clusters)
 DECLARE_DYNAMIC_CLUSTER(TestCluster::Id, testClusterAttrsOnEndpoint3, nullptr, nullptr), DECLARE_DYNAMIC_CLUSTER_LIST_END;
@@ -177,6 +182,20 @@ void TestReadCallback::OnAttributeData(const app::ConcreteDataAttributePath & aP
     {
         // Nothing to check for this one; depends on the endpoint.
     }
+    else if (aPath.mAttributeId == kTestBigListAttribute)
+    {
+        app::DataModel::DecodableList<uint16_t> v;
+        NL_TEST_ASSERT(gSuite, app::DataModel::Decode(*apData, v) == CHIP_NO_ERROR);
+        auto it        = v.begin();
+        uint16_t index = 0;
+        while (it.Next())
+        {
+            NL_TEST_ASSERT(gSuite, it.GetValue() == index);
+            index++;
+        }
+        NL_TEST_ASSERT(gSuite, it.GetStatus() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(gSuite, index == gBigListSize);
+    }
     else if (aPath.mAttributeId != kTestListAttribute)
     {
         uint8_t v;
@@ -274,6 +293,15 @@ CHIP_ERROR TestAttrAccess::Read(const app::ConcreteReadAttributePath & aPath, ap
             }
             return CHIP_NO_ERROR;
         });
+    case kTestBigListAttribute:
+        gBigListReads++;
+        return aEncoder.EncodeList([](const auto & encoder) {
+            for (uint16_t i = 0; i < gBigListSize; i++)
+            {
+                ReturnErrorOnFailure(encoder.Encode(i));
+            }
+            return CHIP_NO_ERROR;
+        });
     case kTestBadAttribute:
         // The "BadAttribute" is implemented by encoding a very large octet string, then the encode will always return
         // CHIP_ERROR_NO_MEMORY.
@@ -487,6 +515,68 @@ void TestReadChunking::TestListChunking(nlTestSuite * apSuite, void * apContext)
     emberAfClearDynamicEndpoint(0);
 }
 
+// Chunk lists of many items, which are read again for each chunk unless the rest of the list goes through the scratch buffer
+// of the read handler.
+void TestReadChunking::TestListChunkingReadsOnce(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                    = *static_cast<TestContext *>(apContext);
+    auto sessionHandle                   = ctx.GetSessionBobToAlice();
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+
+    // Initialize the ember side server logic
+    InitDataModelHandler(&ctx.GetExchangeManager());
+
+    // Register our fake dynamic endpoint.
+    DataVersion dataVersionStorage[ArraySize(testEndpoint3Clusters)];
+    emberAfSetDynamicEndpoint(0, kTestEndpointId3, &testEndpoint3, Span<DataVersion>(dataVersionStorage));
+
+    app::AttributePathParams attributePath(kTestEndpointId3, app::Clusters::TestCluster::Id, kTestBigListAttribute);
+    app::ReadPrepareParams readParams(sessionHandle);
+
+    readParams.mpAttributePathParamsList    = &attributePath;
+    readParams.mAttributePathParamsListSize = 1;
+
+    // Leave room for a few list items per chunk: 30 items take several chunks, but their rest fits in the scratch buffer;
+    // 200 items need several fills of the scratch buffer.
+    app::InteractionModelEngine::GetInstance()->GetReportingEngine().SetWriterReserved(850);
+
+    const uint16_t kListSizes[] = { 30, 200 };
+    for (uint16_t listSize : kListSizes)
+    {
+        TestReadCallback readCallback;
+
+        gBigListSize  = listSize;
+        gBigListReads = 0;
+
+        app::ReadClient readClient(engine, &ctx.GetExchangeManager(), readCallback.mBufferedCallback,
+                                   app::ReadClient::InteractionType::Read);
+
+        NL_TEST_ASSERT(apSuite, readClient.SendRequest(readParams) == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+        NL_TEST_ASSERT(apSuite, readCallback.mOnReportEnd);
+
+        // The content is checked in TestReadCallback::OnAttributeData
+        NL_TEST_ASSERT(apSuite, readCallback.mAttributeCount == 1);
+        NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+
+#if CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+        // One read for the first chunk, then one for each fill of the scratch buffer, with at least 32 items (of less than 64
+        // bytes) per fill.
+        uint32_t itemsPerFill = CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE / 64;
+        NL_TEST_ASSERT(apSuite, gBigListReads > 1);
+        NL_TEST_ASSERT(apSuite, gBigListReads <= 1 + (listSize + itemsPerFill - 1) / itemsPerFill);
+        if (listSize <= itemsPerFill)
+        {
+            NL_TEST_ASSERT(apSuite, gBigListReads == 2);
+        }
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE > 0
+    }
+
+    app::InteractionModelEngine::GetInstance()->GetReportingEngine().SetWriterReserved(0);
+    emberAfClearDynamicEndpoint(0);
+}
+
 // Read an attribute that can never fit into the buffer. Result in an empty report, server should shutdown the transaction.
 void TestReadChunking::TestBadChunking(nlTestSuite * apSuite, void * apContext)
 {
@@ -896,6 +986,7 @@ const nlTest sTests[] =
 {
     NL_TEST_DEF("TestChunking", TestReadChunking::TestChunking),
     NL_TEST_DEF("TestListChunking", TestReadChunking::TestListChunking),
+    NL_TEST_DEF("TestListChunkingReadsOnce", TestReadChunking::TestListChunkingReadsOnce),
     NL_TEST_DEF("TestBadChunking", TestReadChunking::TestBadChunking),
     NL_TEST_DEF("TestDynamicEndpoint", TestReadChunking::TestDynamicEndpoint),
     NL_TEST_DEF("TestSetDirtyBetweenChunks", TestReadChunking::TestSetDirtyBetweenChunks),
@@ -32,6 +32,7 @@
 #include <stddef.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateCache.h>
 #include <credentials/CHIPCertificateSet.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/asn1/ASN1Macros.h>
@@ -137,20 +138,40 @@ void ChipCertificateSet::Clear()
 
 CHIP_ERROR ChipCertificateSet::LoadCert(const ByteSpan chipCert, BitFlags<CertDecodeFlags> decodeFlags)
 {
-    TLVReader reader;
+    ChipCertificateCache & cache = ChipCertificateCache::Instance();
+    ChipCertificateCache::CertKey key;
+    ChipCertificateData cert;
+
+    if (!cache.LookupDecodedCert(chipCert, decodeFlags, cert, key))
+    {
+        TLVReader reader;
 
-    reader.Init(chipCert);
+        reader.Init(chipCert);
 
-    ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag()));
+        ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag()));
+
+        ReturnErrorOnFailure(DecodeCert(reader, decodeFlags, chipCert, cert));
+
+        cache.StoreDecodedCert(key, chipCert, cert);
+    }
 
-    return LoadCert(reader, decodeFlags, chipCert);
+    return AddCert(cert, decodeFlags);
 }
 
 CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags, ByteSpan chipCert)
+{
+    ChipCertificateData cert;
+
+    ReturnErrorOnFailure(DecodeCert(reader, decodeFlags, chipCert, cert));
+
+    return AddCert(cert, decodeFlags);
+}
+
+CHIP_ERROR ChipCertificateSet::DecodeCert(TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags, ByteSpan chipCert,
+                                          ChipCertificateData & cert)
 {
     ASN1Writer writer; // ASN1Writer is used to encode TBS portion of the certificate for the purpose of signature
                        // validation, which should be performed on the TBS data encoded in ASN.1 DER form.
-    ChipCertificateData cert;
     cert.Clear();
 
     // Must be positioned on the structure element representing the certificate.
@@ -205,6 +226,11 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
         ReturnErrorOnFailure(reader.ExitContainer(containerType));
     }
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipCertificateSet::AddCert(ChipCertificateData & cert, BitFlags<CertDecodeFlags> decodeFlags)
+{
     // If requested by the caller, mark the certificate as trusted.
     if (decodeFlags.Has(CertDecodeFlags::kIsTrustAnchor))
     {
@@ -295,6 +321,14 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
     P256ECDSASignature signature;
 
     VerifyOrReturnError((cert != nullptr) && (caCert != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The same RCAC/ICAC signatures are verified for every chain of a fabric.
+    ChipCertificateCache & cache = ChipCertificateCache::Instance();
+    if (cache.IsSignatureVerified(*cert, caCert->mPublicKey))
+    {
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(signature.SetLength(cert->mSignature.size()));
     memcpy(signature, cert->mSignature.data(), cert->mSignature.size());
 
@@ -302,6 +336,8 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
 
     ReturnErrorOnFailure(caPublicKey.ECDSA_validate_hash_signature(cert->mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature));
 
+    cache.MarkSignatureVerified(*cert, caCert->mPublicKey);
+
     return CHIP_NO_ERROR;
 }
 
@@ -0,0 +1,276 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a process-wide cache of decoded and signature-verified
+ *      CHIP certificates, used by ChipCertificateSet.
+ *
+ */
+
+#include <credentials/CHIPCertificateCache.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+using namespace chip::Crypto;
+
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+
+namespace {
+
+// Moves a pointer of a span decoded from the buffer at `from` to the same offset in the buffer at `to`. Returns false if
+// the span is not within the `length` bytes of the buffer.
+template <typename T>
+bool RebasePointer(const T *& data, size_t size, uintptr_t from, uintptr_t to, size_t length)
+{
+    if (data == nullptr)
+    {
+        return true;
+    }
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(data);
+    VerifyOrReturnValue(address >= from && size <= length && address - from <= length - size, false);
+
+    data = reinterpret_cast<const T *>(to + (address - from));
+    return true;
+}
+
+template <typename T, size_t N>
+bool RebaseSpan(FixedSpan<T, N> & span, uintptr_t from, uintptr_t to, size_t length)
+{
+    const T * data = span.data();
+    VerifyOrReturnValue(RebasePointer(data, N, from, to, length), false);
+    span = FixedSpan<T, N>(data);
+    return true;
+}
+
+template <typename T>
+bool RebaseSpan(Span<T> & span, uintptr_t from, uintptr_t to, size_t length)
+{
+    const T * data = span.data();
+    VerifyOrReturnValue(RebasePointer(data, span.size(), from, to, length), false);
+    span = Span<T>(data, span.size());
+    return true;
+}
+
+bool RebaseDN(ChipDN & dn, uintptr_t from, uintptr_t to, size_t length)
+{
+    for (ChipRDN & rdn : dn.rdn)
+    {
+        VerifyOrReturnValue(RebaseSpan(rdn.mString, from, to, length), false);
+    }
+    return true;
+}
+
+// Points every span of certData, decoded from the `length` bytes at `from`, to the same bytes at `to`.
+bool RebaseCertData(ChipCertificateData & certData, uintptr_t from, uintptr_t to, size_t length)
+{
+    return RebaseSpan(certData.mCertificate, from, to, length) && RebaseDN(certData.mSubjectDN, from, to, length) &&
+        RebaseDN(certData.mIssuerDN, from, to, length) && RebaseSpan(certData.mSubjectKeyId, from, to, length) &&
+        RebaseSpan(certData.mAuthKeyId, from, to, length) && RebaseSpan(certData.mPublicKey, from, to, length) &&
+        RebaseSpan(certData.mSignature, from, to, length);
+}
+
+} // namespace
+
+template <typename Entry>
+Entry * ChipCertificateCache::Find(Entry (&entries)[kCacheSize], const uint8_t * key)
+{
+    for (Entry & entry : entries)
+    {
+        if (entry.mInUse && memcmp(entry.mKey, key, sizeof(entry.mKey)) == 0)
+        {
+            entry.mLastUsed = ++mUseCounter;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+template <typename Entry>
+Entry & ChipCertificateCache::Allocate(Entry (&entries)[kCacheSize])
+{
+    Entry * victim = &entries[0];
+    for (Entry & entry : entries)
+    {
+        if (!entry.mInUse)
+        {
+            victim = &entry;
+            break;
+        }
+        if (entry.mLastUsed < victim->mLastUsed)
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->mInUse    = true;
+    victim->mLastUsed = ++mUseCounter;
+    return *victim;
+}
+
+bool ChipCertificateCache::SignatureKey(const ChipCertificateData & cert, const P256PublicKeySpan & caPublicKey, uint8_t * key)
+{
+    uint8_t input[kSHA256_Hash_Length + kP256_ECDSA_Signature_Length_Raw + kP256_PublicKey_Length];
+
+    VerifyOrReturnValue(cert.mSignature.data() != nullptr && caPublicKey.data() != nullptr, false);
+
+    memcpy(input, cert.mTBSHash, kSHA256_Hash_Length);
+    memcpy(input + kSHA256_Hash_Length, cert.mSignature.data(), kP256_ECDSA_Signature_Length_Raw);
+    memcpy(input + kSHA256_Hash_Length + kP256_ECDSA_Signature_Length_Raw, caPublicKey.data(), kP256_PublicKey_Length);
+
+    return Hash_SHA256(input, sizeof(input), key) == CHIP_NO_ERROR;
+}
+
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+
+ChipCertificateCache & ChipCertificateCache::Instance()
+{
+    static ChipCertificateCache sInstance;
+    return sInstance;
+}
+
+bool ChipCertificateCache::LookupDecodedCert(const ByteSpan & chipCert, BitFlags<CertDecodeFlags> decodeFlags,
+                                             ChipCertificateData & certData, CertKey & key)
+{
+    key.mValid = false;
+
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    VerifyOrReturnValue(!chipCert.empty(), false);
+    VerifyOrReturnValue(Hash_SHA256(chipCert.data(), chipCert.size(), key.mHash) == CHIP_NO_ERROR, false);
+    key.mValid = true;
+
+    DecodedCertEntry * entry = Find(mDecodedCerts, key.mHash);
+    if (entry == nullptr ||
+        (decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash) && !entry->mCertData.mCertFlags.Has(CertFlags::kTBSHashPresent)))
+    {
+        mStatistics.decodeMisses++;
+        return false;
+    }
+
+    ChipCertificateData cached(entry->mCertData);
+    VerifyOrReturnValue(RebaseCertData(cached, entry->mBase, reinterpret_cast<uintptr_t>(chipCert.data()), chipCert.size()), false);
+
+    // Produce exactly what decoding without the TBS hash would have.
+    if (!decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash))
+    {
+        cached.mCertFlags.Clear(CertFlags::kTBSHashPresent);
+        memset(cached.mTBSHash, 0, sizeof(cached.mTBSHash));
+    }
+
+    mStatistics.decodeHits++;
+    certData = cached;
+    return true;
+#else
+    mStatistics.decodeMisses++;
+    return false;
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+}
+
+void ChipCertificateCache::StoreDecodedCert(const CertKey & key, const ByteSpan & chipCert, const ChipCertificateData & certData)
+{
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    VerifyOrReturn(key.mValid);
+
+    // Every span must point into chipCert, or it could not be moved to another copy of the certificate.
+    uintptr_t base = reinterpret_cast<uintptr_t>(chipCert.data());
+    ChipCertificateData checked(certData);
+    VerifyOrReturn(RebaseCertData(checked, base, base, chipCert.size()));
+
+    DecodedCertEntry * entry = Find(mDecodedCerts, key.mHash);
+    if (entry == nullptr)
+    {
+        entry = &Allocate(mDecodedCerts);
+        memcpy(entry->mKey, key.mHash, sizeof(entry->mKey));
+    }
+    else if (entry->mCertData.mCertFlags.Has(CertFlags::kTBSHashPresent) && !certData.mCertFlags.Has(CertFlags::kTBSHashPresent))
+    {
+        // Keep the more complete decoding.
+        return;
+    }
+
+    entry->mBase     = base;
+    entry->mCertData = certData;
+    entry->mCertData.mCertFlags.Clear(CertFlags::kIsTrustAnchor);
+#else
+    IgnoreUnusedVariable(key);
+    IgnoreUnusedVariable(chipCert);
+    IgnoreUnusedVariable(certData);
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+}
+
+bool ChipCertificateCache::IsSignatureVerified(const ChipCertificateData & cert, const P256PublicKeySpan & caPublicKey)
+{
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    uint8_t key[kSHA256_Hash_Length];
+
+    if (cert.mCertFlags.Has(CertFlags::kTBSHashPresent) && SignatureKey(cert, caPublicKey, key) &&
+        Find(mVerifiedSignatures, key) != nullptr)
+    {
+        mStatistics.signatureHits++;
+        return true;
+    }
+#else
+    IgnoreUnusedVariable(cert);
+    IgnoreUnusedVariable(caPublicKey);
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+
+    mStatistics.signatureMisses++;
+    return false;
+}
+
+void ChipCertificateCache::MarkSignatureVerified(const ChipCertificateData & cert, const P256PublicKeySpan & caPublicKey)
+{
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    uint8_t key[kSHA256_Hash_Length];
+
+    VerifyOrReturn(cert.mCertFlags.Has(CertFlags::kTBSHashPresent) && SignatureKey(cert, caPublicKey, key));
+    VerifyOrReturn(Find(mVerifiedSignatures, key) == nullptr);
+
+    memcpy(Allocate(mVerifiedSignatures).mKey, key, sizeof(key));
+#else
+    IgnoreUnusedVariable(cert);
+    IgnoreUnusedVariable(caPublicKey);
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+}
+
+void ChipCertificateCache::Clear()
+{
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    for (DecodedCertEntry & entry : mDecodedCerts)
+    {
+        entry.mInUse = false;
+    }
+    for (VerifiedSignatureEntry & entry : mVerifiedSignatures)
+    {
+        entry.mInUse = false;
+    }
+    mUseCounter = 0;
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+
+    mStatistics = Statistics();
+}
+
+} // namespace Credentials
+} // namespace chip
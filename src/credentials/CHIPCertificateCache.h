@@ -0,0 +1,149 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a process-wide cache of decoded and signature-verified
+ *      CHIP certificates, used by ChipCertificateSet.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CHIPCert.h"
+#include <lib/core/CHIPConfig.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ *  @class ChipCertificateCache
+ *
+ *  @brief
+ *    Remembers the outcome of the expensive steps of certificate chain validation, so that chains
+ *    sharing their RCAC and ICAC (e.g. every peer of a fabric during CASE) only pay for their leaf:
+ *
+ *    - Decoded certificates, including their TBS hash, keyed by the SHA-256 of the CHIP TLV
+ *      certificate. A hit skips TLV decoding and the TBS DER reconstruction.
+ *    - Successful signature verifications, keyed by the SHA-256 of the certificate TBS hash, its
+ *      signature and the issuer public key. A hit skips the ECDSA verification.
+ *
+ *    Both tables hold CHIP_CONFIG_CERTIFICATE_CACHE_SIZE entries and evict the least recently used
+ *    one. With a size of 0 the cache is disabled and every lookup misses.
+ *
+ *    The cache is not thread safe: like the rest of the credentials code it must be used with the
+ *    Matter stack lock held.
+ */
+class DLL_EXPORT ChipCertificateCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_CERTIFICATE_CACHE_SIZE;
+
+    struct Statistics
+    {
+        uint32_t decodeHits      = 0;
+        uint32_t decodeMisses    = 0;
+        uint32_t signatureHits   = 0;
+        uint32_t signatureMisses = 0;
+    };
+
+    // SHA-256 of a CHIP TLV certificate, computed by LookupDecodedCert for StoreDecodedCert.
+    struct CertKey
+    {
+        uint8_t mHash[Crypto::kSHA256_Hash_Length];
+        bool mValid = false;
+    };
+
+    static ChipCertificateCache & Instance();
+
+    /**
+     * @brief Look up a previously decoded certificate.
+     *
+     * @param[in]  chipCert     CHIP TLV certificate. On a hit, the spans of certData point into this buffer.
+     * @param[in]  decodeFlags  Flags the certificate is being decoded with. Only kGenerateTBSHash matters.
+     * @param[out] certData     Decoded certificate, as it would have been decoded from chipCert.
+     * @param[out] key          Key of chipCert, to pass to StoreDecodedCert on a miss.
+     *
+     * @return true on a hit, false otherwise (certData is then left unchanged). Certificates cached
+     *         without their TBS hash miss when decodeFlags asks for it.
+     **/
+    bool LookupDecodedCert(const ByteSpan & chipCert, BitFlags<CertDecodeFlags> decodeFlags, ChipCertificateData & certData,
+                           CertKey & key);
+
+    /**
+     * @brief Remember a certificate decoded from chipCert. Certificates whose data does not point
+     *        into chipCert are not remembered.
+     **/
+    void StoreDecodedCert(const CertKey & key, const ByteSpan & chipCert, const ChipCertificateData & certData);
+
+    /**
+     * @return true if the signature of cert has already been verified with caPublicKey.
+     **/
+    bool IsSignatureVerified(const ChipCertificateData & cert, const P256PublicKeySpan & caPublicKey);
+
+    /**
+     * @brief Remember that the signature of cert has been verified with caPublicKey.
+     **/
+    void MarkSignatureVerified(const ChipCertificateData & cert, const P256PublicKeySpan & caPublicKey);
+
+    /**
+     * @brief Forget every cached certificate and signature, and reset the statistics.
+     **/
+    void Clear();
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+
+private:
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    struct DecodedCertEntry
+    {
+        uint8_t mKey[Crypto::kSHA256_Hash_Length];
+        // Address of the buffer certData was decoded from: the spans of mCertData are relative to it.
+        uintptr_t mBase;
+        ChipCertificateData mCertData;
+        uint32_t mLastUsed = 0;
+        bool mInUse        = false;
+    };
+
+    struct VerifiedSignatureEntry
+    {
+        uint8_t mKey[Crypto::kSHA256_Hash_Length];
+        uint32_t mLastUsed = 0;
+        bool mInUse        = false;
+    };
+
+    template <typename Entry>
+    Entry * Find(Entry (&entries)[kCacheSize], const uint8_t * key);
+    template <typename Entry>
+    Entry & Allocate(Entry (&entries)[kCacheSize]);
+
+    static bool SignatureKey(const ChipCertificateData & cert, const P256PublicKeySpan & caPublicKey, uint8_t * key);
+
+    DecodedCertEntry mDecodedCerts[kCacheSize];
+    VerifiedSignatureEntry mVerifiedSignatures[kCacheSize];
+    uint32_t mUseCounter = 0;
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+
+    Statistics mStatistics;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -282,6 +282,17 @@ private:
     CHIP_ERROR FindValidCert(const ChipDN & subjectDN, const CertificateKeyId & subjectKeyId, ValidationContext & context,
                              uint8_t depth, const ChipCertificateData ** certData);
 
+    /**
+     * @brief Decode CHIP certificate, computing its TBS hash if requested by decodeFlags.
+     **/
+    static CHIP_ERROR DecodeCert(chip::TLV::TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags, ByteSpan chipCert,
+                                 ChipCertificateData & cert);
+
+    /**
+     * @brief Add decoded CHIP certificate to the set, unless it is already in the set.
+     **/
+    CHIP_ERROR AddCert(ChipCertificateData & cert, BitFlags<CertDecodeFlags> decodeFlags);
+
     /**
      * @brief Validate CHIP certificate.
      *
@@ -283,6 +283,14 @@ public:
      *  @retval nullptr if no iterator instances are available.
      */
     virtual EndpointIterator * IterateEndpoints(FabricIndex fabric_index) = 0;
+    /**
+     *  Creates an iterator that may be used to obtain the endpoints mapped to the given group of the given fabric.
+     *  This is the lookup used to expand groupcast messages, and implementations are expected to make it cheap.
+     *  In order to release the allocated memory, the Release() method must be called after the iteration is finished.
+     *  @retval An instance of EndpointIterator on success
+     *  @retval nullptr if no iterator instances are available.
+     */
+    virtual EndpointIterator * IterateEndpoints(FabricIndex fabric_index, GroupId group_id) = 0;
 
     //
     // Group-Key map
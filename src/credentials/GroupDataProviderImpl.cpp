@@ -23,6 +23,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Credentials {
 
@@ -35,6 +37,12 @@ using GroupSession  = GroupDataProvider::GroupSession;
 
 static constexpr size_t kPersistentBufferMax = 128;
 
+// Sort key of the endpoint index: fabric, then group, then endpoint.
+static constexpr uint64_t EndpointIndexKey(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
+{
+    return (static_cast<uint64_t>(fabric_index) << 32) | (static_cast<uint64_t>(group_id) << 16) | endpoint_id;
+}
+
 template <size_t kMaxSerializedSize>
 struct PersistentData
 {
@@ -877,6 +885,8 @@ struct KeySetData : PersistentData<kPersistentBufferMax>
 
 constexpr size_t GroupDataProvider::GroupInfo::kGroupNameMax;
 constexpr size_t GroupDataProviderImpl::kIteratorsMax;
+constexpr size_t GroupDataProviderImpl::kEndpointIndexSize;
+constexpr size_t GroupDataProviderImpl::kEndpointIndexFabrics;
 
 CHIP_ERROR GroupDataProviderImpl::Init()
 {
@@ -892,9 +902,16 @@ void GroupDataProviderImpl::Finish()
     mGroupInfoIterators.ReleaseAll();
     mGroupKeyIterators.ReleaseAll();
     mEndpointIterators.ReleaseAll();
+    mGroupEndpointIterators.ReleaseAll();
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+
+    for (auto & indexed : mIndexedFabrics)
+    {
+        indexed = IndexedFabric();
+    }
+    mEndpointIndexCount = 0;
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
@@ -958,6 +975,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1040,6 +1058,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1100,6 +1119,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1158,6 +1178,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
                                                  chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1364,9 +1385,181 @@ void GroupDataProviderImpl::EndpointIteratorImpl::Release()
     mProvider.mEndpointIterators.ReleaseObject(this);
 }
 
+GroupDataProvider::EndpointIterator * GroupDataProviderImpl::IterateEndpoints(chip::FabricIndex fabric_index,
+                                                                              chip::GroupId group_id)
+{
+    VerifyOrReturnError(IsInitialized(), nullptr);
+    return mGroupEndpointIterators.CreateObject(*this, fabric_index, group_id);
+}
+
+GroupDataProviderImpl::GroupEndpointIteratorImpl::GroupEndpointIteratorImpl(GroupDataProviderImpl & provider,
+                                                                            chip::FabricIndex fabric_index,
+                                                                            chip::GroupId group_id) :
+    mProvider(provider),
+    mFabric(fabric_index), mGroup(group_id)
+{
+    mIndexed = provider.IndexEndpoints(fabric_index);
+    VerifyOrReturn(!mIndexed);
+
+    // The fabric does not fit in the index: walk this group's endpoint list in persistent storage.
+    FabricData fabric(fabric_index);
+    GroupData group;
+    VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(provider.mStorage));
+    VerifyOrReturn(group.Find(provider.mStorage, fabric, group_id));
+
+    mEndpoint      = group.first_endpoint;
+    mEndpointCount = group.endpoint_count;
+}
+
+size_t GroupDataProviderImpl::GroupEndpointIteratorImpl::Count()
+{
+    if (!mIndexed)
+    {
+        return mEndpointCount;
+    }
+    VerifyOrReturnError(mProvider.IndexEndpoints(mFabric), 0);
+    return mProvider.FindIndexedEndpoint(EndpointIndexKey(mFabric, mGroup, kInvalidEndpointId) + 1) -
+        mProvider.FindIndexedEndpoint(EndpointIndexKey(mFabric, mGroup, 0));
+}
+
+bool GroupDataProviderImpl::GroupEndpointIteratorImpl::Next(GroupEndpoint & output)
+{
+    if (!mIndexed)
+    {
+        VerifyOrReturnError(mEndpointIndex < mEndpointCount, false);
+
+        EndpointData endpoint(mFabric, mGroup, mEndpoint);
+        if (CHIP_NO_ERROR != endpoint.Load(mProvider.mStorage))
+        {
+            mEndpointIndex = mEndpointCount;
+            return false;
+        }
+        output.group_id    = mGroup;
+        output.endpoint_id = endpoint.endpoint_id;
+        mEndpoint          = endpoint.next;
+        mEndpointIndex++;
+        return true;
+    }
+
+    // Look the position up again on every step, so that changes to the group table made by the caller while
+    // iterating (e.g. by a groupcast Groups cluster command) are picked up rather than leaving a stale position.
+    VerifyOrReturnError(mProvider.IndexEndpoints(mFabric), false);
+
+    const uint64_t from = mFirstEndpoint ? EndpointIndexKey(mFabric, mGroup, 0) : EndpointIndexKey(mFabric, mGroup, mEndpoint) + 1;
+    const size_t pos    = mProvider.FindIndexedEndpoint(from);
+    VerifyOrReturnError(pos < mProvider.mEndpointIndexCount, false);
+
+    const IndexedEndpoint & entry = mProvider.mEndpointIndex[pos];
+    VerifyOrReturnError(entry.fabric_index == mFabric && entry.group_id == mGroup, false);
+
+    output.group_id    = mGroup;
+    output.endpoint_id = entry.endpoint_id;
+    mEndpoint          = entry.endpoint_id;
+    mFirstEndpoint     = false;
+    return true;
+}
+
+void GroupDataProviderImpl::GroupEndpointIteratorImpl::Release()
+{
+    mProvider.mGroupEndpointIterators.ReleaseObject(this);
+}
+
+bool GroupDataProviderImpl::IndexEndpoints(chip::FabricIndex fabric_index)
+{
+    IndexedFabric * slot = nullptr;
+
+    for (auto & indexed : mIndexedFabrics)
+    {
+        if (indexed.fabric_index == fabric_index)
+        {
+            return !indexed.overflow;
+        }
+        if (slot == nullptr && indexed.fabric_index == kUndefinedFabricIndex)
+        {
+            slot = &indexed;
+        }
+    }
+    if (slot == nullptr)
+    {
+        // More fabrics in use than slots (e.g. while a fabric is being replaced), make room.
+        InvalidateEndpointIndex(mIndexedFabrics[0].fabric_index);
+        slot = &mIndexedFabrics[0];
+    }
+    slot->fabric_index = fabric_index;
+    slot->overflow     = false;
+
+    // Append the fabric's mappings after the existing entries, then sort everything back in place.
+    size_t count = mEndpointIndexCount;
+    FabricData fabric(fabric_index);
+    if (CHIP_NO_ERROR == fabric.Load(mStorage))
+    {
+        GroupData group(fabric_index, fabric.first_group);
+        for (size_t group_index = 0; group_index < fabric.group_count; group_index++)
+        {
+            if (CHIP_NO_ERROR != group.Load(mStorage))
+            {
+                break;
+            }
+            EndpointData endpoint(fabric_index, group.group_id, group.first_endpoint);
+            for (size_t endpoint_index = 0; endpoint_index < group.endpoint_count; endpoint_index++)
+            {
+                if (CHIP_NO_ERROR != endpoint.Load(mStorage))
+                {
+                    break;
+                }
+                if (count >= kEndpointIndexSize)
+                {
+                    // Does not fit, drop what was appended
+                    slot->overflow = true;
+                    return false;
+                }
+                mEndpointIndex[count++] = { fabric_index, group.group_id, endpoint.endpoint_id };
+                endpoint.endpoint_id    = endpoint.next;
+            }
+            group.group_id = group.next;
+        }
+    }
+
+    std::sort(mEndpointIndex, mEndpointIndex + count, [](const IndexedEndpoint & a, const IndexedEndpoint & b) {
+        return EndpointIndexKey(a.fabric_index, a.group_id, a.endpoint_id) <
+            EndpointIndexKey(b.fabric_index, b.group_id, b.endpoint_id);
+    });
+    mEndpointIndexCount = count;
+    return true;
+}
+
+void GroupDataProviderImpl::InvalidateEndpointIndex(chip::FabricIndex fabric_index)
+{
+    VerifyOrReturn(kUndefinedFabricIndex != fabric_index);
+
+    for (auto & indexed : mIndexedFabrics)
+    {
+        if (indexed.fabric_index == fabric_index)
+        {
+            indexed = IndexedFabric();
+        }
+    }
+
+    // The fabric's entries are contiguous, remove them
+    const size_t first = FindIndexedEndpoint(EndpointIndexKey(fabric_index, 0, 0));
+    const size_t last  = FindIndexedEndpoint(EndpointIndexKey(fabric_index, kMaxUniversalGroupId, kInvalidEndpointId) + 1);
+    std::copy(mEndpointIndex + last, mEndpointIndex + mEndpointIndexCount, mEndpointIndex + first);
+    mEndpointIndexCount -= (last - first);
+}
+
+size_t GroupDataProviderImpl::FindIndexedEndpoint(uint64_t key) const
+{
+    const IndexedEndpoint * entry =
+        std::lower_bound(mEndpointIndex, mEndpointIndex + mEndpointIndexCount, key, [](const IndexedEndpoint & a, uint64_t b) {
+            return EndpointIndexKey(a.fabric_index, a.group_id, a.endpoint_id) < b;
+        });
+    return static_cast<size_t>(entry - mEndpointIndex);
+}
+
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointIndex(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1727,6 +1920,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
     FabricData fabric(fabric_index);
 
+    InvalidateEndpointIndex(fabric_index);
+
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
     // However, states has a separate list, and needs to be removed regardless
     CHIP_ERROR err = fabric.Load(mStorage);
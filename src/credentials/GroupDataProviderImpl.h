@@ -26,7 +26,9 @@ namespace Credentials {
 class GroupDataProviderImpl : public GroupDataProvider
 {
 public:
-    static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kIteratorsMax         = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kEndpointIndexSize    = CHIP_CONFIG_GROUP_ENDPOINT_INDEX_SIZE;
+    static constexpr size_t kEndpointIndexFabrics = CHIP_CONFIG_MAX_FABRICS;
 
     GroupDataProviderImpl() = default;
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
@@ -65,6 +67,7 @@ public:
     // Iterators
     GroupInfoIterator * IterateGroupInfo(FabricIndex fabric_index) override;
     EndpointIterator * IterateEndpoints(FabricIndex fabric_index) override;
+    EndpointIterator * IterateEndpoints(FabricIndex fabric_index, GroupId group_id) override;
 
     //
     // Group-Key map
@@ -147,6 +150,39 @@ protected:
         bool mFirstEndpoint   = true;
     };
 
+    class GroupEndpointIteratorImpl : public EndpointIterator
+    {
+    public:
+        GroupEndpointIteratorImpl(GroupDataProviderImpl & provider, FabricIndex fabric_index, GroupId group_id);
+        size_t Count() override;
+        bool Next(GroupEndpoint & output) override;
+        void Release() override;
+
+    protected:
+        GroupDataProviderImpl & mProvider;
+        FabricIndex mFabric   = kUndefinedFabricIndex;
+        GroupId mGroup        = kUndefinedGroupId;
+        bool mIndexed         = false;
+        EndpointId mEndpoint  = kInvalidEndpointId; // Indexed: last endpoint returned. Otherwise: next endpoint to load.
+        size_t mEndpointIndex = 0;
+        size_t mEndpointCount = 0;
+        bool mFirstEndpoint   = true;
+    };
+
+    // (group, endpoint) mapping cached in RAM, kept sorted by fabric, then group, then endpoint.
+    struct IndexedEndpoint
+    {
+        FabricIndex fabric_index;
+        GroupId group_id;
+        EndpointId endpoint_id;
+    };
+
+    struct IndexedFabric
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        bool overflow            = false; // The fabric's mappings did not fit in the index
+    };
+
     class GroupKeyContext : public Crypto::SymmetricKeyContext
     {
     public:
@@ -230,13 +266,30 @@ protected:
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+    /**
+     * Make sure the (group, endpoint) mappings of the given fabric are in the endpoint index, loading them from
+     * persistent storage if needed.
+     *
+     * @retval true if the index holds all the mappings of the fabric.
+     * @retval false if they do not fit, in which case callers must read persistent storage.
+     */
+    bool IndexEndpoints(FabricIndex fabric_index);
+    void InvalidateEndpointIndex(FabricIndex fabric_index);
+    // Position of the first index entry whose sort key is not less than the given key.
+    size_t FindIndexedEndpoint(uint64_t key) const;
+
     chip::PersistentStorageDelegate * mStorage = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
     ObjectPool<GroupKeyIteratorImpl, kIteratorsMax> mGroupKeyIterators;
     ObjectPool<EndpointIteratorImpl, kIteratorsMax> mEndpointIterators;
+    ObjectPool<GroupEndpointIteratorImpl, kIteratorsMax> mGroupEndpointIterators;
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+
+    IndexedFabric mIndexedFabrics[kEndpointIndexFabrics];
+    IndexedEndpoint mEndpointIndex[kEndpointIndexSize > 0 ? kEndpointIndexSize : 1];
+    size_t mEndpointIndexCount = 0;
 };
 
 } // namespace Credentials
@@ -0,0 +1,253 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include "CachingDeviceAttestationVerifier.h"
+
+#include <credentials/CertificationDeclaration.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+
+namespace chip {
+namespace Credentials {
+
+// Copy of the attestation information of one device, owned by the verifier until onCompletion has been called.
+struct CachingDACVerifier::Job
+{
+    Job(const AttestationInfo & source, Callback::Callback<OnAttestationInformationVerification> * completion) :
+        attestationElements(source.attestationElementsBuffer.begin(), source.attestationElementsBuffer.end()),
+        attestationChallenge(source.attestationChallengeBuffer.begin(), source.attestationChallengeBuffer.end()),
+        attestationSignature(source.attestationSignatureBuffer.begin(), source.attestationSignatureBuffer.end()),
+        paiDer(source.paiDerBuffer.begin(), source.paiDerBuffer.end()),
+        dacDer(source.dacDerBuffer.begin(), source.dacDerBuffer.end()),
+        attestationNonce(source.attestationNonceBuffer.begin(), source.attestationNonceBuffer.end()),
+        info(ByteSpan(attestationElements.data(), attestationElements.size()),
+             ByteSpan(attestationChallenge.data(), attestationChallenge.size()),
+             ByteSpan(attestationSignature.data(), attestationSignature.size()), ByteSpan(paiDer.data(), paiDer.size()),
+             ByteSpan(dacDer.data(), dacDer.size()), ByteSpan(attestationNonce.data(), attestationNonce.size()), source.vendorId,
+             source.productId),
+        onCompletion(completion)
+    {}
+
+    std::vector<uint8_t> attestationElements;
+    std::vector<uint8_t> attestationChallenge;
+    std::vector<uint8_t> attestationSignature;
+    std::vector<uint8_t> paiDer;
+    std::vector<uint8_t> dacDer;
+    std::vector<uint8_t> attestationNonce;
+    AttestationInfo info;
+    Callback::Callback<OnAttestationInformationVerification> * onCompletion;
+    AttestationVerificationResult result = AttestationVerificationResult::kNotImplemented;
+};
+
+template <typename T>
+void CachingDACVerifier::Cache<T>::Insert(const Digest & key, T && value, size_t maxEntries)
+{
+    VerifyOrReturn(maxEntries > 0);
+
+    if (entries.find(key) != entries.end())
+    {
+        // Another thread got there first; both outcomes are the same.
+        return;
+    }
+
+    while (entries.size() >= maxEntries)
+    {
+        entries.erase(order.front());
+        order.pop_front();
+    }
+
+    entries.emplace(key, std::move(value));
+    order.push_back(key);
+}
+
+CachingDACVerifier::CachingDACVerifier(const AttestationTrustStore * paaRootStore, size_t workerThreads, size_t maxCacheEntries) :
+    DefaultDACVerifier(paaRootStore), mMaxCacheEntries(maxCacheEntries)
+{
+    for (size_t i = 0; i < workerThreads; i++)
+    {
+        mWorkers.emplace_back(&CachingDACVerifier::WorkerLoop, this);
+    }
+}
+
+CachingDACVerifier::~CachingDACVerifier()
+{
+    {
+        std::lock_guard<std::mutex> lock(mJobsMutex);
+        mShuttingDown = true;
+    }
+    mJobsCondition.notify_all();
+
+    for (auto & worker : mWorkers)
+    {
+        worker.join();
+    }
+
+    // Verifications that never started are dropped: the verifier only goes away with the commissioner.
+    for (Job * job : mJobs)
+    {
+        Platform::Delete(job);
+    }
+}
+
+void CachingDACVerifier::VerifyAttestationInformation(const DeviceAttestationVerifier::AttestationInfo & info,
+                                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    VerifyOrReturn(onCompletion != nullptr);
+
+    if (mWorkers.empty())
+    {
+        onCompletion->mCall(onCompletion->mContext, info, ValidateAttestationInformation(info));
+        return;
+    }
+
+    Job * job = Platform::New<Job>(info, onCompletion);
+    if (job == nullptr)
+    {
+        onCompletion->mCall(onCompletion->mContext, info, AttestationVerificationResult::kNoMemory);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mJobsMutex);
+        mJobs.push_back(job);
+    }
+    mJobsCondition.notify_one();
+}
+
+void CachingDACVerifier::WorkerLoop()
+{
+    while (true)
+    {
+        Job * job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mJobsMutex);
+            mJobsCondition.wait(lock, [this] { return mShuttingDown || !mJobs.empty(); });
+            VerifyOrReturn(!mShuttingDown);
+            job = mJobs.front();
+            mJobs.pop_front();
+        }
+
+        job->result = ValidateAttestationInformation(job->info);
+        DeviceLayer::PlatformMgr().ScheduleWork(CompleteJob, reinterpret_cast<intptr_t>(job));
+    }
+}
+
+void CachingDACVerifier::CompleteJob(intptr_t arg)
+{
+    Job * job = reinterpret_cast<Job *>(arg);
+    job->onCompletion->mCall(job->onCompletion->mContext, job->info, job->result);
+    Platform::Delete(job);
+}
+
+bool CachingDACVerifier::ComputeDigest(const ByteSpan & data, Digest & digest)
+{
+    return Crypto::Hash_SHA256(data.data(), data.size(), digest.data()) == CHIP_NO_ERROR;
+}
+
+AttestationVerificationResult CachingDACVerifier::ResolvePaa(const ByteSpan & paiDerBuffer,
+                                                             const Crypto::AttestationCertVidPid & paiVidPid,
+                                                             MutableByteSpan & paaDerBuffer,
+                                                             Crypto::AttestationCertVidPid & paaVidPid)
+{
+    Digest key;
+    bool cacheable = ComputeDigest(paiDerBuffer, key);
+
+    if (cacheable)
+    {
+        std::lock_guard<std::mutex> lock(mCacheMutex);
+        auto entry = mPaaCache.entries.find(key);
+        if (entry != mPaaCache.entries.end())
+        {
+            const std::vector<uint8_t> & paaDer = entry->second.paaDer;
+            mStatistics.paiHits++;
+            VerifyOrReturnError(CopySpanToMutableSpan(ByteSpan(paaDer.data(), paaDer.size()), paaDerBuffer) == CHIP_NO_ERROR,
+                                AttestationVerificationResult::kNoMemory);
+            paaVidPid = entry->second.paaVidPid;
+            return AttestationVerificationResult::kSuccess;
+        }
+        mStatistics.paiMisses++;
+    }
+
+    AttestationVerificationResult result = DefaultDACVerifier::ResolvePaa(paiDerBuffer, paiVidPid, paaDerBuffer, paaVidPid);
+
+    if (cacheable && result == AttestationVerificationResult::kSuccess)
+    {
+        PaaEntry entry{ std::vector<uint8_t>(paaDerBuffer.begin(), paaDerBuffer.end()), paaVidPid };
+        std::lock_guard<std::mutex> lock(mCacheMutex);
+        mPaaCache.Insert(key, std::move(entry), mMaxCacheEntries);
+    }
+
+    return result;
+}
+
+AttestationVerificationResult CachingDACVerifier::ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                                            ByteSpan & certDeclBuffer)
+{
+    Digest key;
+    bool cacheable = !cmsEnvelopeBuffer.empty() && ComputeDigest(cmsEnvelopeBuffer, key);
+
+    if (cacheable)
+    {
+        std::lock_guard<std::mutex> lock(mCacheMutex);
+        auto entry = mCdCache.entries.find(key);
+        if (entry != mCdCache.entries.end())
+        {
+            mStatistics.cdHits++;
+            // Test key support may have been turned off since the signature was verified.
+            VerifyOrReturnError(!entry->second.signedWithTestKey || IsCdTestKeySupported(),
+                                AttestationVerificationResult::kCertificationDeclarationNoCertificateFound);
+            certDeclBuffer = cmsEnvelopeBuffer.SubSpan(entry->second.contentOffset, entry->second.contentLength);
+            return AttestationVerificationResult::kSuccess;
+        }
+        mStatistics.cdMisses++;
+    }
+
+    AttestationVerificationResult result =
+        DefaultDACVerifier::ValidateCertificationDeclarationSignature(cmsEnvelopeBuffer, certDeclBuffer);
+
+    // The CD content returned by CMS_Verify points into the envelope, so its location is all there is to remember.
+    if (cacheable && result == AttestationVerificationResult::kSuccess && certDeclBuffer.data() >= cmsEnvelopeBuffer.data() &&
+        certDeclBuffer.data() + certDeclBuffer.size() <= cmsEnvelopeBuffer.data() + cmsEnvelopeBuffer.size())
+    {
+        ByteSpan kid;
+        CdEntry entry;
+        entry.contentOffset     = static_cast<size_t>(certDeclBuffer.data() - cmsEnvelopeBuffer.data());
+        entry.contentLength     = certDeclBuffer.size();
+        entry.signedWithTestKey = CMS_ExtractKeyId(cmsEnvelopeBuffer, kid) == CHIP_NO_ERROR && mCdKeysTrustStore.IsCdTestKey(kid);
+
+        std::lock_guard<std::mutex> lock(mCacheMutex);
+        mCdCache.Insert(key, std::move(entry), mMaxCacheEntries);
+    }
+
+    return result;
+}
+
+CachingDACVerifier::Statistics CachingDACVerifier::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mCacheMutex);
+    return mStatistics;
+}
+
+void CachingDACVerifier::ClearCache()
+{
+    std::lock_guard<std::mutex> lock(mCacheMutex);
+    mPaaCache.Clear();
+    mCdCache.Clear();
+    mStatistics = Statistics();
+}
+
+} // namespace Credentials
+} // namespace chip
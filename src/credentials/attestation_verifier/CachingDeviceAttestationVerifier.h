@@ -0,0 +1,139 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
+#include <crypto/CHIPCryptoPAL.h>
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * @brief
+ *   A DefaultDACVerifier for commissioners attesting many devices from the same few vendors, e.g. on a production line.
+ *
+ *   Devices of one product share their PAI and Certification Declaration, so the outcome of resolving a PAI to its PAA
+ *   (trust store lookup, PAA format and VID scoping checks) and of verifying a CD signature is cached, keyed by the
+ *   SHA-256 of the PAI and of the CMS envelope respectively. Only successful outcomes are cached; anything specific to
+ *   a device (DAC, attestation signature, nonce, chain validation) is checked for every device.
+ *
+ *   When constructed with worker threads, VerifyAttestationInformation copies the attestation information, validates it
+ *   on one of the workers and calls onCompletion back on the Matter thread, so that the attestation of several devices
+ *   does not serialize on the Matter thread. The CD keys trust store must not be modified while verifications are
+ *   pending.
+ */
+class CachingDACVerifier : public DefaultDACVerifier
+{
+public:
+    static constexpr size_t kDefaultMaxCacheEntries = 64;
+
+    struct Statistics
+    {
+        size_t paiHits   = 0;
+        size_t paiMisses = 0;
+        size_t cdHits    = 0;
+        size_t cdMisses  = 0;
+    };
+
+    /**
+     * @param paaRootStore     PAA trust store, ideally indexed by subject key ID (see FileAttestationTrustStore)
+     * @param workerThreads    number of threads validating attestations; 0 validates on the calling thread
+     * @param maxCacheEntries  maximum number of PAIs, and of CDs, remembered; the oldest entry is evicted first
+     */
+    CachingDACVerifier(const AttestationTrustStore * paaRootStore, size_t workerThreads = 0,
+                       size_t maxCacheEntries = kDefaultMaxCacheEntries);
+    ~CachingDACVerifier() override;
+
+    void VerifyAttestationInformation(const DeviceAttestationVerifier::AttestationInfo & info,
+                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+
+    AttestationVerificationResult ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                            ByteSpan & certDeclBuffer) override;
+
+    Statistics GetStatistics() const;
+
+    /**
+     * @brief Forget every cached outcome, e.g. after the PAA trust store or the CD keys changed.
+     */
+    void ClearCache();
+
+protected:
+    AttestationVerificationResult ResolvePaa(const ByteSpan & paiDerBuffer, const Crypto::AttestationCertVidPid & paiVidPid,
+                                             MutableByteSpan & paaDerBuffer, Crypto::AttestationCertVidPid & paaVidPid) override;
+
+private:
+    using Digest = std::array<uint8_t, Crypto::kSHA256_Hash_Length>;
+
+    struct PaaEntry
+    {
+        std::vector<uint8_t> paaDer;
+        Crypto::AttestationCertVidPid paaVidPid;
+    };
+
+    struct CdEntry
+    {
+        // Location of the CD content within the CMS envelope.
+        size_t contentOffset;
+        size_t contentLength;
+        bool signedWithTestKey;
+    };
+
+    // Insertion-ordered map bounded to mMaxCacheEntries.
+    template <typename T>
+    struct Cache
+    {
+        std::map<Digest, T> entries;
+        std::deque<Digest> order;
+
+        void Insert(const Digest & key, T && value, size_t maxEntries);
+        void Clear()
+        {
+            entries.clear();
+            order.clear();
+        }
+    };
+
+    struct Job;
+
+    static bool ComputeDigest(const ByteSpan & data, Digest & digest);
+    static void CompleteJob(intptr_t arg);
+    void WorkerLoop();
+
+    const size_t mMaxCacheEntries;
+
+    mutable std::mutex mCacheMutex;
+    Cache<PaaEntry> mPaaCache;
+    Cache<CdEntry> mCdCache;
+    Statistics mStatistics;
+
+    std::mutex mJobsMutex;
+    std::condition_variable mJobsCondition;
+    std::deque<Job *> mJobs;
+    bool mShuttingDown = false;
+    std::vector<std::thread> mWorkers;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -311,6 +311,48 @@ AttestationVerificationResult MapError(CertificateChainValidationResult certific
 
 void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVerifier::AttestationInfo & info,
                                                       Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    VerifyOrReturn(onCompletion != nullptr);
+
+    onCompletion->mCall(onCompletion->mContext, info, ValidateAttestationInformation(info));
+}
+
+AttestationVerificationResult DefaultDACVerifier::ResolvePaa(const ByteSpan & paiDerBuffer, const AttestationCertVidPid & paiVidPid,
+                                                             MutableByteSpan & paaDerBuffer, AttestationCertVidPid & paaVidPid)
+{
+    uint8_t akidBuf[Crypto::kAuthorityKeyIdentifierLength];
+    MutableByteSpan akid(akidBuf);
+    MutableByteSpan paaDer = paaDerBuffer;
+    CHIP_ERROR err         = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(ExtractAKIDFromX509Cert(paiDerBuffer, akid) == CHIP_NO_ERROR,
+                        AttestationVerificationResult::kPaiFormatInvalid);
+
+    err = mAttestationTrustStore->GetProductAttestationAuthorityCert(akid, paaDer);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_IMPLEMENTED, AttestationVerificationResult::kPaaNotFound);
+
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        paaDer = paaDerBuffer;
+        VerifyOrReturnError(kTestAttestationTrustStore.GetProductAttestationAuthorityCert(akid, paaDer) == CHIP_NO_ERROR,
+                            AttestationVerificationResult::kPaaNotFound);
+    }
+
+    VerifyOrReturnError(ExtractVIDPIDFromX509Cert(paaDer, paaVidPid) == CHIP_NO_ERROR,
+                        AttestationVerificationResult::kPaaFormatInvalid);
+
+    if (paaVidPid.mVendorId.HasValue())
+    {
+        VerifyOrReturnError(paaVidPid.mVendorId == paiVidPid.mVendorId, AttestationVerificationResult::kPaiVendorIdMismatch);
+    }
+
+    VerifyOrReturnError(!paaVidPid.mProductId.HasValue(), AttestationVerificationResult::kPaaFormatInvalid);
+
+    paaDerBuffer = paaDer;
+    return AttestationVerificationResult::kSuccess;
+}
+
+AttestationVerificationResult DefaultDACVerifier::ValidateAttestationInformation(const AttestationInfo & info)
 {
     AttestationVerificationResult attestationError = AttestationVerificationResult::kSuccess;
 
@@ -322,7 +364,7 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
 
     VerifyOrExit(!info.attestationElementsBuffer.empty() && !info.attestationChallengeBuffer.empty() &&
                      !info.attestationSignatureBuffer.empty() && !info.dacDerBuffer.empty() &&
-                     !info.attestationNonceBuffer.empty() && onCompletion != nullptr,
+                     !info.attestationNonceBuffer.empty(),
                  attestationError = AttestationVerificationResult::kInvalidArgument);
 
     VerifyOrExit(info.attestationElementsBuffer.size() <= kMaxResponseLength,
@@ -373,37 +415,13 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     }
 
     {
-        uint8_t akidBuf[Crypto::kAuthorityKeyIdentifierLength];
-        MutableByteSpan akid(akidBuf);
         constexpr size_t paaCertAllocatedLen = kMaxDERCertLength;
-        CHIP_ERROR err                       = CHIP_NO_ERROR;
-
-        VerifyOrExit(ExtractAKIDFromX509Cert(info.paiDerBuffer, akid) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaiFormatInvalid);
 
         VerifyOrExit(paaCert.Alloc(paaCertAllocatedLen), attestationError = AttestationVerificationResult::kNoMemory);
 
-        paaDerBuffer = MutableByteSpan(paaCert.Get(), paaCertAllocatedLen);
-        err          = mAttestationTrustStore->GetProductAttestationAuthorityCert(akid, paaDerBuffer);
-        VerifyOrExit(err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_IMPLEMENTED,
-                     attestationError = AttestationVerificationResult::kPaaNotFound);
-
-        if (err == CHIP_ERROR_NOT_IMPLEMENTED)
-        {
-            VerifyOrExit(kTestAttestationTrustStore.GetProductAttestationAuthorityCert(akid, paaDerBuffer) == CHIP_NO_ERROR,
-                         attestationError = AttestationVerificationResult::kPaaNotFound);
-        }
-
-        VerifyOrExit(ExtractVIDPIDFromX509Cert(paaDerBuffer, paaVidPid) == CHIP_NO_ERROR,
-                     attestationError = AttestationVerificationResult::kPaaFormatInvalid);
-
-        if (paaVidPid.mVendorId.HasValue())
-        {
-            VerifyOrExit(paaVidPid.mVendorId == paiVidPid.mVendorId,
-                         attestationError = AttestationVerificationResult::kPaiVendorIdMismatch);
-        }
-
-        VerifyOrExit(!paaVidPid.mProductId.HasValue(), attestationError = AttestationVerificationResult::kPaaFormatInvalid);
+        paaDerBuffer     = MutableByteSpan(paaCert.Get(), paaCertAllocatedLen);
+        attestationError = ResolvePaa(info.paiDerBuffer, paiVidPid, paaDerBuffer, paaVidPid);
+        VerifyOrExit(attestationError == AttestationVerificationResult::kSuccess, attestationError = attestationError);
     }
 
 #if !defined(CURRENT_TIME_NOT_IMPLEMENTED)
@@ -458,7 +476,7 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     }
 
 exit:
-    onCompletion->mCall(onCompletion->mContext, info, attestationError);
+    return attestationError;
 }
 
 AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
@@ -79,6 +79,25 @@ public:
 protected:
     DefaultDACVerifier() {}
 
+    /**
+     * @brief Synchronously run every check of VerifyAttestationInformation and return the outcome.
+     *
+     * Only uses the buffers referenced by info, so that it may be run from another thread than the Matter
+     * stack as long as those buffers are not modified meanwhile.
+     */
+    AttestationVerificationResult ValidateAttestationInformation(const AttestationInfo & info);
+
+    /**
+     * @brief Find the PAA that issued a PAI in the trust store and check that the PAA may issue it.
+     *
+     * @param[in] paiDerBuffer      DER of the PAI
+     * @param[in] paiVidPid         VID/PID extracted from the PAI
+     * @param[in,out] paaDerBuffer  buffer of at least kMaxDERCertLength bytes, resized to the PAA DER on success
+     * @param[out] paaVidPid        VID/PID extracted from the PAA
+     */
+    virtual AttestationVerificationResult ResolvePaa(const ByteSpan & paiDerBuffer, const Crypto::AttestationCertVidPid & paiVidPid,
+                                                     MutableByteSpan & paaDerBuffer, Crypto::AttestationCertVidPid & paaVidPid);
+
     CsaCdKeysTrustStore mCdKeysTrustStore;
     const AttestationTrustStore * mAttestationTrustStore;
 };
@@ -17,6 +17,8 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -48,6 +50,7 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
     {
         mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
         VerifyOrReturn(paaCount());
+        IndexPAACerts();
     }
 
     mIsInitialized = true;
@@ -123,9 +126,32 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 void FileAttestationTrustStore::Cleanup()
 {
     mPAADerCerts.clear();
+    mPAAIndex.clear();
     mIsInitialized = false;
 }
 
+void FileAttestationTrustStore::IndexPAACerts()
+{
+    mPAAIndex.clear();
+    mPAAIndex.reserve(mPAADerCerts.size());
+
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        const std::vector<uint8_t> & paa = mPAADerCerts[i];
+        Skid skid;
+        MutableByteSpan skidSpan{ skid };
+        if (CHIP_NO_ERROR == Crypto::ExtractSKIDFromX509Cert(ByteSpan{ paa.data(), paa.size() }, skidSpan) &&
+            skidSpan.size() == skid.size())
+        {
+            mPAAIndex.emplace_back(skid, i);
+        }
+    }
+
+    // Stable so that the first of several certificates sharing a SKID wins, as with the former linear search.
+    std::stable_sort(mPAAIndex.begin(), mPAAIndex.end(),
+                     [](const std::pair<Skid, size_t> & a, const std::pair<Skid, size_t> & b) { return a.first < b.first; });
+}
+
 CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const ByteSpan & skid,
                                                                          MutableByteSpan & outPaaDerBuffer) const
 {
@@ -140,20 +166,15 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
+    Skid key;
+    memcpy(key.data(), skid.data(), key.size());
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
+    auto match = std::lower_bound(mPAAIndex.begin(), mPAAIndex.end(), key,
+                                  [](const std::pair<Skid, size_t> & entry, const Skid & value) { return entry.first < value; });
+    if (match != mPAAIndex.end() && match->first == key)
+    {
+        const std::vector<uint8_t> & paa = mPAADerCerts[match->second];
+        return CopySpanToMutableSpan(ByteSpan{ paa.data(), paa.size() }, outPaaDerBuffer);
     }
 
     return CHIP_ERROR_CA_CERT_NOT_FOUND;
@@ -20,6 +20,7 @@
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 
 #include <array>
+#include <utility>
 #include <vector>
 
 namespace chip {
@@ -49,7 +50,14 @@ public:
     size_t paaCount() const { return mPAADerCerts.size(); };
 
 protected:
+    using Skid = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+    // Rebuild mPAAIndex after mPAADerCerts has been modified.
+    void IndexPAACerts();
+
     std::vector<std::vector<uint8_t>> mPAADerCerts;
+    // (SKID, index in mPAADerCerts) of every PAA, sorted by SKID so that lookups do not re-parse the certificates.
+    std::vector<std::pair<Skid, size_t>> mPAAIndex;
 
 private:
     bool mIsInitialized = false;
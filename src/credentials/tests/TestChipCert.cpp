@@ -25,6 +25,7 @@
  */
 
 #include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateCache.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -1240,6 +1241,60 @@ static void TestChipCert_LoadDuplicateCerts(nlTestSuite * inSuite, void * inCont
     NL_TEST_ASSERT(inSuite, certSet.GetCertCount() == 3);
 }
 
+static void TestChipCert_CertificateCache(nlTestSuite * inSuite, void * inContext)
+{
+    ChipCertificateCache & cache = ChipCertificateCache::Instance();
+    ValidationContext validContext;
+
+    cache.Clear();
+
+    // Validate the same chain twice, with a fresh certificate set each time, as CASE does for every session.
+    for (int pass = 0; pass < 2; pass++)
+    {
+        ChipCertificateSet certSet;
+        NL_TEST_ASSERT(inSuite, certSet.Init(kStandardCertsCount) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, LoadTestCert(certSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, LoadTestCert(certSet, TestCert::kNode01_01, sNullLoadFlag, sGenTBSHashFlag) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, certSet.GetCertSet()[0].mCertFlags.Has(CertFlags::kIsTrustAnchor));
+
+        validContext.Reset();
+        NL_TEST_ASSERT(inSuite, SetCurrentTime(validContext, 2021, 1, 1) == CHIP_NO_ERROR);
+        validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+        validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+        NL_TEST_ASSERT(inSuite, certSet.ValidateCert(certSet.GetLastCert(), validContext) == CHIP_NO_ERROR);
+    }
+
+#if CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+    // The second pass decodes nothing and verifies no signature.
+    const ChipCertificateCache::Statistics & stats = cache.GetStatistics();
+    NL_TEST_ASSERT(inSuite, stats.decodeMisses == 3);
+    NL_TEST_ASSERT(inSuite, stats.decodeHits == 3);
+    NL_TEST_ASSERT(inSuite, stats.signatureMisses == 2);
+    NL_TEST_ASSERT(inSuite, stats.signatureHits == 2);
+
+    // A corrupted signature is not covered by the cached verification.
+    {
+        ChipCertificateSet certSet;
+        NL_TEST_ASSERT(inSuite, certSet.Init(kStandardCertsCount) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, LoadTestCert(certSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag) == CHIP_NO_ERROR);
+
+        ChipCertificateData * icaCert = const_cast<ChipCertificateData *>(certSet.GetLastCert());
+        uint8_t signature[kP256_ECDSA_Signature_Length_Raw];
+        memcpy(signature, icaCert->mSignature.data(), sizeof(signature));
+        signature[0] ^= 0x01;
+        icaCert->mSignature = P256ECDSASignatureSpan(signature);
+
+        NL_TEST_ASSERT(inSuite, certSet.VerifySignature(icaCert, certSet.GetCertSet()) != CHIP_NO_ERROR);
+    }
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE > 0
+
+    cache.Clear();
+}
+
 static void TestChipCert_GenerateRootCert(nlTestSuite * inSuite, void * inContext)
 {
     // Generate a new keypair for cert signing
@@ -2058,6 +2113,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test CHIP Certificate Type", TestChipCert_CertType),
     NL_TEST_DEF("Test CHIP Certificate ID", TestChipCert_CertId),
     NL_TEST_DEF("Test Loading Duplicate Certificates", TestChipCert_LoadDuplicateCerts),
+    NL_TEST_DEF("Test CHIP Certificate Cache", TestChipCert_CertificateCache),
     NL_TEST_DEF("Test CHIP Generate Root Certificate", TestChipCert_GenerateRootCert),
     NL_TEST_DEF("Test CHIP Generate Root Certificate with Fabric", TestChipCert_GenerateRootFabCert),
     NL_TEST_DEF("Test CHIP Generate ICA Certificate", TestChipCert_GenerateICACert),
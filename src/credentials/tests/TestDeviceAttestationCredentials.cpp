@@ -20,6 +20,7 @@
 #include <credentials/CHIPCert.h>
 #include <credentials/CertificationDeclaration.h>
 #include <credentials/DeviceAttestationCredsProvider.h>
+#include <credentials/attestation_verifier/CachingDeviceAttestationVerifier.h>
 #include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 #include <credentials/examples/DeviceAttestationCredsExample.h>
@@ -216,6 +217,30 @@ static void TestDACVerifierExample_AttestationInfoVerification(nlTestSuite * inS
     default_verifier->VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
 
     NL_TEST_ASSERT(inSuite, attestationResult == AttestationVerificationResult::kSuccess);
+
+    // The caching verifier reaches the same outcome, and reuses the PAI and CD outcomes for the next device.
+    CachingDACVerifier caching_verifier(GetTestAttestationTrustStore());
+    for (int i = 0; i < 2; i++)
+    {
+        attestationResult = AttestationVerificationResult::kNotImplemented;
+        caching_verifier.VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+        NL_TEST_ASSERT(inSuite, attestationResult == AttestationVerificationResult::kSuccess);
+    }
+
+    CachingDACVerifier::Statistics statistics = caching_verifier.GetStatistics();
+    NL_TEST_ASSERT(inSuite, statistics.paiMisses == 1 && statistics.paiHits == 1);
+    NL_TEST_ASSERT(inSuite, statistics.cdMisses == 1 && statistics.cdHits == 1);
+
+    // Cached outcomes do not relax the checks specific to a device.
+    uint8_t badNonce[sizeof(attestationNonceTestVector)];
+    memcpy(badNonce, attestationNonceTestVector, sizeof(badNonce));
+    badNonce[0] ^= 0xFF;
+    Credentials::DeviceAttestationVerifier::AttestationInfo badNonceInfo(
+        ByteSpan(attestationElementsTestVector), ByteSpan(attestationChallengeTestVector), ByteSpan(attestationSignatureTestVector),
+        TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, ByteSpan(badNonce),
+        static_cast<VendorId>(0xFFF1), 0x8000);
+    caching_verifier.VerifyAttestationInformation(badNonceInfo, &attestationInformationVerificationCallback);
+    NL_TEST_ASSERT(inSuite, attestationResult == AttestationVerificationResult::kAttestationNonceMismatch);
 }
 
 static void TestDACVerifierExample_CertDeclarationVerification(nlTestSuite * inSuite, void * inContext)
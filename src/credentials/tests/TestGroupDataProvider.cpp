@@ -554,6 +554,112 @@ void TestEndpointIterator(nlTestSuite * apSuite, void * apContext)
     }
 }
 
+void TestGroupEndpointIterator(nlTestSuite * apSuite, void * apContext)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    NL_TEST_ASSERT(apSuite, provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric1, kGroup1, kEndpointId4));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric1, kGroup1, kEndpointId0));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric1, kGroup2, kEndpointId1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric1, kGroup1, kEndpointId2));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric2, kGroup1, kEndpointId3));
+
+    // Only the endpoints of the requested group and fabric, in endpoint order
+    auto it = provider->IterateEndpoints(kFabric1, kGroup1);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        const EndpointId expected[] = { kEndpointId0, kEndpointId2, kEndpointId4 };
+        GroupEndpoint output;
+        size_t count = 0;
+        NL_TEST_ASSERT(apSuite, ArraySize(expected) == it->Count());
+        while (it->Next(output) && count < ArraySize(expected))
+        {
+            NL_TEST_ASSERT(apSuite, kGroup1 == output.group_id);
+            NL_TEST_ASSERT(apSuite, expected[count] == output.endpoint_id);
+            count++;
+        }
+        NL_TEST_ASSERT(apSuite, ArraySize(expected) == count);
+        it->Release();
+    }
+
+    // Changes made while iterating are picked up
+    it = provider->IterateEndpoints(kFabric1, kGroup1);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        GroupEndpoint output;
+        NL_TEST_ASSERT(apSuite, it->Next(output) && kEndpointId0 == output.endpoint_id);
+        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveEndpoint(kFabric1, kGroup1, kEndpointId2));
+        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric1, kGroup1, kEndpointId3));
+        NL_TEST_ASSERT(apSuite, it->Next(output) && kEndpointId3 == output.endpoint_id);
+        NL_TEST_ASSERT(apSuite, it->Next(output) && kEndpointId4 == output.endpoint_id);
+        NL_TEST_ASSERT(apSuite, !it->Next(output));
+        it->Release();
+    }
+
+    // Unknown group
+    it = provider->IterateEndpoints(kFabric2, kGroup2);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        GroupEndpoint output;
+        NL_TEST_ASSERT(apSuite, 0 == it->Count());
+        NL_TEST_ASSERT(apSuite, !it->Next(output));
+        it->Release();
+    }
+
+    // A fabric with more mappings than the index holds is read from storage
+    constexpr size_t kManyEndpoints = GroupDataProviderImpl::kEndpointIndexSize + 4;
+    for (EndpointId endpoint = 1; endpoint <= kManyEndpoints; endpoint++)
+    {
+        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->AddEndpoint(kFabric2, kGroup3, endpoint));
+    }
+
+    it = provider->IterateEndpoints(kFabric2, kGroup3);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        GroupEndpoint output;
+        size_t count = 0;
+        NL_TEST_ASSERT(apSuite, kManyEndpoints == it->Count());
+        while (it->Next(output))
+        {
+            NL_TEST_ASSERT(apSuite, kGroup3 == output.group_id);
+            NL_TEST_ASSERT(apSuite, ++count == output.endpoint_id);
+        }
+        NL_TEST_ASSERT(apSuite, kManyEndpoints == count);
+        it->Release();
+    }
+
+    it = provider->IterateEndpoints(kFabric2, kGroup1);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        GroupEndpoint output;
+        NL_TEST_ASSERT(apSuite, 1 == it->Count());
+        NL_TEST_ASSERT(apSuite, it->Next(output) && kEndpointId3 == output.endpoint_id);
+        NL_TEST_ASSERT(apSuite, !it->Next(output));
+        it->Release();
+    }
+
+    // Removing the fabric drops its mappings
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveFabric(kFabric1));
+    it = provider->IterateEndpoints(kFabric1, kGroup1);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        GroupEndpoint output;
+        NL_TEST_ASSERT(apSuite, 0 == it->Count());
+        NL_TEST_ASSERT(apSuite, !it->Next(output));
+        it->Release();
+    }
+}
+
 void TestGroupKeys(nlTestSuite * apSuite, void * apContext)
 {
     GroupDataProvider * provider = GetGroupDataProvider();
@@ -1251,6 +1357,7 @@ const nlTest sTests[] = { NL_TEST_DEF("TestStorageDelegate", chip::app::TestGrou
                           NL_TEST_DEF("TestGroupInfoIterator", chip::app::TestGroups::TestGroupInfoIterator),
                           NL_TEST_DEF("TestEndpoints", chip::app::TestGroups::TestEndpoints),
                           NL_TEST_DEF("TestEndpointIterator", chip::app::TestGroups::TestEndpointIterator),
+                          NL_TEST_DEF("TestGroupEndpointIterator", chip::app::TestGroups::TestGroupEndpointIterator),
                           NL_TEST_DEF("TestGroupKeys", chip::app::TestGroups::TestGroupKeys),
                           NL_TEST_DEF("TestGroupKeyIterator", chip::app::TestGroups::TestGroupKeyIterator),
                           NL_TEST_DEF("TestKeySets", chip::app::TestGroups::TestKeySets),
@@ -91,6 +91,17 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+ *
+ * The number of events that can be held in the lock-free event queue used by the POSIX
+ * platform manager.  Must be a power of two.  Posting an event to a full queue fails with
+ * CHIP_ERROR_NO_MEMORY.
+ */
+#ifndef CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE 1024
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_LOG_PROVISIONING_HASH
  *
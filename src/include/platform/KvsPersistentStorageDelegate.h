@@ -24,6 +24,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <platform/KeyValueStoreManager.h>
+#include <system/SystemMetrics.h>
 
 namespace chip {
 
@@ -94,6 +95,9 @@ public:
                 return CHIP_ERROR_INVALID_ARGUMENT;
             }
         }
+
+        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_StorageWrites);
+        SYSTEM_METRICS_RECORD_LATENCY_SCOPE(System::Metrics::kHistogram_StorageWriteLatencyUs);
         return mKvsManager->Put(key, value, size);
     }
 
@@ -51,6 +51,14 @@ namespace Internal {
 template <class ImplClass>
 class GenericPlatformManagerImpl_POSIX : public GenericPlatformManagerImpl<ImplClass>
 {
+public:
+    using EventQueueStats = DeviceSafeQueue::Stats;
+
+    /**
+     * Snapshot the depth, overflow and latency counters of the event queue.  Safe to call from any thread.
+     */
+    void GetEventQueueStats(EventQueueStats & stats) const { mChipEventQueue.GetStats(stats); }
+
 protected:
     // OS-specific members (pthread)
     pthread_mutex_t mChipStackLock = PTHREAD_MUTEX_INITIALIZER;
@@ -109,6 +117,8 @@ private:
     void ProcessDeviceEvents();
 
     DeviceSafeQueue mChipEventQueue;
+    // Set by the first PostEvent() after the event loop last drained the queue; only that caller wakes the loop.
+    std::atomic<bool> mEventQueueWakePending{ false };
     std::atomic<bool> mShouldRunEventLoop;
     static void * EventLoopTaskMain(void * arg);
 };
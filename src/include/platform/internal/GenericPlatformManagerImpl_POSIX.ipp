@@ -61,6 +61,18 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_InitChipStack()
 
     mShouldRunEventLoop.store(true, std::memory_order_relaxed);
 
+    // A wakeup signalled before a previous Shutdown() was lost along with the old wake event; re-arm it
+    // for anything still queued so that later posts are not coalesced into a wakeup that never comes.
+    if (!mChipEventQueue.Empty())
+    {
+        mEventQueueWakePending.store(true, std::memory_order_release);
+        SystemLayerSocketsLoop().Signal();
+    }
+    else
+    {
+        mEventQueueWakePending.store(false, std::memory_order_release);
+    }
+
     int ret = pthread_cond_init(&mEventQueueStoppedCond, nullptr);
     VerifyOrReturnError(ret == 0, CHIP_ERROR_POSIX(ret));
 
@@ -131,19 +143,34 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartChipTimer(System::
 template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    mChipEventQueue.Push(*event);
+    if (!mChipEventQueue.Push(*event))
+    {
+        ChipLogError(DeviceLayer, "Event queue full, dropping event type 0x%04x", event->Type);
+        return CHIP_ERROR_NO_MEMORY;
+    }
 
-    SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    // Coalesce wakeups: a burst of events posted before the event loop gets to run costs a single
+    // write to the wake event.
+    if (!mEventQueueWakePending.exchange(true, std::memory_order_acq_rel))
+    {
+        SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    }
     return CHIP_NO_ERROR;
 }
 
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+    // Clear the wake flag before draining so that any event posted from now on triggers another wakeup.
+    // Events posted while we drain (including from the handlers themselves) set the flag again, in which
+    // case we go around once more rather than leave them waiting for an unrelated wakeup.
+    while (mEventQueueWakePending.exchange(false, std::memory_order_acq_rel))
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
-        Impl()->DispatchEvent(&event);
+        ChipDeviceEvent event;
+        while (mChipEventQueue.PopFront(event))
+        {
+            Impl()->DispatchEvent(&event);
+        }
     }
 }
 
@@ -250,4 +250,38 @@
 #ifndef INET_CONFIG_IP_MULTICAST_HOP_LIMIT
 #define INET_CONFIG_IP_MULTICAST_HOP_LIMIT                 (64)
 #endif // INET_CONFIG_IP_MULTICAST_HOP_LIMIT
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams a sockets-based UDP endpoint
+ *    receives, or sends, with a single system call.
+ *
+ *  @details
+ *    Values greater than 1 require recvmmsg() and sendmmsg(), and
+ *    enable the send batching API of UDPEndPoint. Received datagrams
+ *    are read into up to this many packet buffers, which the endpoint
+ *    keeps allocated between reads.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+#if defined(__linux__)
+#define INET_CONFIG_UDP_SOCKET_BATCH_SIZE                  16
+#else
+#define INET_CONFIG_UDP_SOCKET_BATCH_SIZE                  1
+#endif
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_GSO
+ *
+ *  @brief
+ *    Defines whether (1) or not (0) a sockets-based UDP endpoint
+ *    using send batching may coalesce consecutive datagrams of the
+ *    same size, sent to the same destination, into a single UDP
+ *    generic segmentation offload (UDP_SEGMENT) send.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_GSO
+#define INET_CONFIG_UDP_SOCKET_GSO                         1
+#endif // INET_CONFIG_UDP_SOCKET_GSO
 // clang-format on
@@ -41,6 +41,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -67,6 +68,13 @@
 namespace chip {
 namespace Inet {
 
+namespace {
+
+// Maximum number of queued buffers handed to a single sendmsg() call.
+constexpr size_t kMaxSendIOVecs = 16;
+
+} // namespace
+
 CHIP_ERROR TCPEndPointImplSockets::BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr)
 {
     CHIP_ERROR res = GetSocket(addrType);
@@ -484,9 +492,37 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
+        // Gather as much of the send queue as possible into a single sendmsg() call, so that several queued messages
+        // (or a message spanning a chain of buffers) only cost one system call.
+        struct iovec iov[kMaxSendIOVecs];
+        size_t iovCount  = 0;
+        size_t queuedLen = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < kMaxSendIOVecs; buf.Advance())
+        {
+            if (buf->DataLength() == 0)
+            {
+                continue;
+            }
+            iov[iovCount].iov_base = buf->Start();
+            iov[iovCount].iov_len  = buf->DataLength();
+            queuedLen += buf->DataLength();
+            iovCount++;
+        }
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        if (iovCount == 0)
+        {
+            // Only empty buffers are queued.
+            mSendQueue = nullptr;
+            err        = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            break;
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = iov;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -497,43 +533,58 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
             break;
         }
 
-        if (lenSentRaw < 0 || lenSentRaw > bufLen)
+        if (lenSentRaw < 0 || static_cast<size_t>(lenSentRaw) > queuedLen)
         {
             err = CHIP_ERROR_INCORRECT_STATE;
             break;
         }
 
-        // Cast is safe because bufLen is uint16_t.
-        uint16_t lenSent = static_cast<uint16_t>(lenSentRaw);
+        size_t lenSent = static_cast<size_t>(lenSentRaw);
 
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
-        {
-            mSendQueue->ConsumeHead(lenSent);
-        }
-        else
+        // Release the buffers that were sent in full, and consume the start of the one that was partially sent, if any.
+        size_t lenToRelease = lenSent;
+        while (lenToRelease > 0)
         {
+            uint16_t bufLen = mSendQueue->DataLength();
+            if (lenToRelease < bufLen)
+            {
+                mSendQueue->ConsumeHead(static_cast<uint16_t>(lenToRelease));
+                break;
+            }
+            lenToRelease -= bufLen;
             mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            if (OnDataSent != nullptr)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                OnDataSent(this, bufLen);
             }
         }
+        if (lenToRelease > 0 && OnDataSent != nullptr)
+        {
+            // Cast is safe because lenToRelease is less than the length of the head buffer.
+            OnDataSent(this, static_cast<uint16_t>(lenToRelease));
+        }
 
-        if (OnDataSent != nullptr)
+        // Skip over any empty buffers left at the head of the queue.
+        while (!mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
         {
-            OnDataSent(this, lenSent);
+            mSendQueue.FreeHead();
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
+            {
+                break;
+            }
         }
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
-        mBytesWrittenSinceLastProbe += lenSent;
+        mBytesWrittenSinceLastProbe += static_cast<uint32_t>(lenSent);
 
         bool isProgressing = false;
 
@@ -559,8 +610,9 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         }
 #endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
 
-        if (lenSent < bufLen)
+        if (lenSent < queuedLen)
         {
+            // The socket send buffer is full; wait for it to drain.
             break;
         }
     }
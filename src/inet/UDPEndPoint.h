@@ -227,6 +227,29 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Enable or disable send batching.
+     *
+     *  When send batching is enabled, messages passed to \c SendMsg or \c SendTo are queued, and sent together when
+     *  \c FlushPendingSends is called, when the queue is full, or at the end of the current event loop iteration,
+     *  whichever comes first. Errors detected once a message has been queued are logged, and returned by
+     *  \c FlushPendingSends when it is called explicitly.
+     *
+     *  Disabling send batching flushes the queued messages.
+     *
+     * @retval  CHIP_NO_ERROR                   Success: send batching enabled or disabled.
+     * @retval  CHIP_ERROR_NOT_IMPLEMENTED      The endpoint always sends messages immediately.
+     */
+    virtual CHIP_ERROR SetSendBatching(bool aEnable) { return aEnable ? CHIP_ERROR_NOT_IMPLEMENTED : CHIP_NO_ERROR; }
+
+    /**
+     * Send the messages queued while send batching is enabled.
+     *
+     * @retval  CHIP_NO_ERROR   Success: all queued messages were sent, or there were none.
+     * @retval  other           The first error encountered; the other queued messages were still sent.
+     */
+    virtual CHIP_ERROR FlushPendingSends() { return CHIP_NO_ERROR; }
+
     /**
      * Close the endpoint.
      *
@@ -41,6 +41,10 @@
 #include <unistd.h>
 #include <utility>
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1 && INET_CONFIG_UDP_SOCKET_GSO
+#include <netinet/udp.h>
+#endif
+
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
 #ifndef SOCK_CLOEXEC
 #define SOCK_CLOEXEC 0
@@ -80,6 +84,12 @@
     "Neither IPV6_DROP_MEMBERSHIP nor IPV6_LEAVE_GROUP are defined which are required for generalized IPv6 multicast group support."
 #endif // IPV6_DROP_MEMBERSHIP
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1 && INET_CONFIG_UDP_SOCKET_GSO && defined(UDP_SEGMENT)
+#define INET_UDP_SOCKET_USE_GSO 1
+#else
+#define INET_UDP_SOCKET_USE_GSO 0
+#endif
+
 namespace chip {
 namespace Inet {
 
@@ -161,6 +171,193 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+constexpr size_t kControlDataSize = 256;
+
+/**
+ * Fill in the destination of a message to send and, when needed, the IP_PKTINFO/IPV6_PKTINFO control message
+ * selecting its interface and source address.
+ *
+ * `msgHeader` and `controlData` (`kControlDataSize` bytes) must be zeroed.
+ */
+CHIP_ERROR PrepareMessageHeader(IPAddressType addrType, InterfaceId boundIntfId, const IPPacketInfo & aPktInfo,
+                                struct msghdr & msgHeader, SockAddr & peerSockAddr, uint8_t * controlData)
+{
+    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+    msgHeader.msg_name = &peerSockAddr;
+    if (addrType == IPAddressType::kIPv6)
+    {
+        peerSockAddr.in6.sin6_family     = AF_INET6;
+        peerSockAddr.in6.sin6_port       = htons(aPktInfo.DestPort);
+        peerSockAddr.in6.sin6_addr       = aPktInfo.DestAddress.ToIPv6();
+        InterfaceId::PlatformType intfId = aPktInfo.Interface.GetPlatformInterface();
+        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
+        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
+        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        peerSockAddr.in.sin_family = AF_INET;
+        peerSockAddr.in.sin_port   = htons(aPktInfo.DestPort);
+        peerSockAddr.in.sin_addr   = aPktInfo.DestAddress.ToIPv4();
+        msgHeader.msg_namelen      = sizeof(sockaddr_in);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    // If the endpoint has been bound to a particular interface,
+    // and the caller didn't supply a specific interface to send
+    // on, use the bound interface. This appears to be necessary
+    // for messages to multicast addresses, which under Linux
+    // don't seem to get sent out the correct interface, despite
+    // the socket being bound.
+    InterfaceId intf = aPktInfo.Interface;
+    if (!intf.IsPresent())
+    {
+        intf = boundIntfId;
+    }
+
+    // If the packet should be sent over a specific interface, or with a specific source
+    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
+    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
+    // fail with an error.
+    if (intf.IsPresent() || aPktInfo.SrcAddress.Type() != IPAddressType::kAny)
+    {
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = kControlDataSize;
+
+        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
+        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+
+#if INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv4)
+        {
+#if defined(IP_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IP;
+            controlHdr->cmsg_type  = IP_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+            }
+
+            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
+            pktInfo->ipi_spec_dst = aPktInfo.SrcAddress.ToIPv4();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
+#else  // !defined(IP_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IP_PKTINFO)
+        }
+
+#endif // INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv6)
+        {
+#if defined(IPV6_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IPV6;
+            controlHdr->cmsg_type  = IPV6_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNEXPECTED_EVENT;
+            }
+            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
+            pktInfo->ipi6_addr    = aPktInfo.SrcAddress.ToIPv6();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
+#else  // !defined(IPV6_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IPV6_PKTINFO)
+        }
+
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        (void) controlData;
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Extract the source, and the destination and interface reported by IP_PKTINFO/IPV6_PKTINFO, of a received message.
+ */
+CHIP_ERROR GetReceivedPacketInfo(struct msghdr & msgHeader, IPPacketInfo & aPktInfo)
+{
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        aPktInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        aPktInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        aPktInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        aPktInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            aPktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            aPktInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            aPktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            aPktInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+#if INET_UDP_SOCKET_USE_GSO
+// Maximum number of datagrams, and of UDP payload bytes, in a single UDP_SEGMENT send.
+constexpr size_t kMaxGSOSegments = 64;
+constexpr size_t kMaxGSOLength   = UINT16_MAX - INET_CONFIG_MAX_IP_AND_UDP_HEADER_SIZE;
+
+bool HaveSameDestination(const IPPacketInfo & a, const IPPacketInfo & b)
+{
+    return a.DestAddress == b.DestAddress && a.DestPort == b.DestPort && a.Interface == b.Interface &&
+        a.SrcAddress == b.SrcAddress;
+}
+#endif // INET_UDP_SOCKET_USE_GSO
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -287,136 +484,229 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // For now the entire message must fit within a single buffer.
     VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    if (mSendBatching)
+    {
+        if (mPendingSendCount == kBatchSize)
+        {
+            // Errors are logged by SendPendingBatch.
+            (void) FlushPendingSends();
+        }
+        if (mPendingSendCount == 0)
+        {
+            // Send the queued messages once the current event loop iteration is done.
+            ReturnErrorOnFailure(GetSystemLayer().StartTimer(System::Clock::kZero, HandleFlushTimer, this));
+        }
+        mPendingSends[mPendingSendCount].mPktInfo = *aPktInfo;
+        mPendingSends[mPendingSendCount].mMsg     = std::move(msg);
+        mPendingSendCount++;
+        return CHIP_NO_ERROR;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
     struct iovec msgIOV;
     msgIOV.iov_base = msg->Start();
     msgIOV.iov_len  = msg->DataLength();
 
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
+    uint8_t controlData[kControlDataSize];
     memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
 
     struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
     msgHeader.msg_iov    = &msgIOV;
     msgHeader.msg_iovlen = 1;
 
-    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
     SockAddr peerSockAddr;
-    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
-    msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == IPAddressType::kIPv6)
+    ReturnErrorOnFailure(PrepareMessageHeader(mAddrType, mBoundIntfId, *aPktInfo, msgHeader, peerSockAddr, controlData));
+
+    // Send IP packet.
+    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    if (lenSent == -1)
     {
-        peerSockAddr.in6.sin6_family     = AF_INET6;
-        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
-        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
-        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
-        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
-        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+        return CHIP_ERROR_POSIX(errno);
     }
-#if INET_CONFIG_ENABLE_IPV4
-    else
+    if (lenSent != msg->DataLength())
     {
-        peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
-        msgHeader.msg_namelen      = sizeof(sockaddr_in);
+        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
-#endif // INET_CONFIG_ENABLE_IPV4
+    return CHIP_NO_ERROR;
+}
 
-    // If the endpoint has been bound to a particular interface,
-    // and the caller didn't supply a specific interface to send
-    // on, use the bound interface. This appears to be necessary
-    // for messages to multicast addresses, which under Linux
-    // don't seem to get sent out the correct interface, despite
-    // the socket being bound.
-    InterfaceId intf = aPktInfo->Interface;
-    if (!intf.IsPresent())
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
+CHIP_ERROR UDPEndPointImplSockets::SetSendBatching(bool aEnable)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (!aEnable)
     {
-        intf = mBoundIntfId;
+        err = FlushPendingSends();
     }
+    mSendBatching = aEnable;
+    return err;
+}
 
-    // If the packet should be sent over a specific interface, or with a specific source
-    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
-    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
-    // fail with an error.
-    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
+CHIP_ERROR UDPEndPointImplSockets::FlushPendingSends()
+{
+    VerifyOrReturnError(mPendingSendCount > 0, CHIP_NO_ERROR);
+    GetSystemLayer().CancelTimer(HandleFlushTimer, this);
+
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    for (size_t next = 0; next < mPendingSendCount;)
     {
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        CHIP_ERROR err = SendPendingBatch(next);
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = err;
+        }
+    }
 
-        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
-        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+    for (size_t i = 0; i < mPendingSendCount; i++)
+    {
+        mPendingSends[i].mMsg = nullptr;
+    }
+    mPendingSendCount = 0;
 
-#if INET_CONFIG_ENABLE_IPV4
+    return firstError;
+}
 
-        if (mAddrType == IPAddressType::kIPv4)
-        {
-#if defined(IP_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IP;
-            controlHdr->cmsg_type  = IP_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+/**
+ * Send, with a single sendmmsg() call, as many of the queued messages as possible, starting from `aNextPendingSend`.
+ * On return, `aNextPendingSend` is the index of the first message left to send.
+ */
+CHIP_ERROR UDPEndPointImplSockets::SendPendingBatch(size_t & aNextPendingSend)
+{
+    struct mmsghdr msgHeaders[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][kControlDataSize];
+    // Index of the first queued message, number of queued messages and number of bytes sent by each message header.
+    size_t firstPendingSend[kBatchSize];
+    size_t pendingSendCount[kBatchSize];
+    size_t expectedLength[kBatchSize];
+
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+    memset(controlData, 0, sizeof(controlData));
 
-            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+    CHIP_ERROR err           = CHIP_NO_ERROR;
+    unsigned int headerCount = 0;
+    for (size_t i = aNextPendingSend; i < mPendingSendCount;)
+    {
+        const PendingSend & first = mPendingSends[i];
+        size_t count              = 1;
+        size_t length             = first.mMsg->DataLength();
+
+#if INET_UDP_SOCKET_USE_GSO
+        // Consecutive messages to the same destination can be sent as the segments of a single UDP GSO send, as
+        // long as all of them but the last one have the same size.
+        const uint16_t segmentSize = first.mMsg->DataLength();
+        while (!mGSOUnavailable && segmentSize > 0 && i + count < mPendingSendCount && count < kMaxGSOSegments)
+        {
+            const PendingSend & next = mPendingSends[i + count];
+            if (mPendingSends[i + count - 1].mMsg->DataLength() != segmentSize || next.mMsg->DataLength() == 0 ||
+                next.mMsg->DataLength() > segmentSize || length + next.mMsg->DataLength() > kMaxGSOLength ||
+                !HaveSameDestination(first.mPktInfo, next.mPktInfo))
             {
-                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+                break;
             }
-
-            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
-#else  // !defined(IP_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IP_PKTINFO)
+            length += next.mMsg->DataLength();
+            count++;
         }
+#endif // INET_UDP_SOCKET_USE_GSO
 
-#endif // INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv6)
+        struct msghdr & msgHeader = msgHeaders[headerCount].msg_hdr;
+        CHIP_ERROR prepareErr     = PrepareMessageHeader(mAddrType, mBoundIntfId, first.mPktInfo, msgHeader,
+                                                     peerSockAddrs[headerCount], controlData[headerCount]);
+        if (prepareErr != CHIP_NO_ERROR)
         {
-#if defined(IPV6_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IPV6;
-            controlHdr->cmsg_type  = IPV6_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+            ChipLogError(Inet, "Dropping queued UDP message: %" CHIP_ERROR_FORMAT, prepareErr.Format());
+            if (headerCount == 0)
             {
-                return CHIP_ERROR_UNEXPECTED_EVENT;
+                // Nothing precedes the message: drop it, and move on.
+                aNextPendingSend = i + 1;
+                return prepareErr;
             }
-            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+            break;
+        }
 
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
-#else  // !defined(IPV6_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IPV6_PKTINFO)
+        for (size_t j = 0; j < count; j++)
+        {
+            msgIOVs[i + j - aNextPendingSend].iov_base = mPendingSends[i + j].mMsg->Start();
+            msgIOVs[i + j - aNextPendingSend].iov_len  = mPendingSends[i + j].mMsg->DataLength();
         }
+        msgHeader.msg_iov    = &msgIOVs[i - aNextPendingSend];
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(count);
 
-#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+#if INET_UDP_SOCKET_USE_GSO
+        if (count > 1)
+        {
+            // Append a UDP_SEGMENT control message after the IP_PKTINFO/IPV6_PKTINFO one, if any.
+            msgHeader.msg_control       = controlData[headerCount];
+            struct cmsghdr * controlHdr = reinterpret_cast<struct cmsghdr *>(controlData[headerCount] + msgHeader.msg_controllen);
+            controlHdr->cmsg_level      = SOL_UDP;
+            controlHdr->cmsg_type       = UDP_SEGMENT;
+            controlHdr->cmsg_len        = CMSG_LEN(sizeof(segmentSize));
+            memcpy(CMSG_DATA(controlHdr), &segmentSize, sizeof(segmentSize));
+            msgHeader.msg_controllen += CMSG_SPACE(sizeof(segmentSize));
+        }
+#endif // INET_UDP_SOCKET_USE_GSO
+
+        firstPendingSend[headerCount] = i;
+        pendingSendCount[headerCount] = count;
+        expectedLength[headerCount]   = length;
+        headerCount++;
+        i += count;
     }
 
-    // Send IP packet.
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
-    if (lenSent == -1)
+    const int sent = sendmmsg(mSocket, msgHeaders, headerCount, 0);
+    if (sent <= 0)
     {
-        return CHIP_ERROR_POSIX(errno);
+        err = (sent < 0) ? CHIP_ERROR_POSIX(errno) : CHIP_ERROR_INCORRECT_STATE;
+#if INET_UDP_SOCKET_USE_GSO
+        if (pendingSendCount[0] > 1)
+        {
+            // The kernel, or the outgoing interface, does not support UDP GSO: send the messages one by one.
+            ChipLogError(Inet, "UDP GSO send failed, disabling GSO: %" CHIP_ERROR_FORMAT, err.Format());
+            mGSOUnavailable = true;
+            return CHIP_NO_ERROR;
+        }
+#endif // INET_UDP_SOCKET_USE_GSO
+        ChipLogError(Inet, "Dropping queued UDP message: %" CHIP_ERROR_FORMAT, err.Format());
+        aNextPendingSend = firstPendingSend[0] + pendingSendCount[0];
+        return err;
     }
-    if (lenSent != msg->DataLength())
+
+    for (int i = 0; i < sent; i++)
     {
-        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+        if (msgHeaders[i].msg_len != expectedLength[i])
+        {
+            err = CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+            ChipLogError(Inet, "Queued UDP message truncated: %" CHIP_ERROR_FORMAT, err.Format());
+        }
     }
-    return CHIP_NO_ERROR;
+    aNextPendingSend = firstPendingSend[sent - 1] + pendingSendCount[sent - 1];
+    return err;
+}
+
+// static
+void UDPEndPointImplSockets::HandleFlushTimer(System::Layer * aLayer, void * aAppState)
+{
+    // Errors are logged by SendPendingBatch.
+    (void) static_cast<UDPEndPointImplSockets *>(aAppState)->FlushPendingSends();
 }
 
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
 void UDPEndPointImplSockets::CloseImpl()
 {
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    // Messages queued before the endpoint is closed are still sent.
+    (void) FlushPendingSends();
+    for (System::PacketBufferHandle & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
     if (mSocket != kInvalidSocketFd)
     {
         static_cast<System::LayerSockets *>(&GetSystemLayer())->StopWatchingSocket(&mWatch);
@@ -560,6 +850,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         return;
     }
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    ReceiveBatch();
+#else  // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -573,7 +866,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     {
         struct iovec msgIOV;
         SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
+        uint8_t controlData[kControlDataSize];
         struct msghdr msgHeader;
 
         msgIOV.iov_base = lBuffer->Start();
@@ -603,82 +896,111 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+            lStatus = GetReceivedPacketInfo(msgHeader, lPacketInfo);
+        }
+    }
+    else
+    {
+        lStatus = CHIP_ERROR_NO_MEMORY;
+    }
 
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
+    DeliverReceivedMessage(lStatus, std::move(lBuffer), lPacketInfo);
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+}
+
+void UDPEndPointImplSockets::DeliverReceivedMessage(CHIP_ERROR status, System::PacketBufferHandle && buffer,
+                                                    const IPPacketInfo & pktInfo)
+{
+    if (status == CHIP_NO_ERROR)
+    {
+        buffer.RightSize();
+        OnMessageReceived(this, std::move(buffer), &pktInfo);
+    }
+    else
+    {
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, status, nullptr);
         }
+    }
+}
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+void UDPEndPointImplSockets::ReceiveBatch()
+{
+    struct mmsghdr msgHeaders[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][kControlDataSize];
 
-        if (lStatus == CHIP_NO_ERROR)
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+    memset(peerSockAddrs, 0, sizeof(peerSockAddrs));
+
+    unsigned int bufferCount = 0;
+    for (; bufferCount < kBatchSize; bufferCount++)
+    {
+        System::PacketBufferHandle & buffer = mReceiveBuffers[bufferCount];
+        if (buffer.IsNull())
         {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
             {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
+                break;
             }
         }
+
+        msgIOVs[bufferCount].iov_base = buffer->Start();
+        msgIOVs[bufferCount].iov_len  = buffer->AvailableDataLength();
+
+        struct msghdr & msgHeader = msgHeaders[bufferCount].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[bufferCount];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[bufferCount]);
+        msgHeader.msg_iov         = &msgIOVs[bufferCount];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[bufferCount];
+        msgHeader.msg_controllen  = sizeof(controlData[bufferCount]);
     }
-    else
+
+    if (bufferCount == 0)
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        DeliverReceivedMessage(CHIP_ERROR_NO_MEMORY, System::PacketBufferHandle(), IPPacketInfo());
+        return;
     }
 
-    if (lStatus == CHIP_NO_ERROR)
+    const int received = recvmmsg(mSocket, msgHeaders, bufferCount, MSG_DONTWAIT, nullptr);
+    if (received < 0)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        DeliverReceivedMessage(CHIP_ERROR_POSIX(errno), System::PacketBufferHandle(), IPPacketInfo());
+        return;
     }
-    else
+
+    // A handler may close or free the endpoint: keep it alive until the loop is done, and stop delivering
+    // messages once it is no longer listening.
+    Retain();
+    for (int i = 0; i < received && mState == State::kListening && OnMessageReceived != nullptr; i++)
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        System::PacketBufferHandle buffer = std::move(mReceiveBuffers[i]);
+        IPPacketInfo packetInfo;
+        CHIP_ERROR status = CHIP_NO_ERROR;
+
+        packetInfo.Clear();
+        packetInfo.DestPort = mBoundPort;
+
+        if ((msgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC) != 0 || msgHeaders[i].msg_len > buffer->AvailableDataLength())
         {
-            OnReceiveError(this, lStatus, nullptr);
+            status = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
         }
+        else
+        {
+            buffer->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+            status = GetReceivedPacketInfo(msgHeaders[i].msg_hdr, packetInfo);
+        }
+
+        DeliverReceivedMessage(status, std::move(buffer), packetInfo);
     }
+    Release();
 }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
 
 #if IP_MULTICAST_LOOP || IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
@@ -41,6 +41,10 @@ public:
     InterfaceId GetBoundInterface() const override;
     uint16_t GetBoundPort() const override;
     void Free() override;
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    CHIP_ERROR SetSendBatching(bool aEnable) override;
+    CHIP_ERROR FlushPendingSends() override;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
 
 private:
     // UDPEndPoint overrides.
@@ -57,10 +61,32 @@ private:
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+    void DeliverReceivedMessage(CHIP_ERROR status, System::PacketBufferHandle && buffer, const IPPacketInfo & pktInfo);
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    static constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_BATCH_SIZE;
+
+    struct PendingSend
+    {
+        IPPacketInfo mPktInfo;
+        System::PacketBufferHandle mMsg;
+    };
+
+    void ReceiveBatch();
+    CHIP_ERROR SendPendingBatch(size_t & aNextPendingSend);
+    static void HandleFlushTimer(System::Layer * aLayer, void * aAppState);
+
+    // Receive buffers not filled by the previous recvmmsg() are kept for the next one.
+    System::PacketBufferHandle mReceiveBuffers[kBatchSize];
+    PendingSend mPendingSends[kBatchSize];
+    size_t mPendingSendCount = 0;
+    bool mSendBatching       = false;
+    bool mGSOUnavailable     = false;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     using MulticastGroupHandler = CHIP_ERROR (*)(InterfaceId, const IPAddress &);
@@ -353,6 +353,60 @@ static void TestInetEndPointInternal(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, SYSTEM_STATS_TEST_HIGH_WATER_MARK(System::Stats::kInetLayer_NumTCPEps, 1));
 }
 
+int sBatchedMessagesReceived = 0;
+
+void HandleBatchedMessageReceived(UDPEndPoint * aEndPoint, PacketBufferHandle && aBuffer, const IPPacketInfo * aPktInfo)
+{
+    sBatchedMessagesReceived++;
+}
+
+// Test that the messages queued while UDP send batching is enabled are all sent.
+static void TestInetUDPSendBatching(nlTestSuite * inSuite, void * inContext)
+{
+    // More messages than fit in the send queue of an endpoint, so that the queue is flushed while it is filled.
+    constexpr int kMessageCount = 40;
+    const char kPayload[]       = "batched";
+
+    UDPEndPoint * testUDPEP = nullptr;
+    IPAddress loopback;
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", loopback));
+
+    CHIP_ERROR err = gUDP.NewEndPoint(&testUDPEP);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = testUDPEP->Bind(IPAddressType::kIPv6, IPAddress::Any, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = testUDPEP->Listen(HandleBatchedMessageReceived, nullptr);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = testUDPEP->SetSendBatching(true);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        // Nothing to test: this endpoint always sends messages immediately.
+        testUDPEP->Free();
+        return;
+    }
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    sBatchedMessagesReceived = 0;
+    for (int i = 0; i < kMessageCount; i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::NewWithData(kPayload, sizeof(kPayload));
+        NL_TEST_ASSERT(inSuite, !buf.IsNull());
+        err = testUDPEP->SendTo(loopback, testUDPEP->GetBoundPort(), std::move(buf));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    err = testUDPEP->FlushPendingSends();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (int i = 0; i < 100 && sBatchedMessagesReceived < kMessageCount; i++)
+    {
+        ServiceEvents(10);
+    }
+    NL_TEST_ASSERT(inSuite, sBatchedMessagesReceived == kMessageCount);
+
+    testUDPEP->Free();
+}
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 static void TestInetEndPointLimit(nlTestSuite * inSuite, void * inContext)
@@ -444,6 +498,7 @@ static const nlTest sTests[] = { NL_TEST_DEF("InetEndPoint::PreTest", TestInetPr
                                  NL_TEST_DEF("InetEndPoint::TestInetError", TestInetError),
                                  NL_TEST_DEF("InetEndPoint::TestInetInterface", TestInetInterface),
                                  NL_TEST_DEF("InetEndPoint::TestInetEndPoint", TestInetEndPointInternal),
+                                 NL_TEST_DEF("InetEndPoint::TestInetUDPSendBatching", TestInetUDPSendBatching),
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
                                  NL_TEST_DEF("InetEndPoint::TestEndPointLimit", TestInetEndPointLimit),
 #endif
@@ -312,6 +312,21 @@
 #define CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES 5
 #endif // CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES
 
+/**
+ *  @def CHIP_CONFIG_CERTIFICATE_CACHE_SIZE
+ *
+ *  @brief
+ *    The number of decoded certificates, and of verified certificate signatures, remembered
+ *    process-wide by ChipCertificateCache so that certificate chains sharing their RCAC and
+ *    ICAC are not decoded and verified again. Each decoded certificate takes about 500 bytes.
+ *
+ *    Set to 0 to disable the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_CERTIFICATE_CACHE_SIZE
+#define CHIP_CONFIG_CERTIFICATE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE
+
 /**
  *  @def CHIP_ERROR_LOGGING
  *
@@ -823,6 +838,41 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_SUBSCRIPTION_KEEPALIVE_ALIGNMENT_WINDOW_SECONDS
+ *
+ * @brief Default keep-alive alignment window of the interaction model engine, in seconds (see
+ * InteractionModelEngine::SetKeepAliveAlignmentWindow).
+ *
+ * When the max interval of a subscription elapses and its empty keep-alive report is due, the keep-alive reports of the
+ * other subscriptions over the same session that are past their min interval and due within this window are sent in
+ * the same reporting run, so that a sleepy device wakes its radio once for all of them. 0 disables the alignment.
+ */
+#ifndef CHIP_IM_SUBSCRIPTION_KEEPALIVE_ALIGNMENT_WINDOW_SECONDS
+#define CHIP_IM_SUBSCRIPTION_KEEPALIVE_ALIGNMENT_WINDOW_SECONDS 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+ *
+ * @brief Persist the subscriptions of the server, and resume them when it restarts: the server establishes a CASE session
+ * to each subscriber and sends it a full report of its subscription, instead of waiting for every subscriber to notice the
+ * restart and re-subscribe.
+ */
+#ifndef CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+#define CHIP_CONFIG_PERSIST_SUBSCRIPTIONS 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_PATHS
+ *
+ * @brief The maximum number of attribute paths, of event paths and of data version filters of a persisted subscription (see
+ * CHIP_CONFIG_PERSIST_SUBSCRIPTIONS). Subscriptions with more of any of them are not persisted.
+ */
+#ifndef CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_PATHS
+#define CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_PATHS 8
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -878,6 +928,89 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_TIMED_HANDLER 8
 #endif
 
+/**
+ * @def CHIP_IM_INTERFACE_DISPATCH_TABLE_SIZE
+ *
+ * @brief Defines the number of buckets of the hash tables used to find the AttributeAccessInterface and the
+ *        CommandHandlerInterface registered for an endpoint and cluster. Each bucket costs a pointer; devices registering
+ *        few interfaces can use 1, which makes lookups walk every registered interface.
+ */
+#ifndef CHIP_IM_INTERFACE_DISPATCH_TABLE_SIZE
+#define CHIP_IM_INTERFACE_DISPATCH_TABLE_SIZE 32
+#endif
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_ATTRIBUTE_WRITE_WINDOW_MS
+ *
+ * @brief The write window of the attribute persistence provider of the server, in milliseconds (see
+ *        DeferredAttributePersistenceProvider). Non-volatile attribute values are written at most that long after they
+ *        change, which coalesces the writes of attributes changing many times in a row but loses the changes of the last
+ *        window on a power loss. 0 writes every change immediately.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_ATTRIBUTE_WRITE_WINDOW_MS
+#define CHIP_CONFIG_DEFERRED_ATTRIBUTE_WRITE_WINDOW_MS 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_ATTRIBUTE_MAX_PENDING_WRITES
+ *
+ * @brief The maximum number of attributes whose writes a DeferredAttributePersistenceProvider holds at a time. Writes of
+ *        other attributes are written through.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_ATTRIBUTE_MAX_PENDING_WRITES
+#define CHIP_CONFIG_DEFERRED_ATTRIBUTE_MAX_PENDING_WRITES 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_PERSISTED_ATTRIBUTE_INDEX_MAX_ENTRIES
+ *
+ * @brief The maximum number of attributes listed in the index of the persisted attribute values of an endpoint kept by
+ *        DefaultAttributePersistenceProvider. Loading the attributes of an endpoint only reads the values the index lists;
+ *        endpoints with more persisted values have no index, and every one of their non-volatile attributes is looked up.
+ *        The index takes 8 bytes per entry in storage, and as much heap once the endpoint is loaded or written to.
+ */
+#ifndef CHIP_CONFIG_PERSISTED_ATTRIBUTE_INDEX_MAX_ENTRIES
+#define CHIP_CONFIG_PERSISTED_ATTRIBUTE_INDEX_MAX_ENTRIES 64
+#endif
+
+/**
+ * @def CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+ *
+ * @brief Enables the perfect hash tables of the clusters and attributes of the fixed endpoints, built at compile time
+ *        from the generated endpoint configuration, used to find their metadata and storage without walking the
+ *        endpoints, clusters and attributes before them. The tables take about 25 bytes of flash per cluster and
+ *        10 bytes per attribute of the configuration; set to 0 to walk them instead.
+ */
+#ifndef CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX
+#define CHIP_CONFIG_FIXED_ATTRIBUTE_METADATA_INDEX 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_IN_PLACE_CLUSTER_OBJECT_ENCODING
+ *
+ * @brief Enables encoding the commands and structs of the generated cluster objects whose fields are all scalars
+ *        straight into the buffer of the TLV writer, after a single check of their maximum encoded size computed at
+ *        compile time, instead of checking the space left for each field. This adds a second encoder to each of these
+ *        objects; set to 0 to save the flash it takes.
+ */
+#ifndef CHIP_CONFIG_IN_PLACE_CLUSTER_OBJECT_ENCODING
+#define CHIP_CONFIG_IN_PLACE_CLUSTER_OBJECT_ENCODING 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE
+ *
+ * @brief The size of the buffer a read handler allocates, while a list attribute is chunked over several reports, to
+ *        encode the rest of the list once and copy it into the following chunks, instead of reading the attribute
+ *        again for each of them. Lists whose rest does not fit are read again once the buffer is used up. Set to 0 to
+ *        read the attribute again for each chunk.
+ *
+ *        Defaults to 0; the Linux and Darwin platforms, where memory is plentiful, set it to 2048.
+ */
+#ifndef CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE
+#define CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE 0
+#endif
+
 /**
  * @def CONFIG_BUILD_FOR_HOST_UNIT_TEST
  *
@@ -927,6 +1060,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES 64
 #endif
 
+/**
+ * @def CHIP_CONFIG_BULK_COMMISSIONING_MAX_PARALLELISM
+ *
+ * @brief Maximum number of DeviceCommissioner instances, and so of devices commissioned at the same time, a
+ *        BulkCommissioner can drive.
+ */
+#ifndef CHIP_CONFIG_BULK_COMMISSIONING_MAX_PARALLELISM
+#define CHIP_CONFIG_BULK_COMMISSIONING_MAX_PARALLELISM 16
+#endif
+
 /**
  * @def CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS
  *
@@ -996,6 +1139,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_ENDPOINTS_PER_FABRIC 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_ENDPOINT_INDEX_SIZE
+ *
+ * @brief Defines the number of (group, endpoint) mappings the group data provider keeps in RAM, across all fabrics,
+ *        to expand groupcast commands and writes without reading the group table from persistent storage.
+ *
+ * A fabric whose mappings do not fit is served from persistent storage instead.
+ */
+#ifndef CHIP_CONFIG_GROUP_ENDPOINT_INDEX_SIZE
+#define CHIP_CONFIG_GROUP_ENDPOINT_INDEX_SIZE 32
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS
  *
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/CHIPTLVTags.h>
 #include <lib/core/CHIPTLVTypes.h>
@@ -42,6 +43,7 @@
 
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <type_traits>
 
 /**
@@ -72,6 +74,7 @@ enum
 };
 
 class TLVBackingStore;
+class InPlaceWriter;
 
 /**
  * Provides a memory efficient parser for data encoded in CHIP TLV format.
@@ -968,6 +971,7 @@ protected:
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
+    void SkipElementsInBuffer(uint32_t & nestLevel, TLVType outerContainerType);
     CHIP_ERROR VerifyElement();
     Tag ReadTag(TLVTagControl tagControl, const uint8_t *& p) const;
     CHIP_ERROR EnsureData(CHIP_ERROR noDataErr);
@@ -1097,6 +1101,7 @@ public:
 class DLL_EXPORT TLVWriter
 {
     friend class TLVUpdater;
+    friend class InPlaceWriter;
 
 public:
     /**
@@ -2273,6 +2278,130 @@ protected:
     CHIP_ERROR WriteData(const uint8_t * p, uint32_t len);
 };
 
+/**
+ * Encodes context-tagged scalar elements (integers, booleans, floating point numbers and nulls) of the structure or
+ * list a TLVWriter is writing directly into the current buffer of the writer.
+ *
+ * The space needed by the elements is only checked when the InPlaceWriter is constructed, against an upper bound of
+ * their encoded size given by the caller: if the current buffer of the writer does not have that much room, or the
+ * writer is not in a structure or list, IsActive() returns false and the elements must be written with the TLVWriter.
+ * Elements are encoded exactly as the TLVWriter Put() methods encode them, and are added to the output of the writer
+ * by Finalize().  The writer must not be used between the construction of an InPlaceWriter and its Finalize().
+ */
+class InPlaceWriter
+{
+public:
+    /**
+     * The encoded size of the largest context-tagged scalar element: a control byte, a tag byte and an 8-byte value.
+     */
+    static constexpr uint32_t kMaxElementSize = 10;
+
+    InPlaceWriter(TLVWriter & writer, uint32_t maxLength) : mWriter(writer), mWritePoint(nullptr)
+    {
+        if (!writer.IsContainerOpen() && (writer.mContainerType == kTLVType_Structure || writer.mContainerType == kTLVType_List) &&
+            maxLength <= writer.mRemainingLen && maxLength <= writer.mMaxLen - writer.mLenWritten)
+        {
+            mWritePoint = writer.mWritePoint;
+        }
+    }
+
+    bool IsActive() const { return mWritePoint != nullptr; }
+
+    void PutUnsigned(uint8_t tagNum, uint64_t v)
+    {
+        if (v <= UINT8_MAX)
+        {
+            WriteHead(TLVElementType::UInt8, tagNum);
+            Encoding::Write8(mWritePoint, static_cast<uint8_t>(v));
+        }
+        else if (v <= UINT16_MAX)
+        {
+            WriteHead(TLVElementType::UInt16, tagNum);
+            Encoding::LittleEndian::Write16(mWritePoint, static_cast<uint16_t>(v));
+        }
+        else if (v <= UINT32_MAX)
+        {
+            WriteHead(TLVElementType::UInt32, tagNum);
+            Encoding::LittleEndian::Write32(mWritePoint, static_cast<uint32_t>(v));
+        }
+        else
+        {
+            WriteHead(TLVElementType::UInt64, tagNum);
+            Encoding::LittleEndian::Write64(mWritePoint, v);
+        }
+    }
+
+    void PutSigned(uint8_t tagNum, int64_t v)
+    {
+        if (v >= INT8_MIN && v <= INT8_MAX)
+        {
+            WriteHead(TLVElementType::Int8, tagNum);
+            Encoding::Write8(mWritePoint, static_cast<uint8_t>(v));
+        }
+        else if (v >= INT16_MIN && v <= INT16_MAX)
+        {
+            WriteHead(TLVElementType::Int16, tagNum);
+            Encoding::LittleEndian::Write16(mWritePoint, static_cast<uint16_t>(v));
+        }
+        else if (v >= INT32_MIN && v <= INT32_MAX)
+        {
+            WriteHead(TLVElementType::Int32, tagNum);
+            Encoding::LittleEndian::Write32(mWritePoint, static_cast<uint32_t>(v));
+        }
+        else
+        {
+            WriteHead(TLVElementType::Int64, tagNum);
+            Encoding::LittleEndian::Write64(mWritePoint, static_cast<uint64_t>(v));
+        }
+    }
+
+    void PutBoolean(uint8_t tagNum, bool v) { WriteHead(v ? TLVElementType::BooleanTrue : TLVElementType::BooleanFalse, tagNum); }
+
+    void PutFloat(uint8_t tagNum, float v)
+    {
+        uint32_t u32;
+        memcpy(&u32, &v, sizeof(u32));
+        WriteHead(TLVElementType::FloatingPointNumber32, tagNum);
+        Encoding::LittleEndian::Write32(mWritePoint, u32);
+    }
+
+    void PutDouble(uint8_t tagNum, double v)
+    {
+        uint64_t u64;
+        memcpy(&u64, &v, sizeof(u64));
+        WriteHead(TLVElementType::FloatingPointNumber64, tagNum);
+        Encoding::LittleEndian::Write64(mWritePoint, u64);
+    }
+
+    void PutNull(uint8_t tagNum) { WriteHead(TLVElementType::Null, tagNum); }
+
+    /**
+     * Add the elements encoded so far to the output of the writer, if the InPlaceWriter is active.
+     */
+    void Finalize()
+    {
+        if (!IsActive())
+        {
+            return;
+        }
+
+        uint32_t len = static_cast<uint32_t>(mWritePoint - mWriter.mWritePoint);
+        mWriter.mWritePoint = mWritePoint;
+        mWriter.mRemainingLen -= len;
+        mWriter.mLenWritten += len;
+    }
+
+private:
+    void WriteHead(TLVElementType elemType, uint8_t tagNum)
+    {
+        Encoding::Write8(mWritePoint, TLVTagControl::ContextSpecific | elemType);
+        Encoding::Write8(mWritePoint, tagNum);
+    }
+
+    TLVWriter & mWriter;
+    uint8_t * mWritePoint;
+};
+
 /*
  * A TLVWriter that is backed by a scoped memory buffer that is owned by the writer.
  */
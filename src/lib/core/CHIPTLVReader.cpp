@@ -646,12 +646,157 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
         if (err != CHIP_NO_ERROR)
             return err;
 
+        SkipElementsInBuffer(nestLevel, outerContainerType);
+
         err = ReadElement();
         if (err != CHIP_NO_ERROR)
             return err;
     }
 }
 
+namespace {
+
+// Whether ReadElement would accept an element of a container of type containerType, as far as its type and tag control
+// tell: when in doubt (e.g. a fully-qualified tag, which could be a context-specific one), false.
+bool IsValidElementHead(TLVType containerType, TLVElementType elemType, TLVTagControl tagControl, uint32_t implicitProfileId)
+{
+    if (!IsValidTLVType(elemType))
+        return false;
+
+    if (elemType == TLVElementType::EndOfContainer)
+        return containerType != kTLVType_NotSpecified && tagControl == TLVTagControl::Anonymous;
+
+    switch (tagControl)
+    {
+    case TLVTagControl::ImplicitProfile_2Bytes:
+    case TLVTagControl::ImplicitProfile_4Bytes:
+        if (implicitProfileId == kProfileIdNotSpecified)
+            return false;
+        break;
+    case TLVTagControl::FullyQualified_6Bytes:
+    case TLVTagControl::FullyQualified_8Bytes:
+        return false;
+    default:
+        break;
+    }
+
+    switch (containerType)
+    {
+    case kTLVType_Structure:
+        return tagControl != TLVTagControl::Anonymous;
+    case kTLVType_Array:
+        return tagControl == TLVTagControl::Anonymous;
+    case kTLVType_UnknownContainer:
+    case kTLVType_List:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+/**
+ * Skip, without decoding them, the elements in the current buffer that SkipToEndOfContainer would skip, stopping at the
+ * end of the container being skipped, or at the first element which is incomplete in the buffer, goes past the maximum
+ * length of the reader or may be invalid: that element is then read, and any error reported, by ReadElement.
+ *
+ * The last element skipped is left for ReadElement to read, so that the reader is in the same state as if it had read
+ * every element when reading the next one fails.
+ *
+ * Runs of scalar elements with the same control byte, such as the elements of an array of integers, are skipped
+ * without looking past their control bytes.
+ */
+void TLVReader::SkipElementsInBuffer(uint32_t & nestLevel, TLVType outerContainerType)
+{
+    const uint8_t * p           = mReadPoint;
+    const uint8_t * lastElement = nullptr;
+    uint32_t lastNestLevel      = nestLevel;
+    TLVType lastContainerType   = mContainerType;
+
+    // Elements past mMaxLen must be left to ReadElement too, which reports CHIP_ERROR_TLV_UNDERRUN for them.
+    const uint8_t * end = mBufEnd;
+    if (GetRemainingLength() < static_cast<size_t>(end - p))
+        end = p + GetRemainingLength();
+
+    while (p < end)
+    {
+        uint8_t controlByte      = *p;
+        TLVElementType elemType  = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+        TLVTagControl tagControl = static_cast<TLVTagControl>(controlByte & kTLVTagControlMask);
+
+        if (!IsValidElementHead(mContainerType, elemType, tagControl, ImplicitProfileId))
+            break;
+        if (elemType == TLVElementType::EndOfContainer && nestLevel == 0)
+            break;
+
+        lastElement       = p;
+        lastNestLevel     = nestLevel;
+        lastContainerType = mContainerType;
+
+        uint8_t valOrLenBytes = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+        size_t elemBytes      = 1u + sTagSizes[tagControl >> kTLVTagControlShift] + valOrLenBytes;
+        size_t bufRemaining   = static_cast<size_t>(end - p);
+        if (elemBytes > bufRemaining)
+            break;
+
+        if (TLVTypeHasLength(elemType))
+        {
+            const uint8_t * lenField = p + elemBytes - valOrLenBytes;
+            uint64_t dataLen;
+            switch (valOrLenBytes)
+            {
+            case 1:
+                dataLen = Read8(lenField);
+                break;
+            case 2:
+                dataLen = LittleEndian::Read16(lenField);
+                break;
+            case 4:
+                dataLen = LittleEndian::Read32(lenField);
+                break;
+            default:
+                dataLen = LittleEndian::Read64(lenField);
+                break;
+            }
+            if (dataLen > bufRemaining - elemBytes)
+                break;
+            p += elemBytes + static_cast<size_t>(dataLen);
+        }
+        else if (elemType == TLVElementType::EndOfContainer)
+        {
+            p += elemBytes;
+            nestLevel--;
+            mContainerType = (nestLevel == 0) ? outerContainerType : kTLVType_UnknownContainer;
+        }
+        else if (TLVTypeIsContainer(elemType))
+        {
+            p += elemBytes;
+            nestLevel++;
+            mContainerType = static_cast<TLVType>(elemType);
+        }
+        else
+        {
+            // The elements following with the same control byte have the same size, and are valid in this container too.
+            p += elemBytes;
+            while (static_cast<size_t>(end - p) >= elemBytes && *p == controlByte)
+            {
+                lastElement = p;
+                p += elemBytes;
+            }
+        }
+    }
+
+    if (lastElement == nullptr)
+        return;
+
+    p              = lastElement;
+    nestLevel      = lastNestLevel;
+    mContainerType = lastContainerType;
+    mLenRead += static_cast<uint32_t>(p - mReadPoint);
+    mReadPoint = p;
+}
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     CHIP_ERROR err;
@@ -2826,6 +2826,152 @@ void CheckCHIPTLVSkipCircular(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+// Presents a whole encoding as a single buffer, to readers which may be limited to a shorter length.
+class SingleBufferBackingStore : public TLVBackingStore
+{
+public:
+    SingleBufferBackingStore(const uint8_t * buf, uint32_t len) : mBuf(buf), mLen(len) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mBuf;
+        bufLen   = mLen;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = nullptr;
+        bufLen   = 0;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mBuf;
+    uint32_t mLen;
+};
+
+/**
+ *  Test skipping a large container, whose elements the reader skips in bulk.
+ */
+void CheckCHIPTLVSkipLargeContainer(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[2048];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType outerContainerType, listContainerType, structContainerType, arrayContainerType;
+    uint32_t corruptOffset = 0;
+    uint32_t labelOffset   = 0;
+    CHIP_ERROR err;
+
+    // { 1: [[ { 0: i, 1: "label", 2: [ 0, 1, ... 19 ] }, ... ]], 2: true }
+    writer.Init(buf);
+    err = writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.StartContainer(ContextTag(1), kTLVType_List, listContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        err = writer.StartContainer(AnonymousTag(), kTLVType_Structure, structContainerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.Put(ContextTag(0), i);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        if (i == 10)
+        {
+            labelOffset = writer.GetLengthWritten();
+        }
+        err = writer.PutString(ContextTag(1), "label");
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.StartContainer(ContextTag(2), kTLVType_Array, arrayContainerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        for (uint8_t j = 0; j < 20; j++)
+        {
+            if (i == 10 && j == 5)
+            {
+                corruptOffset = writer.GetLengthWritten();
+            }
+            err = writer.Put(AnonymousTag(), j);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        }
+        err = writer.EndContainer(arrayContainerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = writer.EndContainer(structContainerType);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    err = writer.EndContainer(listContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutBoolean(ContextTag(2), true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    uint32_t encodingLen = writer.GetLengthWritten();
+
+    // Skipping the list positions the reader on the element following it.
+    reader.Init(buf, encodingLen);
+    err = reader.Next(kTLVType_Structure, AnonymousTag());
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next(kTLVType_List, ContextTag(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Skip();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next(kTLVType_Boolean, ContextTag(2));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_END_OF_TLV);
+    err = reader.ExitContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == encodingLen);
+
+    // Skipping the list reports a string truncated by the maximum length of the reader, even if its buffer goes on.
+    SingleBufferBackingStore backingStore(buf, encodingLen);
+    err = reader.Init(backingStore, labelOffset + 3);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next(kTLVType_Structure, AnonymousTag());
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next(kTLVType_List, ContextTag(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Skip();
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_TLV_UNDERRUN);
+
+    // Skipping the list reports an invalid element within it.
+    buf[corruptOffset] = 0x1F;
+    reader.Init(buf, encodingLen);
+    err = reader.Next(kTLVType_Structure, AnonymousTag());
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next(kTLVType_List, ContextTag(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Skip();
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_TLV_ELEMENT);
+    NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == corruptOffset);
+
+    // Skipping the list reports a truncated encoding.
+    reader.Init(buf, corruptOffset - 1);
+    err = reader.Next(kTLVType_Structure, AnonymousTag());
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next(kTLVType_List, ContextTag(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Skip();
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_TLV_UNDERRUN);
+}
+
 /**
  *  Test Buffer Overflow
  */
@@ -4465,6 +4611,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV String Span",                CheckCHIPTLVPutStringSpan),
     NL_TEST_DEF("CHIP TLV Printf, Circular TLV buf",   CheckCHIPTLVPutStringFCircular),
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
+    NL_TEST_DEF("CHIP TLV Skip large container",       CheckCHIPTLVSkipLargeContainer),
     NL_TEST_DEF("CHIP TLV ByteSpan",                   CheckCHIPTLVByteSpan),
     NL_TEST_DEF("CHIP TLV Scoped Buffer",              CheckCHIPTLVScopedBuffer),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
@@ -101,6 +101,8 @@ public:
         // for the cluster and attribute ids.
         return Format("g/a/%x/%" PRIx32 "/%" PRIx32, endpointId, clusterId, attributeId);
     }
+    // The clusters and attributes of an endpoint that have an AttributeValue.
+    const char * AttributeValueIndex(EndpointId endpointId) { return Format("g/ai/%x", endpointId); }
 
     // TODO: Should store fabric-specific parts of the binding list under keys
     // starting with "f/%x/".
@@ -116,6 +118,9 @@ public:
     // Event number counter.
     const char * IMEventNumber() { return SetConst("g/im/ec"); }
 
+    // Subscription resumption
+    const char * SubscriptionResumption(size_t index) { return Format("g/su/%x", static_cast<unsigned>(index)); }
+
 protected:
     // The ENFORCE_FORMAT args are "off by one" because this is a class method,
     // with an implicit "this" as first arg.
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A perfect hash table of a fixed set of 64-bit keys, which can be built
+ *      at compile time.
+ *
+ *      The table maps each key to its index in the array of keys it was
+ *      built from, with two hash computations and no collision: keys are
+ *      split in buckets by a first hash, and each bucket is given the seed
+ *      of a second hash placing all of its keys in free slots ("hash and
+ *      displace").  A table takes 3 to 6 bytes per key.
+ *
+ *      Looking up a key which is not in the set also returns an index:
+ *      callers must check that the key at that index is the one looked up.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace PerfectHash {
+
+constexpr size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+template <size_t kKeyCount>
+class Table
+{
+public:
+    // About 4 keys per bucket, and a load factor of at most 0.8 once all keys are placed.
+    static constexpr size_t kBucketCount = RoundUpToPowerOfTwo(kKeyCount / 4 + 1);
+    static constexpr size_t kSlotCount   = RoundUpToPowerOfTwo(kKeyCount + kKeyCount / 4 + 1);
+
+    static constexpr uint16_t kNoIndex = UINT16_MAX;
+    static_assert(kKeyCount < kNoIndex, "Key indexes must fit in a uint16_t");
+
+    constexpr Table() : mSeeds(), mSlots(), mValid(false) {}
+
+    /**
+     * Build the table of the kKeyCount distinct keys of the array keys.
+     *
+     * Check IsValid() on the result (e.g. with a static_assert): the build fails if keys has duplicates.
+     */
+    static constexpr Table Build(const uint64_t * keys)
+    {
+        Table table;
+
+        // Sort the key indexes by bucket.
+        uint16_t bucketStart[kBucketCount + 1] = {};
+        uint16_t bucketFill[kBucketCount]      = {};
+        uint16_t order[kKeyCount + 1]          = {};
+        for (size_t i = 0; i < kKeyCount; i++)
+        {
+            bucketStart[Bucket(keys[i]) + 1]++;
+        }
+        size_t largestBucket = 0;
+        for (size_t bucket = 0; bucket < kBucketCount; bucket++)
+        {
+            largestBucket = (bucketStart[bucket + 1] > largestBucket) ? bucketStart[bucket + 1] : largestBucket;
+            bucketStart[bucket + 1] = static_cast<uint16_t>(bucketStart[bucket + 1] + bucketStart[bucket]);
+        }
+        for (size_t i = 0; i < kKeyCount; i++)
+        {
+            size_t bucket                                     = Bucket(keys[i]);
+            order[bucketStart[bucket] + bucketFill[bucket]++] = static_cast<uint16_t>(i);
+        }
+
+        for (size_t slot = 0; slot < kSlotCount; slot++)
+        {
+            table.mSlots[slot] = kNoIndex;
+        }
+
+        // Place the largest buckets first, while most slots are free.
+        for (size_t size = largestBucket; size > 0; size--)
+        {
+            for (size_t bucket = 0; bucket < kBucketCount; bucket++)
+            {
+                if (static_cast<size_t>(bucketStart[bucket + 1] - bucketStart[bucket]) != size)
+                {
+                    continue;
+                }
+
+                uint16_t seed = 1;
+                while (!table.Place(keys, &order[bucketStart[bucket]], size, seed))
+                {
+                    if (seed == UINT16_MAX)
+                    {
+                        return table;
+                    }
+                    seed++;
+                }
+                table.mSeeds[bucket] = seed;
+            }
+        }
+
+        table.mValid = true;
+        return table;
+    }
+
+    constexpr bool IsValid() const { return mValid; }
+
+    /**
+     * @return the index of key in the array the table was built from if key is in it, and otherwise either the index
+     *         of another key or kNoIndex.
+     */
+    constexpr uint16_t Find(uint64_t key) const { return mSlots[Slot(key, mSeeds[Bucket(key)])]; }
+
+private:
+    static constexpr uint32_t Hash(uint64_t key, uint16_t seed)
+    {
+        // Multiply-xorshift of the key offset by the seed: a single multiplication, since lookups are on hot paths.
+        uint64_t hash = (key + (static_cast<uint64_t>(seed) + 1) * 0x9E3779B97F4A7C15ull) * 0xBF58476D1CE4E5B9ull;
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+    static constexpr size_t Bucket(uint64_t key) { return Hash(key, 0) & (kBucketCount - 1); }
+
+    static constexpr size_t Slot(uint64_t key, uint16_t seed) { return Hash(key, seed) & (kSlotCount - 1); }
+
+    // Place the count keys of a bucket in the slots chosen by seed, if they are all free.
+    constexpr bool Place(const uint64_t * keys, const uint16_t * indexes, size_t count, uint16_t seed)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t slot = Slot(keys[indexes[i]], seed);
+            if (mSlots[slot] != kNoIndex)
+            {
+                for (size_t j = 0; j < i; j++)
+                {
+                    mSlots[Slot(keys[indexes[j]], seed)] = kNoIndex;
+                }
+                return false;
+            }
+            mSlots[slot] = indexes[i];
+        }
+        return true;
+    }
+
+    uint16_t mSeeds[kBucketCount];
+    uint16_t mSlots[kSlotCount];
+    bool mValid;
+};
+
+} // namespace PerfectHash
+} // namespace chip
@@ -0,0 +1,100 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/PerfectHash.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kKeyCount = 1000;
+
+struct Keys
+{
+    uint64_t mKeys[kKeyCount];
+};
+
+// Keys shaped as those of the attribute metadata tables: a small prefix (e.g. a cluster index) and an identifier.
+constexpr Keys MakeKeys()
+{
+    Keys keys = {};
+    for (size_t i = 0; i < kKeyCount; i++)
+    {
+        keys.mKeys[i] = (static_cast<uint64_t>(i / 25) << 32) | ((i % 5 == 0) ? 0xFFF8 + i % 25 : i % 25);
+    }
+    return keys;
+}
+
+constexpr Keys sKeys = MakeKeys();
+
+constexpr auto sTable = PerfectHash::Table<kKeyCount>::Build(sKeys.mKeys);
+static_assert(sTable.IsValid(), "Distinct keys must have a perfect hash table");
+
+constexpr uint64_t sDuplicateKeys[] = { 1, 2, 3, 2 };
+static_assert(!PerfectHash::Table<ArraySize(sDuplicateKeys)>::Build(sDuplicateKeys).IsValid(),
+              "Duplicate keys must not have a perfect hash table");
+
+void TestFindKeys(nlTestSuite * inSuite, void * inContext)
+{
+    for (size_t i = 0; i < kKeyCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, sTable.Find(sKeys.mKeys[i]) == i);
+    }
+
+    // The index of a key is known at compile time.
+    static_assert(sTable.Find(sKeys.mKeys[42]) == 42, "");
+}
+
+void TestFindMissingKeys(nlTestSuite * inSuite, void * inContext)
+{
+    for (size_t i = 0; i < kKeyCount; i++)
+    {
+        uint64_t missingKey = sKeys.mKeys[i] ^ 0x8000;
+        uint16_t index      = sTable.Find(missingKey);
+        NL_TEST_ASSERT(inSuite, index == sTable.kNoIndex || (index < kKeyCount && sKeys.mKeys[index] != missingKey));
+    }
+}
+
+void TestEmptyTable(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr auto table = PerfectHash::Table<0>::Build(nullptr);
+    static_assert(table.IsValid(), "An empty set of keys must have a perfect hash table");
+
+    NL_TEST_ASSERT(inSuite, table.Find(0) == table.kNoIndex);
+    NL_TEST_ASSERT(inSuite, table.Find(UINT64_MAX) == table.kNoIndex);
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("Test finding keys", TestFindKeys),
+                          NL_TEST_DEF("Test finding missing keys", TestFindMissingKeys),
+                          NL_TEST_DEF("Test empty table", TestEmptyTable), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestPerfectHash()
+{
+    nlTestSuite theSuite = { "PerfectHash tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestPerfectHash)
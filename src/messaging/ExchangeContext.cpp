@@ -45,6 +45,8 @@
 #include <platform/LockTracker.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemMetrics.h>
+#include <trace/trace.h>
 
 #if CONFIG_DEVICE_LAYER
 #include <platform/CHIPDeviceLayer.h>
@@ -133,6 +135,7 @@ void ExchangeContext::UpdateSEDIntervalMode(bool activeMode)
 CHIP_ERROR ExchangeContext::SendMessage(Protocols::Id protocolId, uint8_t msgType, PacketBufferHandle && msgBuf,
                                         const SendFlags & sendFlags)
 {
+    MATTER_TRACE_EVENT_SCOPE("SendMessage", "ExchangeContext");
     // This is the first point all outgoing messages funnel through.  Ensure
     // that our message sends are all synchronized correctly.
     assertChipStackLockedByCurrentThread();
@@ -346,6 +349,7 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     ChipLogDetail(ExchangeManager, "ec++ id: " ChipLogFormatExchange, ChipLogValueExchange(this));
 #endif
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumContexts);
+    SYSTEM_METRICS_GAUGE_INCREMENT(chip::System::Metrics::kGauge_ExchangesInUse);
 }
 
 ExchangeContext::~ExchangeContext()
@@ -373,6 +377,7 @@ ExchangeContext::~ExchangeContext()
     ChipLogDetail(ExchangeManager, "ec-- id: " ChipLogFormatExchange, ChipLogValueExchange(this));
 #endif
     SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumContexts);
+    SYSTEM_METRICS_GAUGE_DECREMENT(chip::System::Metrics::kGauge_ExchangesInUse);
 }
 
 bool ExchangeContext::MatchExchange(const SessionHandle & session, const PacketHeader & packetHeader,
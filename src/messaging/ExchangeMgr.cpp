@@ -42,6 +42,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <trace/trace.h>
 
 using namespace chip::Encoding;
 using namespace chip::Inet;
@@ -189,6 +190,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
                                         const SessionHandle & session, DuplicateMessage isDuplicate,
                                         System::PacketBufferHandle && msgBuf)
 {
+    MATTER_TRACE_EVENT_SCOPE("OnMessageReceived", "ExchangeManager");
     UnsolicitedMessageHandlerSlot * matchingUMH = nullptr;
 
 #if CHIP_PROGRESS_LOGGING
@@ -365,6 +367,7 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
                                                 const SessionHandle & session, MessageFlags msgFlags,
                                                 System::PacketBufferHandle && msgBuf)
 {
+    MATTER_TRACE_EVENT_SCOPE("SendStandaloneAckIfNeeded", "ExchangeManager");
     // If we need to send a StandaloneAck, create a EphemeralExchange for the purpose to send the StandaloneAck
     if (!payloadHeader.NeedsAck())
         return;
@@ -36,6 +36,8 @@
 #include <messaging/Flags.h>
 #include <messaging/ReliableMessageContext.h>
 #include <platform/ConnectivityManager.h>
+#include <system/SystemMetrics.h>
+#include <trace/trace.h>
 
 using namespace chip::System::Clock::Literals;
 
@@ -96,6 +98,7 @@ void ReliableMessageMgr::TicklessDebugDumpRetransTable(const char * log) {}
 
 void ReliableMessageMgr::ExecuteActions()
 {
+    MATTER_TRACE_EVENT_SCOPE("ExecuteActions", "ReliableMessageMgr");
     System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
 
 #if defined(RMP_TICKLESS_DEBUG)
@@ -156,6 +159,7 @@ void ReliableMessageMgr::ExecuteActions()
         }
 
         entry->sendCount++;
+        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_MessageRetransmissions);
         ChipLogDetail(ExchangeManager,
                       "Retransmitting MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
                       " Send Cnt %d",
@@ -298,6 +302,7 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 {
+    MATTER_TRACE_EVENT_SCOPE("SendFromRetransTable", "ReliableMessageMgr");
     if (!entry->ec->HasSessionHandle())
     {
         // Using same error message for all errors to reduce code size.
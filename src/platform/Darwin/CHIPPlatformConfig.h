@@ -41,6 +41,16 @@
 #define CHIP_CONFIG_SLOW_CRYPTO 0
 #endif // CHIP_CONFIG_SLOW_CRYPTO
 
+// Controllers validate the same RCAC/ICAC over and over, and memory is plentiful
+#ifndef CHIP_CONFIG_CERTIFICATE_CACHE_SIZE
+#define CHIP_CONFIG_CERTIFICATE_CACHE_SIZE 16
+#endif // CHIP_CONFIG_CERTIFICATE_CACHE_SIZE
+
+// Chunked list attributes are read once per fill of a 2 kB buffer instead of once per chunk
+#ifndef CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE
+#define CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE 2048
+#endif // CHIP_CONFIG_REPORT_SCRATCH_BUFFER_SIZE
+
 // ==================== General Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS
@@ -24,30 +24,116 @@
 
 #include <platform/DeviceSafeQueue.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+DeviceSafeQueue::DeviceSafeQueue() :
+    mEnqueuePos(0), mHighWaterMark(0), mOverflowCount(0), mDequeuePos(0), mMaxLatencyUs(0), mTotalLatencyUs(0)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::Push(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    Slot * slot;
+
+    for (;;)
+    {
+        slot                = &mSlots[pos & (kCapacity - 1)];
+        const size_t seq    = slot->mSequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            // The slot is free for this position; try to claim it.
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The consumer has not yet released the slot from the previous lap: the queue is full.
+            mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            // Another producer claimed this position first.
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->mEvent      = event;
+    slot->mEnqueuedAt = System::SystemClock().GetMonotonicMicroseconds64();
+    slot->mSequence.store(pos + 1, std::memory_order_release);
+
+    // The consumer may already have moved past this event, in which case it does not count towards the depth.
+    const size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+    const size_t depth      = (pos + 1 > dequeuePos) ? std::min(pos + 1 - dequeuePos, kCapacity) : 0;
+    size_t highWater        = mHighWaterMark.load(std::memory_order_relaxed);
+    while (depth > highWater && !mHighWaterMark.compare_exchange_weak(highWater, depth, std::memory_order_relaxed))
+    {
+    }
+
+    return true;
 }
 
-const ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    const size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+    Slot & slot      = mSlots[pos & (kCapacity - 1)];
+
+    if (slot.mSequence.load(std::memory_order_acquire) != pos + 1)
+    {
+        return false;
+    }
+
+    event = slot.mEvent;
+
+    const uint64_t latency = (System::SystemClock().GetMonotonicMicroseconds64() - slot.mEnqueuedAt).count();
+    mTotalLatencyUs.fetch_add(latency, std::memory_order_relaxed);
+    if (latency > mMaxLatencyUs.load(std::memory_order_relaxed))
+    {
+        // Only the consumer writes the maximum, so a plain store is enough.
+        mMaxLatencyUs.store(latency, std::memory_order_relaxed);
+    }
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    // Hand the slot back to producers for the next lap.
+    slot.mSequence.store(pos + kCapacity, std::memory_order_release);
+    mDequeuePos.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+size_t DeviceSafeQueue::Size() const
+{
+    const size_t dequeuePos = mDequeuePos.load(std::memory_order_acquire);
+    const size_t enqueuePos = mEnqueuePos.load(std::memory_order_acquire);
+
+    // Positions claimed but not yet written are counted as queued.
+    return (enqueuePos > dequeuePos) ? (enqueuePos - dequeuePos) : 0;
+}
+
+void DeviceSafeQueue::GetStats(Stats & stats) const
+{
+    const uint64_t dequeued = mDequeuePos.load(std::memory_order_acquire);
+    const uint64_t enqueued = mEnqueuePos.load(std::memory_order_acquire);
 
-    return event;
+    stats.mDepth         = Size();
+    stats.mHighWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+    stats.mEnqueuedCount = enqueued;
+    stats.mOverflowCount = mOverflowCount.load(std::memory_order_relaxed);
+    stats.mDequeuedCount = dequeued;
+    stats.mMaxLatency    = System::Clock::Microseconds64(mMaxLatencyUs.load(std::memory_order_relaxed));
+    stats.mTotalLatency  = System::Clock::Microseconds64(mTotalLatencyUs.load(std::memory_order_relaxed));
 }
 
 } // namespace Internal
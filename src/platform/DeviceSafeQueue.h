@@ -24,12 +24,14 @@
 
 #pragma once
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <lib/core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/CHIPDeviceEvent.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -39,24 +41,75 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe, bounded message queue used by the CHIP event loop to hold incoming
+ *      messages. Each message is sequentially dequeued, decoded, and then an action is performed.
+ *
+ *      Any number of threads may Push() concurrently without taking a lock; PopFront() must only be called
+ *      from a single consumer thread (the CHIP event loop).  Every slot carries a sequence number that tells
+ *      producers and the consumer whether it is free, being written, or ready to be read.
  *
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    static constexpr size_t kCapacity = CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE;
+
+    struct Stats
+    {
+        size_t mDepth;                               ///< Number of events currently queued.
+        size_t mHighWaterMark;                       ///< Largest depth observed by Push().
+        uint64_t mEnqueuedCount;                     ///< Events accepted by Push().
+        uint64_t mOverflowCount;                     ///< Events rejected because the queue was full.
+        uint64_t mDequeuedCount;                     ///< Events returned by PopFront().
+        System::Clock::Microseconds64 mMaxLatency;   ///< Longest time an event spent in the queue.
+        System::Clock::Microseconds64 mTotalLatency; ///< Sum of the time dequeued events spent in the queue.
+    };
+
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    const ChipDeviceEvent PopFront();
+    /**
+     * Append an event to the queue.  Safe to call from any thread.
+     *
+     * @retval true  if the event was queued.
+     * @retval false if the queue was full.
+     */
+    bool Push(const ChipDeviceEvent & event);
+
+    /**
+     * Remove the oldest event from the queue.  Must only be called from the consumer thread.
+     *
+     * @retval true  if an event was dequeued into @p event.
+     * @retval false if the queue is empty, or the oldest slot has been claimed by a producer that has
+     *               not finished writing it yet.
+     */
+    bool PopFront(ChipDeviceEvent & event);
+
+    bool Empty() const { return Size() == 0; }
+    size_t Size() const;
+
+    void GetStats(Stats & stats) const;
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0,
+                  "CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE must be a power of two");
+
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        System::Clock::Microseconds64 mEnqueuedAt;
+        ChipDeviceEvent mEvent;
+    };
+
+    Slot mSlots[kCapacity];
+
+    // Producers and the consumer touch different positions; keep them on separate cache lines.
+    alignas(64) std::atomic<size_t> mEnqueuePos;
+    std::atomic<size_t> mHighWaterMark;
+    std::atomic<uint64_t> mOverflowCount;
+    alignas(64) std::atomic<size_t> mDequeuePos;
+    std::atomic<uint64_t> mMaxLatencyUs;
+    std::atomic<uint64_t> mTotalLatencyUs;
 
     DeviceSafeQueue(const DeviceSafeQueue &) = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
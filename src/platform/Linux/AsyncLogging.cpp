@@ -0,0 +1,796 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <platform/internal/CHIPDeviceLayerInternal.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/AsyncLogging.h>
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <pthread.h>
+#include <stdarg.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+
+namespace chip {
+namespace DeviceLayer {
+void OnLogOutput();
+} // namespace DeviceLayer
+
+namespace Logging {
+namespace Platform {
+namespace {
+
+constexpr size_t kQueueSize = CHIP_DEVICE_LAYER_ASYNC_LOG_QUEUE_SIZE;
+constexpr size_t kArgsSize  = CHIP_DEVICE_LAYER_ASYNC_LOG_ARGS_SIZE;
+static_assert(kQueueSize > 0 && (kQueueSize & (kQueueSize - 1)) == 0, "The async log queue size must be a power of two");
+
+// How long an error waits for the messages queued up to it to be written, when errors wait.
+constexpr auto kErrorWriteTimeout = std::chrono::milliseconds(10);
+// How long the writer sleeps on an empty queue, should it miss a wake-up.
+constexpr auto kIdleTimeout = std::chrono::milliseconds(20);
+// How many times, 1 ms apart, the writer looks for messages still being queued once stopped.
+constexpr int kStopRetries = 100;
+
+enum class ArgType : uint8_t
+{
+    kNone, // "%%"
+    kInt,
+    kLong,
+    kLongLong,
+    kIntMax,
+    kSize,
+    kPtrDiff,
+    kDouble,
+    kLongDouble,
+    kString,
+    kPointer,
+    kUnsupported,
+};
+
+// A conversion specification of a format string, e.g. "%-08.*llx".
+struct ConversionSpec
+{
+    size_t mLength; // From the '%' to the conversion character, included.
+    ArgType mType;
+    uint8_t mStarCount;  // Width and precision given as arguments, which precede the value.
+    bool mStarPrecision; // Whether the precision is the last of them.
+    int mPrecision;      // Literal precision, or -1.
+};
+
+/**
+ * Parse the conversion specification starting at the '%' format points to.
+ */
+void ParseConversionSpec(const char * format, ConversionSpec & spec)
+{
+    const char * p = format + 1;
+
+    spec.mStarCount     = 0;
+    spec.mStarPrecision = false;
+    spec.mPrecision     = -1;
+
+    while (*p != '\0' && strchr("-+ #0'", *p) != nullptr)
+    {
+        p++;
+    }
+    if (*p == '*')
+    {
+        spec.mStarCount++;
+        p++;
+    }
+    while (*p >= '0' && *p <= '9')
+    {
+        p++;
+    }
+    if (*p == '.')
+    {
+        p++;
+        spec.mPrecision = 0;
+        if (*p == '*')
+        {
+            spec.mStarCount++;
+            spec.mStarPrecision = true;
+            p++;
+        }
+        while (*p >= '0' && *p <= '9')
+        {
+            spec.mPrecision = spec.mPrecision * 10 + (*p - '0');
+            p++;
+        }
+    }
+
+    ArgType integerType = ArgType::kInt;
+    bool longDouble     = false;
+    bool wide           = false;
+    switch (*p)
+    {
+    case 'h':
+        p += (p[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        wide        = (p[1] != 'l');
+        integerType = wide ? ArgType::kLong : ArgType::kLongLong;
+        p += wide ? 1 : 2;
+        break;
+    case 'j':
+        integerType = ArgType::kIntMax;
+        p++;
+        break;
+    case 'z':
+        integerType = ArgType::kSize;
+        p++;
+        break;
+    case 't':
+        integerType = ArgType::kPtrDiff;
+        p++;
+        break;
+    case 'L':
+        longDouble = true;
+        p++;
+        break;
+    default:
+        break;
+    }
+
+    switch (*p)
+    {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        spec.mType = integerType;
+        break;
+    case 'c':
+        spec.mType = wide ? ArgType::kUnsupported : ArgType::kInt;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        spec.mType = longDouble ? ArgType::kLongDouble : ArgType::kDouble;
+        break;
+    case 's':
+        spec.mType = wide ? ArgType::kUnsupported : ArgType::kString;
+        break;
+    case 'p':
+        spec.mType = ArgType::kPointer;
+        break;
+    case '%':
+        spec.mType = (p == format + 1) ? ArgType::kNone : ArgType::kUnsupported;
+        break;
+    default:
+        spec.mType = ArgType::kUnsupported;
+        break;
+    }
+
+    if (*p != '\0')
+    {
+        p++;
+    }
+    spec.mLength = static_cast<size_t>(p - format);
+}
+
+// Arguments are queued as 8-byte values, but for strings: a 2-byte length, the characters and a null, padded to 8 bytes.
+union ArgValue
+{
+    uint64_t mInteger;
+    double mDouble;
+};
+
+constexpr size_t kArgAlignment = sizeof(ArgValue);
+
+size_t StringArgSize(size_t length)
+{
+    return (sizeof(uint16_t) + length + 1 + kArgAlignment - 1) & ~(kArgAlignment - 1);
+}
+
+struct Record
+{
+    struct timeval mTime;
+    long long mThreadId;
+    const char * mFormat; // nullptr when mMessage holds the message, formatted when it was logged.
+    char * mMessage;      // mArgs, or a heap buffer, freed by the writer, for a formatted message that does not fit in it.
+    char mModule[kMaxModuleNameLen + 1];
+    alignas(kArgAlignment) uint8_t mArgs[kArgsSize];
+};
+
+// Bounded multi-producer queue with a single consumer, the writer: a slot is free for position p when its sequence
+// is p, and holds the message queued at p once it is p + 1.
+struct Slot
+{
+    std::atomic<size_t> mSequence;
+    Record mRecord;
+};
+
+Slot sQueue[kQueueSize];
+std::atomic<size_t> sEnqueuePosition{ 0 };
+std::atomic<size_t> sWrittenPosition{ 0 };
+std::atomic<uint32_t> sDropCount{ 0 };
+size_t sDequeuePosition     = 0; // Writer only.
+uint32_t sReportedDropCount = 0; // Writer only.
+long long sProcessId        = 0;
+
+// Writer only: grown to the longest message formatted so far.
+char * sMessageBuffer     = nullptr;
+size_t sMessageBufferSize = 0;
+
+pthread_t sWriterThread;
+bool sWriterStarted = false;
+std::atomic<bool> sStopping{ false };
+std::atomic<bool> sWriterIdle{ false };
+std::mutex sWakeUpMutex;
+std::condition_variable sWakeUp;
+
+bool sWaitForErrors = false;
+std::mutex sWrittenMutex;
+std::condition_variable sWritten;
+
+thread_local long long tThreadId = 0;
+
+class ArgWriter
+{
+public:
+    ArgWriter(Record & record) : mRecord(record) {}
+
+    bool PutValue(ArgValue value)
+    {
+        VerifyOrReturnValue(mSize + sizeof(value) <= kArgsSize, false);
+        memcpy(&mRecord.mArgs[mSize], &value, sizeof(value));
+        mSize += sizeof(value);
+        return true;
+    }
+
+    bool PutInteger(uint64_t integer)
+    {
+        ArgValue value;
+        value.mInteger = integer;
+        return PutValue(value);
+    }
+
+    bool PutString(const char * string, int precision)
+    {
+        if (string == nullptr)
+        {
+            string    = "(null)";
+            precision = -1;
+        }
+        size_t length = (precision >= 0) ? strnlen(string, static_cast<size_t>(precision)) : strlen(string);
+        VerifyOrReturnValue(length <= UINT16_MAX && mSize + StringArgSize(length) <= kArgsSize, false);
+
+        uint16_t storedLength = static_cast<uint16_t>(length);
+        memcpy(&mRecord.mArgs[mSize], &storedLength, sizeof(storedLength));
+        memcpy(&mRecord.mArgs[mSize + sizeof(storedLength)], string, length);
+        mRecord.mArgs[mSize + sizeof(storedLength) + length] = '\0';
+        mSize += StringArgSize(length);
+        return true;
+    }
+
+private:
+    Record & mRecord;
+    size_t mSize = 0;
+};
+
+/**
+ * Queue the arguments of the message in the record.
+ *
+ * @return false if an argument is not supported, or if they do not fit.
+ */
+bool QueueArgs(const char * format, va_list args, Record & record)
+{
+    ArgWriter writer(record);
+
+    for (const char * p = strchr(format, '%'); p != nullptr; p = strchr(p, '%'))
+    {
+        ConversionSpec spec;
+        ParseConversionSpec(p, spec);
+        p += spec.mLength;
+        VerifyOrReturnValue(spec.mType != ArgType::kUnsupported, false);
+
+        int precision = spec.mPrecision;
+        for (uint8_t i = 0; i < spec.mStarCount; i++)
+        {
+            int star = va_arg(args, int);
+            VerifyOrReturnValue(writer.PutInteger(static_cast<uint64_t>(star)), false);
+            if (spec.mStarPrecision && i + 1 == spec.mStarCount)
+            {
+                precision = star;
+            }
+        }
+
+        bool fits = true;
+        ArgValue value;
+        switch (spec.mType)
+        {
+        case ArgType::kNone:
+            break;
+        case ArgType::kInt:
+            fits = writer.PutInteger(static_cast<uint64_t>(va_arg(args, int)));
+            break;
+        case ArgType::kLong:
+            fits = writer.PutInteger(static_cast<uint64_t>(va_arg(args, long)));
+            break;
+        case ArgType::kLongLong:
+            fits = writer.PutInteger(static_cast<uint64_t>(va_arg(args, long long)));
+            break;
+        case ArgType::kIntMax:
+            fits = writer.PutInteger(static_cast<uint64_t>(va_arg(args, intmax_t)));
+            break;
+        case ArgType::kSize:
+            fits = writer.PutInteger(static_cast<uint64_t>(va_arg(args, size_t)));
+            break;
+        case ArgType::kPtrDiff:
+            fits = writer.PutInteger(static_cast<uint64_t>(va_arg(args, ptrdiff_t)));
+            break;
+        case ArgType::kDouble:
+            value.mDouble = va_arg(args, double);
+            fits          = writer.PutValue(value);
+            break;
+        case ArgType::kLongDouble:
+            value.mDouble = static_cast<double>(va_arg(args, long double));
+            fits          = writer.PutValue(value);
+            break;
+        case ArgType::kString:
+            fits = writer.PutString(va_arg(args, const char *), precision);
+            break;
+        case ArgType::kPointer:
+            fits = writer.PutInteger(reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+            break;
+        case ArgType::kUnsupported:
+            return false;
+        }
+        VerifyOrReturnValue(fits, false);
+    }
+
+    return true;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+// The conversion specifications come from the format strings of the messages, which were checked when they were logged.
+template <typename T>
+int FormatArg(char * buffer, size_t size, const char * spec, const int (&stars)[2], uint8_t starCount, T value)
+{
+    switch (starCount)
+    {
+    case 0:
+        return snprintf(buffer, size, spec, value);
+    case 1:
+        return snprintf(buffer, size, spec, stars[0], value);
+    default:
+        return snprintf(buffer, size, spec, stars[0], stars[1], value);
+    }
+}
+#pragma GCC diagnostic pop
+
+class ArgReader
+{
+public:
+    ArgReader(const Record & record) : mRecord(record) {}
+
+    ArgValue GetValue()
+    {
+        ArgValue value;
+        memcpy(&value, &mRecord.mArgs[mOffset], sizeof(value));
+        mOffset += sizeof(value);
+        return value;
+    }
+
+    const char * GetString()
+    {
+        uint16_t length;
+        memcpy(&length, &mRecord.mArgs[mOffset], sizeof(length));
+        const char * string = reinterpret_cast<const char *>(&mRecord.mArgs[mOffset + sizeof(length)]);
+        mOffset += StringArgSize(length);
+        return string;
+    }
+
+private:
+    const Record & mRecord;
+    size_t mOffset = 0;
+};
+
+/**
+ * Format the message of the record, as vsnprintf would have when it was logged.
+ *
+ * @return the length of the whole message, which was truncated if it is not less than size.
+ */
+size_t FormatMessage(const Record & record, char * buffer, size_t size)
+{
+    ArgReader reader(record);
+    size_t length = 0;
+    buffer[0]     = '\0';
+
+    for (const char * p = record.mFormat; *p != '\0';)
+    {
+        // Once the buffer is full, the rest of the message is only measured.
+        char * out   = (length < size) ? &buffer[length] : nullptr;
+        size_t space = (length < size) ? size - length : 0;
+
+        int written;
+        if (*p != '%')
+        {
+            const char * end = strchr(p, '%');
+            size_t runLength = (end != nullptr) ? static_cast<size_t>(end - p) : strlen(p);
+            written          = snprintf(out, space, "%.*s", static_cast<int>(runLength), p);
+            p += runLength;
+        }
+        else
+        {
+            ConversionSpec spec;
+            ParseConversionSpec(p, spec);
+
+            char specString[32];
+            VerifyOrReturnValue(spec.mLength < sizeof(specString), length);
+            memcpy(specString, p, spec.mLength);
+            specString[spec.mLength] = '\0';
+            p += spec.mLength;
+
+            int stars[2] = { 0, 0 };
+            for (uint8_t i = 0; i < spec.mStarCount; i++)
+            {
+                stars[i] = static_cast<int>(reader.GetValue().mInteger);
+            }
+
+            switch (spec.mType)
+            {
+            case ArgType::kNone:
+                written = snprintf(out, space, "%%");
+                break;
+            case ArgType::kInt:
+                written = FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<int>(reader.GetValue().mInteger));
+                break;
+            case ArgType::kLong:
+                written = FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<long>(reader.GetValue().mInteger));
+                break;
+            case ArgType::kLongLong:
+                written =
+                    FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<long long>(reader.GetValue().mInteger));
+                break;
+            case ArgType::kIntMax:
+                written =
+                    FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<intmax_t>(reader.GetValue().mInteger));
+                break;
+            case ArgType::kSize:
+                written =
+                    FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<size_t>(reader.GetValue().mInteger));
+                break;
+            case ArgType::kPtrDiff:
+                written =
+                    FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<ptrdiff_t>(reader.GetValue().mInteger));
+                break;
+            case ArgType::kDouble:
+                written = FormatArg(out, space, specString, stars, spec.mStarCount, reader.GetValue().mDouble);
+                break;
+            case ArgType::kLongDouble:
+                written =
+                    FormatArg(out, space, specString, stars, spec.mStarCount, static_cast<long double>(reader.GetValue().mDouble));
+                break;
+            case ArgType::kString:
+                written = FormatArg(out, space, specString, stars, spec.mStarCount, reader.GetString());
+                break;
+            case ArgType::kPointer:
+                written = FormatArg(out, space, specString, stars, spec.mStarCount,
+                                    reinterpret_cast<void *>(static_cast<uintptr_t>(reader.GetValue().mInteger)));
+                break;
+            case ArgType::kUnsupported:
+            default:
+                // Messages with such arguments are formatted when logged.
+                return length;
+            }
+        }
+
+        VerifyOrReturnValue(written >= 0, length);
+        length += static_cast<size_t>(written);
+    }
+
+    return length;
+}
+
+/**
+ * Format the message of a record in the message buffer, growing it if needed.
+ */
+const char * FormatQueuedMessage(const Record & record)
+{
+    size_t length = FormatMessage(record, sMessageBuffer, sMessageBufferSize);
+    if (length >= sMessageBufferSize)
+    {
+        // Left truncated if the buffer cannot grow.
+        char * buffer = static_cast<char *>(realloc(sMessageBuffer, length + 1));
+        if (buffer != nullptr)
+        {
+            sMessageBuffer     = buffer;
+            sMessageBufferSize = length + 1;
+            FormatMessage(record, sMessageBuffer, sMessageBufferSize);
+        }
+    }
+    return sMessageBuffer;
+}
+
+void ENFORCE_FORMAT(4, 5) WriteLine(const struct timeval & time, long long threadId, const char * module, const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    printf("[%" PRIu64 ".%06" PRIu64 "][%lld:%lld] CHIP:%s: ", static_cast<uint64_t>(time.tv_sec),
+           static_cast<uint64_t>(time.tv_usec), sProcessId, threadId, module);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+
+    DeviceLayer::OnLogOutput();
+}
+
+/**
+ * Write the messages queued so far.
+ *
+ * @return whether there were any.
+ */
+bool WriteQueuedMessages()
+{
+    bool wrote = false;
+
+    for (;;)
+    {
+        Slot & slot = sQueue[sDequeuePosition & (kQueueSize - 1)];
+        if (slot.mSequence.load(std::memory_order_acquire) != sDequeuePosition + 1)
+        {
+            break;
+        }
+
+        Record & record      = slot.mRecord;
+        const char * message = (record.mFormat != nullptr) ? FormatQueuedMessage(record) : record.mMessage;
+        WriteLine(record.mTime, record.mThreadId, record.mModule, "%s", message);
+        if (record.mMessage != reinterpret_cast<char *>(record.mArgs))
+        {
+            free(record.mMessage);
+        }
+
+        slot.mSequence.store(sDequeuePosition + kQueueSize, std::memory_order_release);
+        sDequeuePosition++;
+        wrote = true;
+    }
+
+    uint32_t dropCount = sDropCount.load(std::memory_order_relaxed);
+    if (dropCount != sReportedDropCount)
+    {
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        WriteLine(now, static_cast<long long>(syscall(SYS_gettid)), "SPT", "Async logging dropped %" PRIu32 " messages",
+                  dropCount - sReportedDropCount);
+        sReportedDropCount = dropCount;
+        wrote              = true;
+    }
+
+    if (wrote)
+    {
+        fflush(stdout);
+        sWrittenPosition.store(sDequeuePosition, std::memory_order_release);
+        if (sWaitForErrors)
+        {
+            // Locked so that an error checking the written position before waiting does not miss the notification.
+            std::lock_guard<std::mutex> lock(sWrittenMutex);
+            sWritten.notify_all();
+        }
+    }
+    return wrote;
+}
+
+void WakeUpWriter()
+{
+    std::lock_guard<std::mutex> lock(sWakeUpMutex);
+    sWakeUp.notify_one();
+}
+
+void * RunWriter(void *)
+{
+    while (!sStopping.load())
+    {
+        if (WriteQueuedMessages())
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sWakeUpMutex);
+        sWriterIdle.store(true);
+        Slot & next = sQueue[sDequeuePosition & (kQueueSize - 1)];
+        if (next.mSequence.load() != sDequeuePosition + 1 && !sStopping.load())
+        {
+            sWakeUp.wait_for(lock, kIdleTimeout);
+        }
+        sWriterIdle.store(false);
+    }
+
+    // Messages may still be being queued by the threads that were logging when the redirect was removed.
+    for (int retry = 0; retry < kStopRetries && sDequeuePosition != sEnqueuePosition.load(); retry++)
+    {
+        if (!WriteQueuedMessages())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    // Report the messages dropped since the last ones written.
+    WriteQueuedMessages();
+
+    return nullptr;
+}
+
+void WaitUntilWritten(size_t position)
+{
+    WakeUpWriter();
+
+    std::unique_lock<std::mutex> lock(sWrittenMutex);
+    sWritten.wait_for(lock, kErrorWriteTimeout, [position] {
+        return static_cast<ptrdiff_t>(sWrittenPosition.load(std::memory_order_acquire) - position) >= 0;
+    });
+}
+
+void ENFORCE_FORMAT(3, 0) QueueMessage(const char * module, uint8_t category, const char * msg, va_list v)
+{
+    size_t position = sEnqueuePosition.load(std::memory_order_relaxed);
+    Slot * slot;
+    for (;;)
+    {
+        slot              = &sQueue[position & (kQueueSize - 1)];
+        size_t sequence   = slot->mSequence.load(std::memory_order_acquire);
+        ptrdiff_t pending = static_cast<ptrdiff_t>(sequence - position);
+        if (pending == 0)
+        {
+            if (sEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (pending < 0)
+        {
+            // The writer has not written the message queued one lap ago yet: the queue is full.
+            sDropCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            position = sEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (tThreadId == 0)
+    {
+        tThreadId = static_cast<long long>(syscall(SYS_gettid));
+    }
+
+    Record & record = slot->mRecord;
+    gettimeofday(&record.mTime, nullptr);
+    record.mThreadId = tThreadId;
+    chip::Platform::CopyString(record.mModule, module);
+    record.mMessage = reinterpret_cast<char *>(record.mArgs);
+
+    va_list args;
+    va_copy(args, v);
+    bool queued = QueueArgs(msg, args, record);
+    va_end(args);
+    if (queued)
+    {
+        record.mFormat = msg;
+    }
+    else
+    {
+        record.mFormat = nullptr;
+        va_copy(args, v);
+        int length = vsnprintf(record.mMessage, sizeof(record.mArgs), msg, args);
+        va_end(args);
+
+        // Left truncated if it cannot be allocated.  Not chip::Platform::MemoryAlloc, which messages can be logged before.
+        if (length >= static_cast<int>(sizeof(record.mArgs)))
+        {
+            char * message = static_cast<char *>(malloc(static_cast<size_t>(length) + 1));
+            if (message != nullptr)
+            {
+                vsnprintf(message, static_cast<size_t>(length) + 1, msg, v);
+                record.mMessage = message;
+            }
+        }
+    }
+
+    slot->mSequence.store(position + 1, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (category == kLogCategory_Error && sWaitForErrors)
+    {
+        WaitUntilWritten(position + 1);
+    }
+    else if (sWriterIdle.load())
+    {
+        WakeUpWriter();
+    }
+}
+
+} // namespace
+
+CHIP_ERROR StartAsyncLogging(bool waitForErrors)
+{
+    // The writer only writes to stdout, and would bypass the pw_log backend.
+    VerifyOrReturnError(!CHIP_USE_PW_LOGGING, CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(!sWriterStarted, CHIP_ERROR_INCORRECT_STATE);
+
+    sMessageBuffer = static_cast<char *>(malloc(CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE));
+    VerifyOrReturnError(sMessageBuffer != nullptr, CHIP_ERROR_NO_MEMORY);
+    sMessageBufferSize = CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE;
+
+    for (size_t i = 0; i < kQueueSize; i++)
+    {
+        sQueue[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+    sEnqueuePosition.store(0);
+    sWrittenPosition.store(0);
+    sDequeuePosition = 0;
+    sStopping.store(false);
+    sWaitForErrors = waitForErrors;
+    sProcessId     = static_cast<long long>(syscall(SYS_getpid));
+
+    int err = pthread_create(&sWriterThread, nullptr, RunWriter, nullptr);
+    if (err != 0)
+    {
+        free(sMessageBuffer);
+        sMessageBuffer = nullptr;
+        return CHIP_ERROR_POSIX(err);
+    }
+    sWriterStarted = true;
+
+    SetLogRedirectCallback(QueueMessage);
+    return CHIP_NO_ERROR;
+}
+
+void StopAsyncLogging()
+{
+    VerifyOrReturn(sWriterStarted);
+
+    SetLogRedirectCallback(nullptr);
+    sStopping.store(true);
+    WakeUpWriter();
+    pthread_join(sWriterThread, nullptr);
+    sWriterStarted = false;
+
+    free(sMessageBuffer);
+    sMessageBuffer     = nullptr;
+    sMessageBufferSize = 0;
+}
+
+uint32_t GetAsyncLoggingDropCount()
+{
+    return sDropCount.load(std::memory_order_relaxed);
+}
+
+} // namespace Platform
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Asynchronous logging for Linux.
+ *
+ *      Once started, logging a message only records its format string
+ *      pointer and raw arguments (copying the strings) in a lock-free
+ *      queue: a background thread formats and writes them to stdout, in
+ *      the format and with the timestamps of synchronous logging.  Messages
+ *      logged while the queue is full are dropped, and counted.
+ *
+ *      Optionally, errors wait, for at most 10 ms, until they and the
+ *      messages queued before them are written, so that the message
+ *      preceding a crash is not lost.
+ *
+ *      The writer only writes to stdout: asynchronous logging is not
+ *      supported with pw_log (CHIP_USE_PW_LOGGING).
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace Logging {
+namespace Platform {
+
+/**
+ * Start logging asynchronously.  This installs a log redirect callback
+ * (see chip::Logging::SetLogRedirectCallback), replacing any other one.
+ *
+ * @param[in] waitForErrors  Whether logging an error waits until it is written.
+ *
+ * @retval #CHIP_ERROR_NOT_IMPLEMENTED if logging goes through pw_log.
+ * @retval #CHIP_ERROR_INCORRECT_STATE if already started.
+ */
+CHIP_ERROR StartAsyncLogging(bool waitForErrors = false);
+
+/**
+ * Write the queued messages, and log synchronously from then on.
+ */
+void StopAsyncLogging();
+
+/**
+ * @return the number of messages dropped because the queue was full.
+ */
+uint32_t GetAsyncLoggingDropCount();
+
+} // namespace Platform
+} // namespace Logging
+} // namespace chip
@@ -68,6 +68,28 @@
 #define CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG 1
 #endif // CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG
 
+/**
+ * @def CHIP_DEVICE_LAYER_ASYNC_LOG_QUEUE_SIZE
+ *
+ * The number of log messages the asynchronous logging queue holds (see
+ * AsyncLogging.h); messages logged while it is full are dropped.  Must be
+ * a power of two.
+ */
+#ifndef CHIP_DEVICE_LAYER_ASYNC_LOG_QUEUE_SIZE
+#define CHIP_DEVICE_LAYER_ASYNC_LOG_QUEUE_SIZE 1024
+#endif // CHIP_DEVICE_LAYER_ASYNC_LOG_QUEUE_SIZE
+
+/**
+ * @def CHIP_DEVICE_LAYER_ASYNC_LOG_ARGS_SIZE
+ *
+ * The size, in bytes, of the raw arguments (including copied strings) each
+ * queued log message holds.  Messages whose arguments do not fit are
+ * formatted when logged instead, in a heap buffer if longer than that.
+ */
+#ifndef CHIP_DEVICE_LAYER_ASYNC_LOG_ARGS_SIZE
+#define CHIP_DEVICE_LAYER_ASYNC_LOG_ARGS_SIZE 256
+#endif // CHIP_DEVICE_LAYER_ASYNC_LOG_ARGS_SIZE
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
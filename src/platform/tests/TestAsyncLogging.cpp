@@ -0,0 +1,262 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the asynchronous logging
+ *      of the Linux platform.
+ *
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/AsyncLogging.h>
+
+#include <nlunit-test.h>
+
+#include <cinttypes>
+#include <climits>
+#include <fstream>
+#include <sstream>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip::Logging::Platform;
+
+namespace {
+
+constexpr char kLinePrefix[] = " CHIP:DL: ";
+
+// Not a constant, so that the compiler does not warn about it being formatted.
+const char * gNullString = nullptr;
+
+std::vector<std::string> sExpectedMessages;
+
+void ENFORCE_FORMAT(1, 2) ExpectMessage(const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    std::string message(static_cast<size_t>(vsnprintf(nullptr, 0, format, argsCopy)) + 1, '\0');
+    va_end(argsCopy);
+    vsnprintf(&message[0], message.size(), format, args);
+    va_end(args);
+
+    message.pop_back();
+    sExpectedMessages.push_back(message);
+}
+
+// Logs a message, and expects it to be written as vsnprintf formats it.
+#define LogAndExpect(...)                                                                                                          \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        ChipLogProgress(DeviceLayer, __VA_ARGS__);                                                                                 \
+        ExpectMessage(__VA_ARGS__);                                                                                                \
+    } while (0)
+
+// Redirects stdout to fd, returning a descriptor to restore it with.
+int RedirectStdout(int fd)
+{
+    fflush(stdout);
+    int savedFd = dup(STDOUT_FILENO);
+    dup2(fd, STDOUT_FILENO);
+    return savedFd;
+}
+
+void RestoreStdout(int savedFd)
+{
+    fflush(stdout);
+    dup2(savedFd, STDOUT_FILENO);
+    close(savedFd);
+}
+
+// Returns the messages of the lines logged by the DeviceLayer module in output, and sums the drop counts reported in it.
+std::vector<std::string> ParseMessages(const std::string & output, uint32_t & reportedDropCount)
+{
+    std::vector<std::string> messages;
+    std::istringstream lines(output);
+    std::string line;
+
+    reportedDropCount = 0;
+    while (std::getline(lines, line))
+    {
+        size_t prefix = line.find(kLinePrefix);
+        if (prefix != std::string::npos)
+        {
+            messages.push_back(line.substr(prefix + strlen(kLinePrefix)));
+        }
+
+        size_t report = line.find("Async logging dropped ");
+        uint32_t count;
+        if (report != std::string::npos && sscanf(line.c_str() + report, "Async logging dropped %" SCNu32, &count) == 1)
+        {
+            reportedDropCount += count;
+        }
+    }
+    return messages;
+}
+
+void TestFormat(nlTestSuite * inSuite, void * inContext)
+{
+    char path[] = "/tmp/TestAsyncLoggingXXXXXX";
+    int fd      = mkstemp(path);
+    NL_TEST_ASSERT(inSuite, fd >= 0);
+    VerifyOrReturn(fd >= 0);
+
+    const char unterminated[] = { 'a', 'b', 'c' };
+    const std::string longString(1000, 'l');
+    int value = 0;
+
+    sExpectedMessages.clear();
+    uint32_t dropCount = GetAsyncLoggingDropCount();
+    int savedFd        = RedirectStdout(fd);
+    CHIP_ERROR err     = StartAsyncLogging();
+
+    LogAndExpect("plain text");
+    LogAndExpect("%d %i %u %o %x %X", -42, 42, 42u, 8u, 255u, 255u);
+    LogAndExpect("%-8d|%08.3f|%+d|% d|%#x|%#o|%'d", 5, 3.14159, 7, 7, 255u, 8u, 1234567);
+    LogAndExpect("%*d|%-*d|%.*f|%*.*s|", 6, 42, 6, 42, 2, 2.71828, 8, 3, "abcdef");
+    LogAndExpect("%.*s|%.3s|%s|%.0s|", 3, unterminated, "abcdef", "full", "none");
+    LogAndExpect("%s|%10s", gNullString, gNullString);
+    LogAndExpect("%p|%p", static_cast<void *>(&value), static_cast<void *>(nullptr));
+    LogAndExpect("100%% %d%%", 5);
+    LogAndExpect("%hhd %hu %ld %lld %jd %zu %td %lu %llx", static_cast<signed char>(-5), static_cast<unsigned short>(65535), -1L,
+                 LLONG_MIN, INTMAX_MIN, SIZE_MAX, static_cast<ptrdiff_t>(-3), ULONG_MAX, ULLONG_MAX);
+    LogAndExpect("%e %g %a %.0f %10.4Lf", 1e-5, 123456789.0, 1.0, 2.5, 3.25L);
+    LogAndExpect("%c%c", 'o', 'k');
+    LogAndExpect("%ls", L"wide");
+    // Longer than the arguments of a queue slot.
+    LogAndExpect("long string: %s", longString.c_str());
+    LogAndExpect("%d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d", 1,
+                 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+                 33, 34, 35, 36);
+    // Longer, once formatted, than CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE.
+    LogAndExpect("%0600d|%s", 1, "end");
+
+    // Stopping writes the messages queued until then.
+    StopAsyncLogging();
+    RestoreStdout(savedFd);
+    close(fd);
+
+    std::ifstream file(path);
+    std::stringstream output;
+    output << file.rdbuf();
+    unlink(path);
+
+    uint32_t reportedDropCount;
+    std::vector<std::string> messages = ParseMessages(output.str(), reportedDropCount);
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, GetAsyncLoggingDropCount() == dropCount);
+    NL_TEST_ASSERT(inSuite, reportedDropCount == 0);
+    NL_TEST_ASSERT(inSuite, messages.size() == sExpectedMessages.size());
+    for (size_t i = 0; i < messages.size() && i < sExpectedMessages.size(); i++)
+    {
+        NL_TEST_ASSERT(inSuite, messages[i] == sExpectedMessages[i]);
+        if (messages[i] != sExpectedMessages[i])
+        {
+            printf("Expected \"%s\", got \"%s\"\n", sExpectedMessages[i].c_str(), messages[i].c_str());
+        }
+    }
+}
+
+void TestDropWhenFull(nlTestSuite * inSuite, void * inContext)
+{
+    // The writer blocks writing to the pipe once it is full, until the queue is full too.
+    constexpr uint32_t kMessageCount = CHIP_DEVICE_LAYER_ASYNC_LOG_QUEUE_SIZE * 8 + 4096;
+
+    int pipeFds[2];
+    NL_TEST_ASSERT(inSuite, pipe(pipeFds) == 0);
+
+    uint32_t dropCount = GetAsyncLoggingDropCount();
+    int savedFd        = RedirectStdout(pipeFds[1]);
+    close(pipeFds[1]);
+    CHIP_ERROR err = StartAsyncLogging();
+
+    for (uint32_t i = 0; i < kMessageCount; i++)
+    {
+        ChipLogProgress(DeviceLayer, "message %" PRIu32, i);
+    }
+    uint32_t droppedWhileLogging = GetAsyncLoggingDropCount() - dropCount;
+
+    std::string output;
+    std::thread reader([&output, &pipeFds]() {
+        char buffer[4096];
+        ssize_t length;
+        while ((length = read(pipeFds[0], buffer, sizeof(buffer))) > 0)
+        {
+            output.append(buffer, static_cast<size_t>(length));
+        }
+    });
+
+    StopAsyncLogging();
+    // Closes the write end of the pipe, which ends the reader.
+    RestoreStdout(savedFd);
+    reader.join();
+    close(pipeFds[0]);
+
+    uint32_t reportedDropCount;
+    std::vector<std::string> messages = ParseMessages(output, reportedDropCount);
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, droppedWhileLogging > 0);
+    NL_TEST_ASSERT(inSuite, GetAsyncLoggingDropCount() - dropCount == droppedWhileLogging);
+    NL_TEST_ASSERT(inSuite, reportedDropCount == droppedWhileLogging);
+    NL_TEST_ASSERT(inSuite, messages.size() + droppedWhileLogging == kMessageCount);
+
+    // The messages written are in the order they were logged.
+    uint32_t previous = 0;
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        uint32_t index;
+        NL_TEST_ASSERT(inSuite, sscanf(messages[i].c_str(), "message %" SCNu32, &index) == 1);
+        NL_TEST_ASSERT(inSuite, i == 0 || index > previous);
+        previous = index;
+    }
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestFormat", TestFormat),
+    NL_TEST_DEF("TestDropWhenFull", TestDropWhenFull),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestAsyncLogging()
+{
+    nlTestSuite theSuite = { "AsyncLogging", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAsyncLogging)
@@ -36,6 +36,11 @@
 
 #include <platform/CHIPDeviceLayer.h>
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <atomic>
+#include <pthread.h>
+#endif
+
 using namespace chip;
 using namespace chip::Logging;
 using namespace chip::Inet;
@@ -173,6 +178,71 @@ static void TestPlatformMgr_AddEventHandler(nlTestSuite * inSuite, void * inCont
 #endif
 }
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+static constexpr int kScheduleWorkThreads        = 4;
+static constexpr int kScheduleWorkItemsPerThread = 200;
+static std::atomic<int> sScheduledWorkRan;
+
+static void CountScheduledWork(intptr_t)
+{
+    sScheduledWorkRan.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void * ScheduleWorkFromThread(void *)
+{
+    for (int i = 0; i < kScheduleWorkItemsPerThread; i++)
+    {
+        PlatformMgr().ScheduleWork(CountScheduledWork);
+    }
+    return nullptr;
+}
+
+static void TestPlatformMgr_ScheduleWorkFromManyThreads(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr int kExpected = kScheduleWorkThreads * kScheduleWorkItemsPerThread;
+    static_assert(kExpected <= CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE, "Test must not be able to overflow the event queue");
+
+    sScheduledWorkRan = 0;
+
+    CHIP_ERROR err = PlatformMgr().InitChipStack();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    PlatformManagerImpl::EventQueueStats before;
+    PlatformMgrImpl().GetEventQueueStats(before);
+
+    err = PlatformMgr().StartEventLoopTask();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    pthread_t threads[kScheduleWorkThreads];
+    for (pthread_t & thread : threads)
+    {
+        NL_TEST_ASSERT(inSuite, pthread_create(&thread, nullptr, ScheduleWorkFromThread, nullptr) == 0);
+    }
+    for (pthread_t & thread : threads)
+    {
+        pthread_join(thread, nullptr);
+    }
+
+    for (int i = 0; i < 500 && sScheduledWorkRan.load() < kExpected; i++)
+    {
+        chip::test_utils::SleepMillis(10);
+    }
+    NL_TEST_ASSERT(inSuite, sScheduledWorkRan.load() == kExpected);
+
+    err = PlatformMgr().StopEventLoopTask();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    PlatformManagerImpl::EventQueueStats after;
+    PlatformMgrImpl().GetEventQueueStats(after);
+    NL_TEST_ASSERT(inSuite, after.mOverflowCount == before.mOverflowCount);
+    NL_TEST_ASSERT(inSuite, after.mDequeuedCount - before.mDequeuedCount >= static_cast<uint64_t>(kExpected));
+    NL_TEST_ASSERT(inSuite, after.mHighWaterMark >= 1);
+    NL_TEST_ASSERT(inSuite, after.mDepth == 0);
+
+    PlatformMgr().Shutdown();
+}
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 class MockSystemLayer : public System::LayerImpl
 {
 public:
@@ -219,6 +289,9 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test PlatformMgr::TryLockChipStack", TestPlatformMgr_TryLockChipStack),
     NL_TEST_DEF("Test PlatformMgr::AddEventHandler", TestPlatformMgr_AddEventHandler),
     NL_TEST_DEF("Test mock System::Layer", TestPlatformMgr_MockSystemLayer),
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    NL_TEST_DEF("Test PlatformMgr::ScheduleWork from many threads", TestPlatformMgr_ScheduleWorkFromManyThreads),
+#endif
 
     NL_TEST_SENTINEL()
 };
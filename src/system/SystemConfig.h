@@ -385,6 +385,23 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX 1583
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES
+ *
+ *  @brief
+ *      The maximum size an application can request with \c PacketBufferHandle::NewLarge(), for payloads that do not fit in
+ *      \c CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX, such as large messages received over TCP.
+ *
+ *      Large buffers are only available when packet buffers are allocated from the heap (i.e. when
+ *      \c CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0); elsewhere, and when this is 0, \c NewLarge() is limited to the
+ *      regular maximum size.
+ *
+ *      The size must leave room for the \c PacketBuffer structure within 16 bits.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES
+#define CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES 0
+#endif /* CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES */
+
 /**
  *  @def _CHIP_SYSTEM_CONFIG_LWIP_EVENT
  *
@@ -474,6 +491,17 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS 0
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) the CHIP stack maintains the runtime metrics of SystemMetrics.h: message, report,
+ *      command and access control counters, and the latency and size histograms of its hot paths.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+#define CHIP_SYSTEM_CONFIG_PROVIDE_METRICS 0
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_TEST
  *
@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file implements the runtime metrics of the CHIP stack.
+ */
+
+#include <system/SystemMetrics.h>
+
+#include <string.h>
+
+namespace chip {
+namespace System {
+namespace Metrics {
+
+namespace {
+
+const char * const sCounterNames[kNumCounters] = {
+    "chip_messages_sent_total",
+    "chip_messages_received_total",
+    "chip_message_retransmissions_total",
+    "chip_reports_sent_total",
+    "chip_commands_invoked_total",
+    "chip_access_control_checks_total",
+    "chip_access_control_denials_total",
+    "chip_access_control_errors_total",
+    "chip_storage_writes_total",
+};
+
+const char * const sGaugeNames[kNumGauges] = {
+    "chip_exchanges_in_use",
+    "chip_read_handlers_in_use",
+};
+
+const char * const sHistogramNames[kNumHistograms] = {
+    "chip_report_size_bytes",
+    "chip_access_control_check_latency_microseconds",
+    "chip_storage_write_latency_microseconds",
+};
+
+Snapshot sMetrics;
+
+} // namespace
+
+void Increment(Counter counter, uint64_t delta)
+{
+    sMetrics.mCounters[counter] += delta;
+}
+
+void Add(Gauge gauge, int32_t delta)
+{
+    sMetrics.mGauges[gauge] += delta;
+}
+
+void Record(Histogram histogram, uint32_t value)
+{
+    HistogramData & data = sMetrics.mHistograms[histogram];
+
+    data.mBuckets[GetBucketIndex(value)]++;
+    data.mCount++;
+    data.mSum += value;
+    if (data.mMax < value)
+    {
+        data.mMax = value;
+    }
+}
+
+void GetSnapshot(Snapshot & aSnapshot)
+{
+    memcpy(&aSnapshot, &sMetrics, sizeof(aSnapshot));
+}
+
+void Reset()
+{
+    memset(&sMetrics, 0, sizeof(sMetrics));
+}
+
+const char * GetName(Counter counter)
+{
+    return sCounterNames[counter];
+}
+
+const char * GetName(Gauge gauge)
+{
+    return sGaugeNames[gauge];
+}
+
+const char * GetName(Histogram histogram)
+{
+    return sHistogramNames[histogram];
+}
+
+size_t GetBucketIndex(uint32_t value)
+{
+    if (value < kHistogramSubBuckets)
+    {
+        return value;
+    }
+
+    // Position of the most significant bit, which is at least kHistogramSubBucketBits.
+    size_t msb = 31;
+    while ((value & (1u << msb)) == 0)
+    {
+        msb--;
+    }
+
+    // The kHistogramSubBucketBits bits below the most significant one select the bucket within its power of two.
+    size_t subBucket = (value >> (msb - kHistogramSubBucketBits)) & (kHistogramSubBuckets - 1);
+    return (msb - kHistogramSubBucketBits + 1) * kHistogramSubBuckets + subBucket;
+}
+
+uint32_t GetBucketLowerBound(size_t index)
+{
+    if (index < kHistogramSubBuckets)
+    {
+        return static_cast<uint32_t>(index);
+    }
+
+    size_t msb       = index / kHistogramSubBuckets + kHistogramSubBucketBits - 1;
+    size_t subBucket = index % kHistogramSubBuckets;
+    return static_cast<uint32_t>((kHistogramSubBuckets + subBucket) << (msb - kHistogramSubBucketBits));
+}
+
+ScopedLatency::~ScopedLatency()
+{
+    Clock::Microseconds64 elapsed = SystemClock().GetMonotonicMicroseconds64() - mStart;
+    Record(mHistogram, elapsed.count() > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(elapsed.count()));
+}
+
+} // namespace Metrics
+} // namespace System
+} // namespace chip
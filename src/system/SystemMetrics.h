@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  Runtime metrics of the CHIP stack: counters, gauges and latency/size histograms.
+ *
+ *  Every metric is a fixed entry of a static table: updating one takes no lock and never allocates. As for
+ *  SystemStats.h, updates are made with the CHIP stack lock held, and so must be GetSnapshot(). The SYSTEM_METRICS_*
+ *  macros compile out unless CHIP_SYSTEM_CONFIG_PROVIDE_METRICS is set.
+ *
+ *  Histograms are log-linear, as HDR histograms: each power of two is split in kHistogramSubBuckets buckets, so that
+ *  any value is counted in a bucket whose bounds are within 25% of it.
+ */
+
+#pragma once
+
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+namespace Metrics {
+
+enum Counter
+{
+    kCounter_MessagesSent,
+    kCounter_MessagesReceived,
+    kCounter_MessageRetransmissions,
+    kCounter_ReportsSent,
+    kCounter_CommandsInvoked,
+    kCounter_AccessControlChecks,
+    kCounter_AccessControlDenials,
+    kCounter_AccessControlErrors,
+    kCounter_StorageWrites,
+    kNumCounters
+};
+
+enum Gauge
+{
+    kGauge_ExchangesInUse,
+    kGauge_ReadHandlersInUse,
+    kNumGauges
+};
+
+enum Histogram
+{
+    kHistogram_ReportSizeBytes,
+    kHistogram_AccessControlCheckLatencyUs,
+    kHistogram_StorageWriteLatencyUs,
+    kNumHistograms
+};
+
+constexpr size_t kHistogramSubBucketBits = 2;
+constexpr size_t kHistogramSubBuckets    = 1 << kHistogramSubBucketBits;
+// Values below kHistogramSubBuckets each have a bucket; every other power of two up to 2^31 has kHistogramSubBuckets.
+constexpr size_t kHistogramBuckets = (32 - kHistogramSubBucketBits + 1) * kHistogramSubBuckets;
+
+struct HistogramData
+{
+    uint32_t mBuckets[kHistogramBuckets];
+    uint64_t mCount;
+    uint64_t mSum;
+    uint32_t mMax;
+};
+
+struct Snapshot
+{
+    uint64_t mCounters[kNumCounters];
+    int32_t mGauges[kNumGauges];
+    HistogramData mHistograms[kNumHistograms];
+};
+
+void Increment(Counter counter, uint64_t delta = 1);
+void Add(Gauge gauge, int32_t delta);
+void Record(Histogram histogram, uint32_t value);
+
+void GetSnapshot(Snapshot & aSnapshot);
+void Reset();
+
+// Metric names, as exported: snake case, with the unit as suffix.
+const char * GetName(Counter counter);
+const char * GetName(Gauge gauge);
+const char * GetName(Histogram histogram);
+
+/**
+ * @return the index of the histogram bucket counting value.
+ */
+size_t GetBucketIndex(uint32_t value);
+
+/**
+ * @return the smallest value counted in the histogram bucket at index.
+ */
+uint32_t GetBucketLowerBound(size_t index);
+
+/**
+ * Records the time from its construction to its destruction, in microseconds, in a histogram.
+ */
+class ScopedLatency
+{
+public:
+    ScopedLatency(Histogram histogram) : mHistogram(histogram), mStart(SystemClock().GetMonotonicMicroseconds64()) {}
+    ~ScopedLatency();
+
+    ScopedLatency(const ScopedLatency &) = delete;
+    ScopedLatency & operator=(const ScopedLatency &) = delete;
+
+private:
+    Histogram mHistogram;
+    Clock::Microseconds64 mStart;
+};
+
+} // namespace Metrics
+} // namespace System
+} // namespace chip
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+
+#define _SYSTEM_METRICS_CONCAT_INNER(a, b) a##b
+#define _SYSTEM_METRICS_CONCAT(a, b) _SYSTEM_METRICS_CONCAT_INNER(a, b)
+
+#define SYSTEM_METRICS_INCREMENT(counter) chip::System::Metrics::Increment(counter)
+#define SYSTEM_METRICS_INCREMENT_BY_N(counter, n) chip::System::Metrics::Increment(counter, n)
+#define SYSTEM_METRICS_GAUGE_INCREMENT(gauge) chip::System::Metrics::Add(gauge, 1)
+#define SYSTEM_METRICS_GAUGE_DECREMENT(gauge) chip::System::Metrics::Add(gauge, -1)
+#define SYSTEM_METRICS_RECORD(histogram, value) chip::System::Metrics::Record(histogram, value)
+#define SYSTEM_METRICS_RECORD_LATENCY_SCOPE(histogram)                                                                             \
+    chip::System::Metrics::ScopedLatency _SYSTEM_METRICS_CONCAT(_systemMetricsLatency, __LINE__)(histogram)
+
+#else // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
+
+#define SYSTEM_METRICS_INCREMENT(counter)
+#define SYSTEM_METRICS_INCREMENT_BY_N(counter, n)
+#define SYSTEM_METRICS_GAUGE_INCREMENT(gauge)
+#define SYSTEM_METRICS_GAUGE_DECREMENT(gauge)
+#define SYSTEM_METRICS_RECORD(histogram, value)
+#define SYSTEM_METRICS_RECORD_LATENCY_SCOPE(histogram)
+
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_METRICS
@@ -440,6 +440,16 @@ void PacketBuffer::AddRef()
 }
 
 PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aReservedSize)
+{
+    return Allocate(aAvailableSize, aReservedSize, PacketBuffer::kMaxSizeWithoutReserve);
+}
+
+PacketBufferHandle PacketBufferHandle::NewLarge(size_t aAvailableSize, uint16_t aReservedSize)
+{
+    return Allocate(aAvailableSize, aReservedSize, PacketBuffer::kLargeBufMaxSizeWithoutReserve);
+}
+
+PacketBufferHandle PacketBufferHandle::Allocate(size_t aAvailableSize, uint16_t aReservedSize, uint16_t aMaxAllocSize)
 {
     // Adding three 16-bit-int sized numbers together will never overflow
     // assuming int is at least 32 bits.
@@ -457,7 +467,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_PacketBufferNew, return PacketBufferHandle());
 
-    if (aAvailableSize > UINT16_MAX || lAllocSize > PacketBuffer::kMaxSizeWithoutReserve || lBlockSize > UINT16_MAX)
+    if (aAvailableSize > UINT16_MAX || lAllocSize > aMaxAllocSize || lBlockSize > UINT16_MAX)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: allocation too large.");
         return PacketBufferHandle();
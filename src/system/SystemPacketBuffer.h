@@ -129,6 +129,19 @@ public:
     static constexpr uint16_t kMaxSizeWithoutReserve = CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX;
 #endif
 
+    /**
+     * The maximum size buffer an application can allocate with \c PacketBufferHandle::NewLarge().
+     */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+    static constexpr uint16_t kLargeBufMaxSizeWithoutReserve =
+        (CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES > kMaxSizeWithoutReserve) ? CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES
+                                                                                  : kMaxSizeWithoutReserve;
+    static_assert(CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES <= UINT16_MAX - kStructureSize,
+                  "CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES is too large");
+#else
+    static constexpr uint16_t kLargeBufMaxSizeWithoutReserve = kMaxSizeWithoutReserve;
+#endif
+
     /**
      * The number of bytes to reserve in a network packet buffer to contain all the possible protocol encapsulation headers
      * before the application data.
@@ -612,6 +625,20 @@ public:
      */
     static PacketBufferHandle New(size_t aAvailableSize, uint16_t aReservedSize = PacketBuffer::kDefaultHeaderReserve);
 
+    /**
+     * Allocates a packet buffer that may be larger than \c PacketBuffer::kMaxSizeWithoutReserve.
+     *
+     *  Behaves like \c New(), except that the sum of \a aAvailableSize and \a aReservedSize may be as large as
+     *  \c PacketBuffer::kLargeBufMaxSizeWithoutReserve. Large buffers are only available when packet buffers are allocated
+     *  from the heap; see \c CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES.
+     *
+     *  @param[in]  aAvailableSize  Minimum number of octets to for application data (at `Start()`).
+     *  @param[in]  aReservedSize   Number of octets to reserve for protocol headers (before `Start()`).
+     *
+     *  @return     On success, a PacketBufferHandle to the allocated buffer. On fail, \c nullptr.
+     */
+    static PacketBufferHandle NewLarge(size_t aAvailableSize, uint16_t aReservedSize = 0);
+
     /**
      * Allocates a packet buffer with initial contents.
      *
@@ -668,6 +695,8 @@ private:
     // The caller's ownership is transferred to this.
     explicit PacketBufferHandle(PacketBuffer * buffer) : mBuffer(buffer) {}
 
+    static PacketBufferHandle Allocate(size_t aAvailableSize, uint16_t aReservedSize, uint16_t aMaxAllocSize);
+
     static PacketBufferHandle Hold(PacketBuffer * buffer)
     {
         if (buffer != nullptr)
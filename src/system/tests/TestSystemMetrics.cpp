@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemClock.h>
+#include <system/SystemMetrics.h>
+
+using namespace chip::System;
+
+namespace {
+
+void TestBuckets(nlTestSuite * inSuite, void * inContext)
+{
+    // Small values have a bucket each.
+    for (uint32_t value = 0; value < 8; value++)
+    {
+        NL_TEST_ASSERT(inSuite, Metrics::GetBucketLowerBound(Metrics::GetBucketIndex(value)) == value);
+    }
+
+    // Larger ones share buckets, whose lower bound is within 25% of them.
+    const uint32_t values[] = { 9, 100, 1000, 4095, 4096, 123456, 0x7fffffff, 0x80000000, UINT32_MAX };
+    for (uint32_t value : values)
+    {
+        size_t index = Metrics::GetBucketIndex(value);
+        NL_TEST_ASSERT(inSuite, index < Metrics::kHistogramBuckets);
+        NL_TEST_ASSERT(inSuite, Metrics::GetBucketLowerBound(index) <= value);
+        NL_TEST_ASSERT(inSuite, value - Metrics::GetBucketLowerBound(index) <= value / 4);
+        if (index + 1 < Metrics::kHistogramBuckets)
+        {
+            NL_TEST_ASSERT(inSuite, Metrics::GetBucketLowerBound(index + 1) > value);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, Metrics::GetBucketIndex(UINT32_MAX) == Metrics::kHistogramBuckets - 1);
+
+    // Bucket bounds increase with their index.
+    for (size_t index = 1; index < Metrics::kHistogramBuckets; index++)
+    {
+        NL_TEST_ASSERT(inSuite, Metrics::GetBucketLowerBound(index - 1) < Metrics::GetBucketLowerBound(index));
+        NL_TEST_ASSERT(inSuite, Metrics::GetBucketIndex(Metrics::GetBucketLowerBound(index)) == index);
+    }
+}
+
+void TestUpdates(nlTestSuite * inSuite, void * inContext)
+{
+    Metrics::Reset();
+
+    Metrics::Increment(Metrics::kCounter_MessagesSent);
+    Metrics::Increment(Metrics::kCounter_MessagesSent, 2);
+    Metrics::Add(Metrics::kGauge_ExchangesInUse, 2);
+    Metrics::Add(Metrics::kGauge_ExchangesInUse, -1);
+    Metrics::Record(Metrics::kHistogram_ReportSizeBytes, 100);
+    Metrics::Record(Metrics::kHistogram_ReportSizeBytes, 1000);
+
+    Metrics::Snapshot snapshot;
+    Metrics::GetSnapshot(snapshot);
+    NL_TEST_ASSERT(inSuite, snapshot.mCounters[Metrics::kCounter_MessagesSent] == 3);
+    NL_TEST_ASSERT(inSuite, snapshot.mCounters[Metrics::kCounter_MessagesReceived] == 0);
+    NL_TEST_ASSERT(inSuite, snapshot.mGauges[Metrics::kGauge_ExchangesInUse] == 1);
+
+    const Metrics::HistogramData & reportSizes = snapshot.mHistograms[Metrics::kHistogram_ReportSizeBytes];
+    NL_TEST_ASSERT(inSuite, reportSizes.mCount == 2);
+    NL_TEST_ASSERT(inSuite, reportSizes.mSum == 1100);
+    NL_TEST_ASSERT(inSuite, reportSizes.mMax == 1000);
+    NL_TEST_ASSERT(inSuite, reportSizes.mBuckets[Metrics::GetBucketIndex(100)] == 1);
+    NL_TEST_ASSERT(inSuite, reportSizes.mBuckets[Metrics::GetBucketIndex(1000)] == 1);
+
+    Metrics::Reset();
+    Metrics::GetSnapshot(snapshot);
+    NL_TEST_ASSERT(inSuite, snapshot.mCounters[Metrics::kCounter_MessagesSent] == 0);
+    NL_TEST_ASSERT(inSuite, snapshot.mHistograms[Metrics::kHistogram_ReportSizeBytes].mCount == 0);
+}
+
+void TestScopedLatency(nlTestSuite * inSuite, void * inContext)
+{
+    Clock::Internal::MockClock clock;
+    Clock::ClockBase * savedRealClock = &SystemClock();
+    Clock::Internal::SetSystemClockForTesting(&clock);
+    Metrics::Reset();
+
+    {
+        Metrics::ScopedLatency latency(Metrics::kHistogram_StorageWriteLatencyUs);
+        clock.AdvanceMonotonic(Clock::Milliseconds64(3));
+    }
+
+    Metrics::Snapshot snapshot;
+    Metrics::GetSnapshot(snapshot);
+    NL_TEST_ASSERT(inSuite, snapshot.mHistograms[Metrics::kHistogram_StorageWriteLatencyUs].mCount == 1);
+    NL_TEST_ASSERT(inSuite, snapshot.mHistograms[Metrics::kHistogram_StorageWriteLatencyUs].mMax == 3000);
+
+    Metrics::Reset();
+    Clock::Internal::SetSystemClockForTesting(savedRealClock);
+}
+
+} // namespace
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestBuckets", TestBuckets),
+    NL_TEST_DEF("TestUpdates", TestUpdates),
+    NL_TEST_DEF("TestScopedLatency", TestScopedLatency),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSystemMetrics(void)
+{
+    nlTestSuite theSuite = {
+        "chip-systemmetrics", &sTests[0], nullptr /* setup */, nullptr /* teardown */
+    };
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr /* context */);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemMetrics)
@@ -0,0 +1,216 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "BuiltinTrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <inttypes.h>
+#include <new>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace chip {
+namespace Tracing {
+namespace {
+
+struct Event
+{
+    uint64_t mTimestampNs;
+    const char * mLabel;
+    const char * mGroup;
+    uint32_t mTraceId;
+    EventPhase mPhase;
+};
+
+// Written by its thread only. Exporting reads it from another thread: the events it may have overwritten meanwhile
+// are told by mWriteCount, and skipped.
+struct ThreadBuffer
+{
+    Event mEvents[MATTER_BUILTIN_TRACE_BUFFER_EVENTS];
+    std::atomic<uint64_t> mWriteCount{ 0 };
+    uint32_t mThreadId   = 0;
+    ThreadBuffer * mNext = nullptr;
+};
+
+// Buffers are never freed: events of exited threads can still be exported.
+std::atomic<ThreadBuffer *> gBuffers{ nullptr };
+std::atomic<uint32_t> gNextThreadId{ 1 };
+thread_local ThreadBuffer * tBuffer = nullptr;
+
+ThreadBuffer * RegisterThread()
+{
+    auto * buffer = new (std::nothrow) ThreadBuffer();
+    if (buffer == nullptr)
+    {
+        return nullptr;
+    }
+    buffer->mThreadId = gNextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+    ThreadBuffer * head = gBuffers.load(std::memory_order_relaxed);
+    do
+    {
+        buffer->mNext = head;
+    } while (!gBuffers.compare_exchange_weak(head, buffer, std::memory_order_release, std::memory_order_relaxed));
+
+    return buffer;
+}
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void WriteJsonString(FILE * file, const char * string)
+{
+    fputc('"', file);
+    for (const char * c = string; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            fputc('\\', file);
+            fputc(*c, file);
+        }
+        else if (static_cast<unsigned char>(*c) < 0x20)
+        {
+            fprintf(file, "\\u%04x", static_cast<unsigned>(*c));
+        }
+        else
+        {
+            fputc(*c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+void WriteEvent(FILE * file, const Event & event, uint32_t threadId, bool first)
+{
+    fputs(first ? "\n" : ",\n", file);
+    fputs("{\"name\":", file);
+    WriteJsonString(file, event.mLabel != nullptr ? event.mLabel : "");
+    if (event.mGroup != nullptr)
+    {
+        fputs(",\"cat\":", file);
+        WriteJsonString(file, event.mGroup);
+    }
+    // Timestamps are in microseconds.
+    fprintf(file, ",\"ph\":\"%c\",\"ts\":%" PRIu64 ".%03u,\"pid\":%d,\"tid\":%" PRIu32, static_cast<char>(event.mPhase),
+            event.mTimestampNs / 1000, static_cast<unsigned>(event.mTimestampNs % 1000), static_cast<int>(getpid()), threadId);
+    if (event.mPhase == EventPhase::kAsyncBegin || event.mPhase == EventPhase::kAsyncEnd)
+    {
+        fprintf(file, ",\"id\":\"0x%" PRIx32 "\"", event.mTraceId);
+    }
+    else if (event.mPhase == EventPhase::kInstant)
+    {
+        fputs(",\"s\":\"t\"", file);
+    }
+    fputc('}', file);
+}
+
+} // namespace
+
+void RecordEvent(EventPhase phase, const char * label, const char * group, uint32_t traceId)
+{
+    if (tBuffer == nullptr)
+    {
+        tBuffer = RegisterThread();
+        if (tBuffer == nullptr)
+        {
+            return;
+        }
+    }
+
+    uint64_t index = tBuffer->mWriteCount.load(std::memory_order_relaxed);
+    Event & event  = tBuffer->mEvents[index % MATTER_BUILTIN_TRACE_BUFFER_EVENTS];
+
+    // Pairs with the fence in ExportJson: an exporter which copies any part of this event then sees the write count
+    // telling that the slot is being overwritten.
+    std::atomic_thread_fence(std::memory_order_release);
+    event.mTimestampNs = NowNs();
+    event.mLabel       = label;
+    event.mGroup       = group;
+    event.mTraceId     = traceId;
+    event.mPhase       = phase;
+    tBuffer->mWriteCount.store(index + 1, std::memory_order_release);
+}
+
+bool ExportJson(const char * path)
+{
+    FILE * file = fopen(path, "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    bool first = true;
+    for (ThreadBuffer * buffer = gBuffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->mNext)
+    {
+        uint64_t end   = buffer->mWriteCount.load(std::memory_order_acquire);
+        uint64_t begin = end > MATTER_BUILTIN_TRACE_BUFFER_EVENTS ? end - MATTER_BUILTIN_TRACE_BUFFER_EVENTS : 0;
+        for (uint64_t index = begin; index < end; index++)
+        {
+            Event event = buffer->mEvents[index % MATTER_BUILTIN_TRACE_BUFFER_EVENTS];
+            // Skip the event if its thread has overwritten it, or may be overwriting it, while it was copied. The fence
+            // keeps the copy from being reordered after the load of the write count.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t written = buffer->mWriteCount.load(std::memory_order_relaxed);
+            if (written - index >= MATTER_BUILTIN_TRACE_BUFFER_EVENTS)
+            {
+                continue;
+            }
+            WriteEvent(file, event, buffer->mThreadId, first);
+            first = false;
+        }
+    }
+    fputs("\n]}\n", file);
+
+    bool success = !ferror(file);
+    return (fclose(file) == 0) && success;
+}
+
+bool ExportJsonOnSignal(int signalNumber, const char * path)
+{
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, signalNumber);
+    if (pthread_sigmask(SIG_BLOCK, &signals, nullptr) != 0)
+    {
+        return false;
+    }
+
+    std::string exportPath(path);
+    std::thread([signals, exportPath]() {
+        int signal;
+        while (sigwait(&signals, &signal) == 0)
+        {
+            if (!ExportJson(exportPath.c_str()))
+            {
+                fprintf(stderr, "Failed to export trace events to %s\n", exportPath.c_str());
+            }
+        }
+    }).detach();
+    return true;
+}
+
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * Built-in trace backend, for POSIX hosts.
+ *
+ * Each thread records its trace events, with nanosecond timestamps, into its own ring buffer: recording takes no lock
+ * and never allocates, except once per thread. ExportJson writes the events still in the buffers as a Chrome trace
+ * JSON file, which chrome://tracing and https://ui.perfetto.dev open.
+ *
+ * Only pointers to the labels and groups are recorded: they must be string literals, as for pw_trace.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef MATTER_BUILTIN_TRACE_BUFFER_EVENTS
+// Number of events each thread keeps: older ones are overwritten.
+#define MATTER_BUILTIN_TRACE_BUFFER_EVENTS 8192
+#endif
+
+namespace chip {
+namespace Tracing {
+
+enum class EventPhase : char
+{
+    kInstant    = 'i',
+    kBegin      = 'B', // Duration events, which must nest within a thread.
+    kEnd        = 'E',
+    kAsyncBegin = 'b', // Events matched by their trace id, e.g. started and ended in different callbacks.
+    kAsyncEnd   = 'e',
+};
+
+void RecordEvent(EventPhase phase, const char * label, const char * group, uint32_t traceId);
+
+/**
+ * Write the events recorded by every thread to the file at path, as Chrome trace JSON.
+ *
+ * @return false if the file could not be written.
+ */
+bool ExportJson(const char * path);
+
+/**
+ * Export the events to path each time the process receives signalNumber (e.g. SIGUSR1).
+ *
+ * The signal is blocked and waited for by a thread of its own, so this must be called before any other thread is
+ * started, for them to inherit the blocked signal.
+ *
+ * @return false if the signal could not be blocked.
+ */
+bool ExportJsonOnSignal(int signalNumber, const char * path);
+
+inline void Instant(const char * label, const char * group = nullptr, uint32_t traceId = 0)
+{
+    RecordEvent(EventPhase::kInstant, label, group, traceId);
+}
+
+inline void Start(const char * label, const char * group = nullptr, uint32_t traceId = 0)
+{
+    RecordEvent(EventPhase::kAsyncBegin, label, group, traceId);
+}
+
+inline void End(const char * label, const char * group = nullptr, uint32_t traceId = 0)
+{
+    RecordEvent(EventPhase::kAsyncEnd, label, group, traceId);
+}
+
+// The _DATA variants record their label and group only: whether a trace id comes next cannot be told from the
+// arguments.
+template <typename... Data>
+inline void InstantData(const char * label, const char * group, Data &&...)
+{
+    Instant(label, group);
+}
+
+template <typename... Data>
+inline void StartData(const char * label, const char * group, Data &&...)
+{
+    Start(label, group);
+}
+
+template <typename... Data>
+inline void EndData(const char * label, const char * group, Data &&...)
+{
+    End(label, group);
+}
+
+// The group and trace id of a function scope, whichever of them are given.
+struct FunctionScopeArgs
+{
+    const char * mGroup;
+    uint32_t mTraceId;
+};
+
+inline FunctionScopeArgs MakeFunctionScopeArgs(const char * group = nullptr, uint32_t traceId = 0)
+{
+    return { group, traceId };
+}
+
+template <typename Flag>
+inline FunctionScopeArgs MakeFunctionScopeArgsWithFlag(Flag, const char * group = nullptr, uint32_t traceId = 0)
+{
+    return { group, traceId };
+}
+
+class Scope
+{
+public:
+    Scope(const char * label, const char * group = nullptr, uint32_t traceId = 0) :
+        mLabel(label), mGroup(group), mTraceId(traceId)
+    {
+        RecordEvent(EventPhase::kBegin, mLabel, mGroup, mTraceId);
+    }
+    Scope(const char * function, FunctionScopeArgs args) : Scope(function, args.mGroup, args.mTraceId) {}
+    ~Scope() { RecordEvent(EventPhase::kEnd, mLabel, mGroup, mTraceId); }
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+private:
+    const char * mLabel;
+    const char * mGroup;
+    uint32_t mTraceId;
+};
+
+} // namespace Tracing
+} // namespace chip
+
+#define _MATTER_TRACE_CONCAT_INNER(a, b) a##b
+#define _MATTER_TRACE_CONCAT(a, b) _MATTER_TRACE_CONCAT_INNER(a, b)
+#define _MATTER_TRACE_SCOPE_NAME _MATTER_TRACE_CONCAT(_matterTraceScope, __LINE__)
+
+#define MATTER_TRACE_EVENT_INSTANT(...) ::chip::Tracing::Instant(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_INSTANT_FLAG(flag, ...) ::chip::Tracing::Instant(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_INSTANT_DATA(...) ::chip::Tracing::InstantData(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_INSTANT_DATA_FLAG(flag, ...) ::chip::Tracing::InstantData(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_START(...) ::chip::Tracing::Start(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_START_FLAG(flag, ...) ::chip::Tracing::Start(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_START_DATA(...) ::chip::Tracing::StartData(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_START_DATA_FLAG(flag, ...) ::chip::Tracing::StartData(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_END(...) ::chip::Tracing::End(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_END_FLAG(flag, ...) ::chip::Tracing::End(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_END_DATA(...) ::chip::Tracing::EndData(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_END_DATA_FLAG(flag, ...) ::chip::Tracing::EndData(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_SCOPE(...) ::chip::Tracing::Scope _MATTER_TRACE_SCOPE_NAME(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_SCOPE_FLAG(flag, ...) ::chip::Tracing::Scope _MATTER_TRACE_SCOPE_NAME(__VA_ARGS__)
+#define MATTER_TRACE_EVENT_FUNCTION(...)                                                                                           \
+    ::chip::Tracing::Scope _MATTER_TRACE_SCOPE_NAME(__func__, ::chip::Tracing::MakeFunctionScopeArgs(__VA_ARGS__))
+#define MATTER_TRACE_EVENT_FUNCTION_FLAG(...)                                                                                      \
+    ::chip::Tracing::Scope _MATTER_TRACE_SCOPE_NAME(__func__, ::chip::Tracing::MakeFunctionScopeArgsWithFlag(__VA_ARGS__))
@@ -0,0 +1,164 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <trace/BuiltinTrace.h>
+
+#include <nlunit-test.h>
+
+#include <atomic>
+#include <fstream>
+#include <inttypes.h>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip::Tracing;
+
+namespace {
+
+constexpr char kJsonHeader[]  = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+constexpr char kJsonTrailer[] = "\n]}\n";
+
+// Exports the trace to a temporary file and returns the trace ids of the async begin events labelled label, in the
+// order of the file. Every event line must be a well-formed JSON object.
+bool ExportTraceIds(nlTestSuite * inSuite, const char * label, std::vector<uint32_t> & traceIds)
+{
+    char path[] = "/tmp/TestBuiltinTraceXXXXXX";
+    int fd      = mkstemp(path);
+    NL_TEST_ASSERT(inSuite, fd >= 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    close(fd);
+
+    bool exported = ExportJson(path);
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    unlink(path);
+    NL_TEST_ASSERT(inSuite, exported);
+
+    std::string json = contents.str();
+    NL_TEST_ASSERT(inSuite, json.compare(0, strlen(kJsonHeader), kJsonHeader) == 0);
+    NL_TEST_ASSERT(inSuite,
+                   json.size() >= strlen(kJsonTrailer) &&
+                       json.compare(json.size() - strlen(kJsonTrailer), strlen(kJsonTrailer), kJsonTrailer) == 0);
+
+    std::string name = std::string("{\"name\":\"") + label + "\"";
+    traceIds.clear();
+
+    // One event per line, between the header and the trailer.
+    std::istringstream lines(json.substr(strlen(kJsonHeader), json.size() - strlen(kJsonHeader) - strlen(kJsonTrailer)));
+    std::string line;
+    std::getline(lines, line);
+    while (std::getline(lines, line))
+    {
+        if (!line.empty() && line.back() == ',')
+        {
+            line.pop_back();
+        }
+        NL_TEST_ASSERT(inSuite, line.size() > 2 && line.front() == '{' && line.back() == '}');
+        NL_TEST_ASSERT(inSuite, line.find("\"ph\":\"") != std::string::npos && line.find("\"ts\":") != std::string::npos);
+        if (line.compare(0, name.size(), name) != 0 || line.find("\"ph\":\"b\"") == std::string::npos)
+        {
+            continue;
+        }
+
+        size_t id        = line.find("\"id\":\"0x");
+        uint32_t traceId = 0;
+        NL_TEST_ASSERT(inSuite, id != std::string::npos && sscanf(line.c_str() + id, "\"id\":\"0x%" SCNx32 "\"", &traceId) == 1);
+        traceIds.push_back(traceId);
+    }
+    return true;
+}
+
+void TestWraparound(nlTestSuite * inSuite, void * inContext)
+{
+    // Record from a thread of its own, so that its buffer only has these events.
+    constexpr uint32_t kEventCount = MATTER_BUILTIN_TRACE_BUFFER_EVENTS + 100;
+    std::thread([]() {
+        for (uint32_t i = 0; i < kEventCount; i++)
+        {
+            Start("TestWraparound", "Test", i);
+        }
+    }).join();
+
+    std::vector<uint32_t> traceIds;
+    NL_TEST_ASSERT(inSuite, ExportTraceIds(inSuite, "TestWraparound", traceIds));
+
+    // The oldest events were overwritten, and the oldest one left is in the slot the next event goes to: the others are
+    // exported in order.
+    NL_TEST_ASSERT(inSuite, traceIds.size() == MATTER_BUILTIN_TRACE_BUFFER_EVENTS - 1);
+    for (size_t i = 0; i < traceIds.size(); i++)
+    {
+        NL_TEST_ASSERT(inSuite, traceIds[i] == kEventCount - MATTER_BUILTIN_TRACE_BUFFER_EVENTS + 1 + i);
+    }
+}
+
+void TestExportWhileRecording(nlTestSuite * inSuite, void * inContext)
+{
+    std::atomic<bool> stop{ false };
+    std::thread recorder([&stop]() {
+        for (uint32_t i = 0; !stop.load(std::memory_order_relaxed); i++)
+        {
+            Start("TestExportWhileRecording", "Test", i);
+        }
+    });
+
+    // Events overwritten while they were exported are skipped: the others are consecutive.
+    for (int i = 0; i < 20; i++)
+    {
+        std::vector<uint32_t> traceIds;
+        NL_TEST_ASSERT(inSuite, ExportTraceIds(inSuite, "TestExportWhileRecording", traceIds));
+        NL_TEST_ASSERT(inSuite, traceIds.size() <= MATTER_BUILTIN_TRACE_BUFFER_EVENTS);
+        for (size_t j = 1; j < traceIds.size(); j++)
+        {
+            NL_TEST_ASSERT(inSuite, traceIds[j] == traceIds[j - 1] + 1);
+        }
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    recorder.join();
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestWraparound", TestWraparound),
+    NL_TEST_DEF("TestExportWhileRecording", TestExportWhileRecording),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestBuiltinTrace()
+{
+    nlTestSuite theSuite = { "BuiltinTrace", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBuiltinTrace)
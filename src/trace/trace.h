@@ -25,7 +25,11 @@ void InitializeTracing();
 
 #include "trace/MatterCustomTrace.h"
 
-#else // MATTER_CUSTOM_TRACE
+#elif defined(MATTER_BUILTIN_TRACE) && MATTER_BUILTIN_TRACE
+
+#include "trace/BuiltinTrace.h"
+
+#else // MATTER_CUSTOM_TRACE, MATTER_BUILTIN_TRACE
 
 #if defined(PW_TRACE_BACKEND_SET) && PW_TRACE_BACKEND_SET
 
@@ -80,4 +84,4 @@ void InitializeTracing();
 
 #endif // defined(PW_TRACE_BACKEND_SET) && PW_TRACE_BACKEND_SET
 
-#endif // defined(MATTER_CUSTOM_TRACE) && MATTER_CUSTOM_TRACE
+#endif // MATTER_CUSTOM_TRACE, MATTER_BUILTIN_TRACE
@@ -40,6 +40,8 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemMetrics.h>
+#include <trace/trace.h>
 #include <transport/GroupPeerMessageCounter.h>
 #include <transport/GroupSession.h>
 #include <transport/SecureMessageCodec.h>
@@ -141,6 +143,7 @@ void SessionManager::FabricRemoved(FabricIndex fabricIndex)
 CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && message, EncryptedPacketBufferHandle & preparedMessage)
 {
+    MATTER_TRACE_EVENT_SCOPE("PrepareMessage", "SessionManager");
     PacketHeader packetHeader;
     bool isControlMsg = IsControlMessage(payloadHeader);
     if (isControlMsg)
@@ -302,6 +305,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
 CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHandle,
                                                const EncryptedPacketBufferHandle & preparedMessage)
 {
+    MATTER_TRACE_EVENT_SCOPE("SendPreparedMessage", "SessionManager");
     VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(!preparedMessage.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -388,6 +392,7 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
                     if (mTransportMgr != nullptr)
                     {
                         CHIP_TRACE_PREPARED_MESSAGE_SENT(destination, &tempBuf);
+                        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_MessagesSent);
                         if (CHIP_NO_ERROR != mTransportMgr->SendMessage(*destination, std::move(tempBuf)))
                         {
                             ChipLogError(Inet, "Failed to send Multicast message on interface %s", name);
@@ -417,6 +422,7 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
     if (mTransportMgr != nullptr)
     {
         CHIP_TRACE_PREPARED_MESSAGE_SENT(destination, &msgBuf);
+        SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_MessagesSent);
         return mTransportMgr->SendMessage(*destination, std::move(msgBuf));
     }
 
@@ -541,7 +547,9 @@ CHIP_ERROR SessionManager::InjectCaseSessionWithTestKey(SessionHolder & sessionH
 
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_EVENT_SCOPE("OnMessageReceived", "SessionManager");
     CHIP_TRACE_PREPARED_MESSAGE_RECEIVED(&peerAddress, &msg);
+    SYSTEM_METRICS_INCREMENT(System::Metrics::kCounter_MessagesReceived);
     PacketHeader packetHeader;
 
     CHIP_ERROR err = packetHeader.DecodeAndConsume(msg);
@@ -571,6 +579,7 @@ void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::
 void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                                     System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_EVENT_SCOPE("UnauthenticatedMessageDispatch", "SessionManager");
     Optional<NodeId> source      = packetHeader.GetSourceNodeId();
     Optional<NodeId> destination = packetHeader.GetDestinationNodeId();
     if ((source.HasValue() && destination.HasValue()) || (!source.HasValue() && !destination.HasValue()))
@@ -642,6 +651,7 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & packetH
 void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                                   System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_EVENT_SCOPE("SecureUnicastMessageDispatch", "SessionManager");
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     Optional<SessionHandle> session = mSecureSessions.FindSecureSessionByLocalKey(packetHeader.GetSessionId());
@@ -739,6 +749,7 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & packetHea
 void SessionManager::SecureGroupMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                                 System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_EVENT_SCOPE("SecureGroupMessageDispatch", "SessionManager");
     PayloadHeader payloadHeader;
     Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
     VerifyOrReturn(nullptr != groups);
@@ -45,6 +45,12 @@ constexpr size_t kPacketSizeBytes = 2;
 // TODO: Actual limit may be lower (spec issue #2119)
 constexpr uint16_t kMaxMessageSize = static_cast<uint16_t>(System::PacketBuffer::kMaxSizeWithoutReserve - kPacketSizeBytes);
 
+// Messages of at least kMaxMessageSize bytes are reassembled into a large packet buffer, when those are available.
+constexpr uint16_t kMaxLargeMessageSize =
+    (System::PacketBuffer::kLargeBufMaxSizeWithoutReserve > System::PacketBuffer::kMaxSizeWithoutReserve)
+    ? System::PacketBuffer::kLargeBufMaxSizeWithoutReserve
+    : 0;
+
 constexpr int kListenBacklogSize = 2;
 
 } // namespace
@@ -58,6 +64,11 @@ TCPBase::~TCPBase()
         mListenSocket = nullptr;
     }
 
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnIdleConnectionTimer, this);
+    }
+
     CloseActiveConnections();
 }
 
@@ -71,6 +82,156 @@ void TCPBase::CloseActiveConnections()
             mUsedEndPointCount--;
         }
     }
+    ClearConnectionIndex();
+}
+
+size_t TCPBase::HashPeer(const Inet::IPAddress & address, uint16_t port)
+{
+    // FNV-1a over the address words and the port.
+    uint32_t hash = 2166136261u;
+    for (uint32_t word : address.Addr)
+    {
+        hash = (hash ^ word) * 16777619u;
+    }
+    hash = (hash ^ port) * 16777619u;
+    return hash ^ (hash >> 16);
+}
+
+size_t TCPBase::HashEndPoint(const Inet::TCPEndPoint * endPoint)
+{
+    // Endpoints are pool allocated: the low bits of their addresses carry little information.
+    uintptr_t value = reinterpret_cast<uintptr_t>(endPoint);
+    value ^= value >> 4;
+    value ^= value >> 12;
+    return static_cast<size_t>(value);
+}
+
+void TCPBase::ClearConnectionIndex()
+{
+    std::fill(mConnectionIndex, mConnectionIndex + 2 * mConnectionIndexSize, kEmptyIndexEntry);
+}
+
+void TCPBase::AddToConnectionIndex(size_t slot)
+{
+    const size_t mask                   = mConnectionIndexSize - 1;
+    const ActiveConnectionState & state = mActiveConnections[slot];
+
+    size_t i = HashPeer(state.mPeerAddress.GetIPAddress(), state.mPeerAddress.GetPort()) & mask;
+    while (PeerIndex()[i] != kEmptyIndexEntry)
+    {
+        i = (i + 1) & mask;
+    }
+    PeerIndex()[i] = static_cast<uint16_t>(slot);
+
+    i = HashEndPoint(state.mEndPoint) & mask;
+    while (EndPointIndex()[i] != kEmptyIndexEntry)
+    {
+        i = (i + 1) & mask;
+    }
+    EndPointIndex()[i] = static_cast<uint16_t>(slot);
+}
+
+void TCPBase::RebuildConnectionIndex()
+{
+    // Connections come and go far less often than they are looked up, so removals simply rebuild the index
+    // rather than maintaining tombstones.
+    ClearConnectionIndex();
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        if (mActiveConnections[i].InUse())
+        {
+            AddToConnectionIndex(i);
+        }
+    }
+}
+
+TCPBase::ActiveConnectionState * TCPBase::AddActiveConnection(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress)
+{
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        if (!mActiveConnections[i].InUse())
+        {
+            mActiveConnections[i].Init(endPoint, peerAddress);
+            AddToConnectionIndex(i);
+            return &mActiveConnections[i];
+        }
+    }
+    return nullptr;
+}
+
+void TCPBase::ReleaseActiveConnection(ActiveConnectionState * state)
+{
+    state->Free();
+    mUsedEndPointCount--;
+    RebuildConnectionIndex();
+}
+
+bool TCPBase::EvictIdleConnection()
+{
+    ActiveConnectionState * oldest = nullptr;
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        ActiveConnectionState & state = mActiveConnections[i];
+        if (state.InUse() && state.mIdle && (oldest == nullptr || state.mIdleSince < oldest->mIdleSince))
+        {
+            oldest = &state;
+        }
+    }
+
+    if (oldest == nullptr)
+    {
+        return false;
+    }
+
+    ChipLogDetail(Inet, "Closing idle connection to make room for a new one");
+    ReleaseActiveConnection(oldest);
+    return true;
+}
+
+void TCPBase::ScheduleIdleConnectionTimer()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    bool found = false;
+    System::Clock::Timestamp oldestIdleSince;
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        const ActiveConnectionState & state = mActiveConnections[i];
+        if (state.InUse() && state.mIdle && (!found || state.mIdleSince < oldestIdleSince))
+        {
+            oldestIdleSince = state.mIdleSince;
+            found           = true;
+        }
+    }
+
+    mSystemLayer->CancelTimer(OnIdleConnectionTimer, this);
+    VerifyOrReturn(found);
+
+    System::Clock::Timestamp now    = System::SystemClock().GetMonotonicTimestamp();
+    System::Clock::Timestamp expiry = oldestIdleSince + mIdleConnectionTimeout;
+    System::Clock::Timeout delay    = (expiry > now) ? (expiry - now) : System::Clock::kZero;
+    if (mSystemLayer->StartTimer(delay, OnIdleConnectionTimer, this) != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to start the idle TCP connection timer");
+    }
+}
+
+void TCPBase::OnIdleConnectionTimer(System::Layer * systemLayer, void * appState)
+{
+    TCPBase * tcp                = reinterpret_cast<TCPBase *>(appState);
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
+    {
+        ActiveConnectionState & state = tcp->mActiveConnections[i];
+        if (state.InUse() && state.mIdle && (state.mIdleSince + tcp->mIdleConnectionTimeout <= now))
+        {
+            ChipLogProgress(Inet, "Closing idle connection");
+            tcp->ReleaseActiveConnection(&state);
+        }
+    }
+
+    tcp->ScheduleIdleConnectionTimer();
 }
 
 CHIP_ERROR TCPBase::Init(TcpListenParameters & params)
@@ -100,6 +261,11 @@ CHIP_ERROR TCPBase::Init(TcpListenParameters & params)
     mListenSocket->OnConnectionReceived = OnConnectionReceived;
     mListenSocket->OnAcceptError        = OnAcceptError;
     mEndpointType                       = params.GetAddressType();
+    mSystemLayer                        = &params.GetEndPointManager()->SystemLayer();
+    mIdleConnectionTimeout              = params.GetIdleConnectionTimeout();
+
+    // Connections may have outlived a previous Close().
+    RebuildConnectionIndex();
 
     mState = State::kInitialized;
 
@@ -124,6 +290,10 @@ void TCPBase::Close()
         mListenSocket->Free();
         mListenSocket = nullptr;
     }
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnIdleConnectionTimer, this);
+    }
     mState = State::kNotReady;
 }
 
@@ -134,19 +304,14 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    const size_t mask = mConnectionIndexSize - 1;
+    for (size_t i = HashPeer(address.GetIPAddress(), address.GetPort()) & mask; PeerIndex()[i] != kEmptyIndexEntry;
+         i         = (i + 1) & mask)
     {
-        if (!mActiveConnections[i].InUse())
-        {
-            continue;
-        }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
-
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
+        ActiveConnectionState & state = mActiveConnections[PeerIndex()[i]];
+        if ((state.mPeerAddress.GetIPAddress() == address.GetIPAddress()) && (state.mPeerAddress.GetPort() == address.GetPort()))
         {
-            return &mActiveConnections[i];
+            return &state;
         }
     }
 
@@ -155,11 +320,13 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress
 
 TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPoint * endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    const size_t mask = mConnectionIndexSize - 1;
+    for (size_t i = HashEndPoint(endPoint) & mask; EndPointIndex()[i] != kEmptyIndexEntry; i = (i + 1) & mask)
     {
-        if (mActiveConnections[i].mEndPoint == endPoint)
+        ActiveConnectionState & state = mActiveConnections[EndPointIndex()[i]];
+        if (state.mEndPoint == endPoint)
         {
-            return &mActiveConnections[i];
+            return &state;
         }
     }
     return nullptr;
@@ -190,6 +357,8 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
+        // An idle connection is back in use.
+        connection->mIdle = false;
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
 
@@ -221,8 +390,11 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
         return CHIP_NO_ERROR;
     }
 
-    // Ensures sufficient active connections size exist
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
+    // Ensures sufficient active connections size exist, closing an idle connection if needed
+    if (mUsedEndPointCount >= mActiveConnectionsSize)
+    {
+        VerifyOrReturnError(EvictIdleConnection(), CHIP_ERROR_NO_MEMORY);
+    }
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     Inet::TCPEndPoint * endPoint = nullptr;
@@ -261,6 +433,12 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
 
     while (!state->mReceived.IsNull())
     {
+        if (!state->mLargeMessage.IsNull())
+        {
+            ReturnErrorOnFailure(ContinueLargeMessage(peerAddress, state));
+            continue;
+        }
+
         uint8_t messageSizeBuf[kPacketSizeBytes];
         CHIP_ERROR err = state->mReceived->Read(messageSizeBuf);
         if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
@@ -276,7 +454,15 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
         if (messageSize >= kMaxMessageSize)
         {
             // This message is too long for upper layers.
-            return CHIP_ERROR_MESSAGE_TOO_LONG;
+            VerifyOrReturnError(messageSize <= kMaxLargeMessageSize, CHIP_ERROR_MESSAGE_TOO_LONG);
+
+            // It still fits in a large buffer: stream its data into one as it arrives, instead of holding on to
+            // the received buffers until the whole message is there.
+            state->mLargeMessage = System::PacketBufferHandle::NewLarge(messageSize);
+            VerifyOrReturnError(!state->mLargeMessage.IsNull(), CHIP_ERROR_NO_MEMORY);
+            state->mLargeMessageRemaining = messageSize;
+            state->mReceived.Consume(kPacketSizeBytes);
+            continue;
         }
         // The subtraction will not underflow because we successfully read kPacketSizeBytes.
         if (messageSize > (state->mReceived->TotalLength() - kPacketSizeBytes))
@@ -325,18 +511,36 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TCPBase::OnTcpReceive(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle && buffer)
+CHIP_ERROR TCPBase::ContinueLargeMessage(const PeerAddress & peerAddress, ActiveConnectionState * state)
 {
-    Inet::IPAddress ipAddress;
-    uint16_t port;
-    Inet::InterfaceId interfaceId;
+    System::PacketBufferHandle & message = state->mLargeMessage;
+    uint16_t length = static_cast<uint16_t>(std::min<size_t>(state->mLargeMessageRemaining, state->mReceived->TotalLength()));
 
-    endPoint->GetPeerInfo(&ipAddress, &port);
-    endPoint->GetInterfaceId(&interfaceId);
-    PeerAddress peerAddress = PeerAddress::TCP(ipAddress, port, interfaceId);
+    CHIP_ERROR err = state->mReceived->Read(message->Start() + message->DataLength(), length);
+    state->mReceived.Consume(length);
+    ReturnErrorOnFailure(err);
 
-    TCPBase * tcp  = reinterpret_cast<TCPBase *>(endPoint->mAppState);
-    CHIP_ERROR err = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
+    message->SetDataLength(static_cast<uint16_t>(message->DataLength() + length));
+    state->mLargeMessageRemaining = static_cast<uint16_t>(state->mLargeMessageRemaining - length);
+
+    if (state->mLargeMessageRemaining == 0)
+    {
+        // Take the message out of the connection state first: the handler does not necessarily take ownership.
+        System::PacketBufferHandle complete = std::move(message);
+        HandleMessageReceived(peerAddress, std::move(complete));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TCPBase::OnTcpReceive(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle && buffer)
+{
+    TCPBase * tcp                 = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    ActiveConnectionState * state = tcp->FindActiveConnection(endPoint);
+    VerifyOrReturnError(state != nullptr, CHIP_ERROR_UNEXPECTED_EVENT);
+
+    // Copy the cached peer address: the connection may be released while the message is processed.
+    PeerAddress peerAddress = state->mPeerAddress;
+    CHIP_ERROR err          = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
 
     if (err != CHIP_NO_ERROR)
     {
@@ -398,20 +602,9 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
     }
     else
     {
-        bool connectionStored = false;
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                connectionStored = true;
-                break;
-            }
-        }
-
         // since we track end points counts, we always expect to store the
         // connection.
-        if (!connectionStored)
+        if (tcp->AddActiveConnection(endPoint, addr) == nullptr)
         {
             endPoint->Free();
             ChipLogError(Inet, "Internal logic error: insufficient space to store active connection");
@@ -425,14 +618,11 @@ void TCPBase::OnConnectionClosed(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
 
     ChipLogProgress(Inet, "Connection closed.");
 
-    for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
+    ActiveConnectionState * state = tcp->FindActiveConnection(endPoint);
+    if (state != nullptr)
     {
-        if (tcp->mActiveConnections[i].mEndPoint == endPoint)
-        {
-            ChipLogProgress(Inet, "Freeing closed connection.");
-            tcp->mActiveConnections[i].Free();
-            tcp->mUsedEndPointCount--;
-        }
+        ChipLogProgress(Inet, "Freeing closed connection.");
+        tcp->ReleaseActiveConnection(state);
     }
 }
 
@@ -441,17 +631,19 @@ void TCPBase::OnConnectionReceived(Inet::TCPEndPoint * listenEndPoint, Inet::TCP
 {
     TCPBase * tcp = reinterpret_cast<TCPBase *>(listenEndPoint->mAppState);
 
+    if (tcp->mUsedEndPointCount >= tcp->mActiveConnectionsSize)
+    {
+        // Idle connections are only kept around while nothing else needs their slot.
+        tcp->EvictIdleConnection();
+    }
+
     if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
     {
         // have space to use one more (even if considering pending connections)
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                break;
-            }
-        }
+        Inet::InterfaceId interfaceId;
+        endPoint->GetInterfaceId(&interfaceId);
+        tcp->AddActiveConnection(endPoint, PeerAddress::TCP(peerAddress, peerPort, interfaceId));
+        tcp->mUsedEndPointCount++;
 
         endPoint->mAppState            = listenEndPoint->mAppState;
         endPoint->OnDataReceived       = OnTcpReceive;
@@ -475,41 +667,39 @@ void TCPBase::OnAcceptError(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
 
 void TCPBase::Disconnect(const PeerAddress & address)
 {
-    // Closes an existing connection
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    // Closes an existing connection, or keeps it around for reuse if idle connections are pooled
+    ActiveConnectionState * state = FindActiveConnection(address);
+    if (state == nullptr || !(state->mPeerAddress == address))
     {
-        if (mActiveConnections[i].InUse())
-        {
-            Inet::IPAddress ipAddress;
-            uint16_t port;
-            Inet::InterfaceId interfaceId;
+        return;
+    }
 
-            mActiveConnections[i].mEndPoint->GetPeerInfo(&ipAddress, &port);
-            mActiveConnections[i].mEndPoint->GetInterfaceId(&interfaceId);
-            if (address == PeerAddress::TCP(ipAddress, port, interfaceId))
-            {
-                // NOTE: this leaves the socket in TIME_WAIT.
-                // Calling Abort() would clean it since SO_LINGER would be set to 0,
-                // however this seems not to be useful.
-                mActiveConnections[i].Free();
-                mUsedEndPointCount--;
-            }
+    if (mIdleConnectionTimeout > System::Clock::kZero)
+    {
+        if (!state->mIdle)
+        {
+            state->mIdle      = true;
+            state->mIdleSince = System::SystemClock().GetMonotonicTimestamp();
+            ScheduleIdleConnectionTimer();
         }
+        return;
     }
+
+    // NOTE: this leaves the socket in TIME_WAIT.
+    // Calling Abort() would clean it since SO_LINGER would be set to 0,
+    // however this seems not to be useful.
+    ReleaseActiveConnection(state);
 }
 
 void TCPBase::OnPeerClosed(Inet::TCPEndPoint * endPoint)
 {
     TCPBase * tcp = reinterpret_cast<TCPBase *>(endPoint->mAppState);
 
-    for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
+    ActiveConnectionState * state = tcp->FindActiveConnection(endPoint);
+    if (state != nullptr)
     {
-        if (tcp->mActiveConnections[i].mEndPoint == endPoint)
-        {
-            ChipLogProgress(Inet, "Freeing connection: connection closed by peer");
-            tcp->mActiveConnections[i].Free();
-            tcp->mUsedEndPointCount--;
-        }
+        ChipLogProgress(Inet, "Freeing connection: connection closed by peer");
+        tcp->ReleaseActiveConnection(state);
     }
 }
 
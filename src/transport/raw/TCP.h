@@ -34,6 +34,8 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/PoolWrapper.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
 #include <transport/raw/Base.h>
 
 namespace chip {
@@ -73,11 +75,20 @@ public:
         return *this;
     }
 
+    System::Clock::Timeout GetIdleConnectionTimeout() const { return mIdleConnectionTimeout; }
+    TcpListenParameters & SetIdleConnectionTimeout(System::Clock::Timeout timeout)
+    {
+        mIdleConnectionTimeout = timeout;
+
+        return *this;
+    }
+
 private:
-    Inet::EndPointManager<Inet::TCPEndPoint> * mEndPointManager;   ///< Associated endpoint factory
-    Inet::IPAddressType mAddressType = Inet::IPAddressType::kIPv6; ///< type of listening socket
-    uint16_t mListenPort             = CHIP_PORT;                  ///< TCP listen port
-    Inet::InterfaceId mInterfaceId   = Inet::InterfaceId::Null();  ///< Interface to listen on
+    Inet::EndPointManager<Inet::TCPEndPoint> * mEndPointManager;                ///< Associated endpoint factory
+    Inet::IPAddressType mAddressType              = Inet::IPAddressType::kIPv6; ///< type of listening socket
+    uint16_t mListenPort                          = CHIP_PORT;                  ///< TCP listen port
+    Inet::InterfaceId mInterfaceId                = Inet::InterfaceId::Null();  ///< Interface to listen on
+    System::Clock::Timeout mIdleConnectionTimeout = System::Clock::kZero;       ///< How long disconnected peers are kept for reuse
 };
 
 /**
@@ -111,33 +122,58 @@ protected:
      */
     struct ActiveConnectionState
     {
-        void Init(Inet::TCPEndPoint * endPoint)
+        void Init(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress)
         {
-            mEndPoint = endPoint;
-            mReceived = nullptr;
+            mEndPoint              = endPoint;
+            mPeerAddress           = peerAddress;
+            mReceived              = nullptr;
+            mLargeMessage          = nullptr;
+            mLargeMessageRemaining = 0;
+            mIdle                  = false;
+            mIdleSince             = System::Clock::kZero;
         }
 
         void Free()
         {
             mEndPoint->Free();
-            mEndPoint = nullptr;
-            mReceived = nullptr;
+            mEndPoint     = nullptr;
+            mReceived     = nullptr;
+            mLargeMessage = nullptr;
         }
         bool InUse() const { return mEndPoint != nullptr; }
 
         // Associated endpoint.
         Inet::TCPEndPoint * mEndPoint;
 
+        // Address of the peer, cached so that lookups do not need to query the endpoint.
+        PeerAddress mPeerAddress;
+
         // Buffers received but not yet consumed.
         System::PacketBufferHandle mReceived;
+
+        // Message too large for a regular packet buffer, filled in as its data is received.
+        System::PacketBufferHandle mLargeMessage;
+        uint16_t mLargeMessageRemaining;
+
+        // Set when the connection was disconnected by the upper layers but is kept open for reuse.
+        bool mIdle;
+        System::Clock::Timestamp mIdleSince;
     };
 
+    // Marks an unused entry of the connection index tables.
+    static constexpr uint16_t kEmptyIndexEntry = UINT16_MAX;
+
 public:
     using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
-    TCPBase(ActiveConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
-        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
+    TCPBase(ActiveConnectionState * activeConnectionsBuffer, size_t bufferSize, uint16_t * connectionIndexBuffer,
+            size_t connectionIndexSize, PendingPacketPoolType & packetBuffers) :
+        mActiveConnections(activeConnectionsBuffer),
+        mActiveConnectionsSize(bufferSize), mConnectionIndex(connectionIndexBuffer), mConnectionIndexSize(connectionIndexSize),
+        mPendingPackets(packetBuffers)
     {
         // activeConnectionsBuffer must be initialized by the caller.
+        // connectionIndexBuffer holds two tables (by peer address, then by endpoint) of connectionIndexSize entries each,
+        // connectionIndexSize being a power of two larger than bufferSize. It is initialized by Init().
     }
     ~TCPBase() override;
 
@@ -190,6 +226,46 @@ private:
     ActiveConnectionState * FindActiveConnection(const PeerAddress & addr);
     ActiveConnectionState * FindActiveConnection(const Inet::TCPEndPoint * endPoint);
 
+    /**
+     * Store a newly established connection and add it to the connection index.
+     *
+     * @return the stored connection, or nullptr if no connection slot is free.
+     */
+    ActiveConnectionState * AddActiveConnection(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress);
+
+    /**
+     * Close the given connection and remove it from the connection index.
+     */
+    void ReleaseActiveConnection(ActiveConnectionState * state);
+
+    /**
+     * Close the idle connection that has been unused for the longest time.
+     *
+     * @return true if a connection slot was freed.
+     */
+    bool EvictIdleConnection();
+
+    /**
+     * Start the idle connection timer, if there are idle connections, to fire when the oldest one expires.
+     */
+    void ScheduleIdleConnectionTimer();
+    static void OnIdleConnectionTimer(System::Layer * systemLayer, void * appState);
+
+    // Connection index: open addressing hash tables mapping peer addresses and endpoints to connection slots.
+    static size_t HashPeer(const Inet::IPAddress & address, uint16_t port);
+    static size_t HashEndPoint(const Inet::TCPEndPoint * endPoint);
+    uint16_t * PeerIndex() { return mConnectionIndex; }
+    uint16_t * EndPointIndex() { return mConnectionIndex + mConnectionIndexSize; }
+    void ClearConnectionIndex();
+    void AddToConnectionIndex(size_t slot);
+    void RebuildConnectionIndex();
+
+    /**
+     * Copy received data into the large message being reassembled for the given connection, and deliver the
+     * message once complete.
+     */
+    CHIP_ERROR ContinueLargeMessage(const PeerAddress & peerAddress, ActiveConnectionState * state);
+
     /**
      * Sends the specified message once a connection has been established.
      *
@@ -253,6 +329,10 @@ private:
     Inet::TCPEndPoint * mListenSocket = nullptr;                       ///< TCP socket used by the transport
     Inet::IPAddressType mEndpointType = Inet::IPAddressType::kUnknown; ///< Socket listening type
     State mState                      = State::kNotReady;              ///< State of the TCP transport
+    System::Layer * mSystemLayer      = nullptr;                       ///< System layer used for the idle connection timer
+
+    // How long connections released by Disconnect() are kept open for reuse. Zero closes them immediately.
+    System::Clock::Timeout mIdleConnectionTimeout = System::Clock::kZero;
 
     // Number of active and 'pending connection' endpoints
     size_t mUsedEndPointCount = 0;
@@ -261,6 +341,10 @@ private:
     ActiveConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
 
+    // Hash index over mActiveConnections
+    uint16_t * mConnectionIndex;
+    const size_t mConnectionIndexSize;
+
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
 };
@@ -269,18 +353,29 @@ template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
 class TCP : public TCPBase
 {
 public:
-    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mPendingPackets)
+    TCP() :
+        TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mConnectionIndexBuffer, kConnectionIndexSize, mPendingPackets)
     {
         for (size_t i = 0; i < kActiveConnectionsSize; ++i)
         {
-            mConnectionsBuffer[i].Init(nullptr);
+            mConnectionsBuffer[i].Init(nullptr, PeerAddress());
         }
     }
     ~TCP() override { mPendingPackets.ReleaseAll(); }
 
 private:
     friend class TCPTest;
+
+    static constexpr size_t ConnectionIndexSize(size_t size = 1)
+    {
+        // Smallest power of two leaving the index at most half full.
+        return (size >= 2 * kActiveConnectionsSize) ? size : ConnectionIndexSize(size * 2);
+    }
+    static constexpr size_t kConnectionIndexSize = ConnectionIndexSize();
+    static_assert(kActiveConnectionsSize < kEmptyIndexEntry, "Too many active connections for the connection index");
+
     TCPBase::ActiveConnectionState mConnectionsBuffer[kActiveConnectionsSize];
+    uint16_t mConnectionIndexBuffer[2 * kConnectionIndexSize];
     PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
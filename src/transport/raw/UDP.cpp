@@ -60,6 +60,16 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     err = mUDPEndPoint->Listen(OnUdpReceive, OnUdpError, this);
     SuccessOrExit(err);
 
+    if (params.GetSendBatching())
+    {
+        // Not fatal: messages are then sent immediately.
+        CHIP_ERROR batchingErr = mUDPEndPoint->SetSendBatching(true);
+        if (batchingErr != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(Inet, "UDP send batching unavailable: %" CHIP_ERROR_FORMAT, batchingErr.Format());
+        }
+    }
+
     mUDPEndpointType = params.GetAddressType();
 
     mState = State::kInitialized;
@@ -117,6 +127,14 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
+CHIP_ERROR UDP::FlushPendingSends()
+{
+    VerifyOrReturnError(mState == State::kInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mUDPEndPoint != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    return mUDPEndPoint->FlushPendingSends();
+}
+
 void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
 {
     CHIP_ERROR err          = CHIP_NO_ERROR;
@@ -75,6 +75,18 @@ public:
         return *this;
     }
 
+    /**
+     * Queue outgoing messages, and send them together at the end of the current event loop iteration (or when
+     * UDP::FlushPendingSends is called), where the endpoint supports it.
+     */
+    bool GetSendBatching() const { return mSendBatching; }
+    UdpListenParameters & SetSendBatching(bool sendBatching)
+    {
+        mSendBatching = sendBatching;
+
+        return *this;
+    }
+
     /**
      * Networking Stack Native parameter (optional)
      */
@@ -92,6 +104,7 @@ private:
     uint16_t mListenPort             = CHIP_PORT;                  ///< UDP listen port
     Inet::InterfaceId mInterfaceId   = Inet::InterfaceId::Null();  ///< Interface to listen on
     void * mNativeParams             = nullptr;
+    bool mSendBatching               = false; ///< Queue outgoing messages and send them in batches
 };
 
 /** Implements a transport using UDP. */
@@ -131,6 +144,14 @@ public:
 
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
 
+    /**
+     * Send the messages queued by SendMessage when send batching is enabled.
+     *
+     * Queued messages are otherwise sent at the end of the current event loop iteration; callers sending a burst
+     * of messages may flush them as soon as the burst is complete.
+     */
+    CHIP_ERROR FlushPendingSends();
+
     CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override;
 
     bool CanListenMulticast() override
@@ -37,7 +37,9 @@
 #include <nlbyteorder.h>
 #include <nlunit-test.h>
 
+#include <algorithm>
 #include <errno.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include <utility>
@@ -53,6 +55,11 @@ namespace Transport {
 class TCPTest
 {
 public:
+    static Inet::TCPEndPoint * GetConnectionEndPoint(TCPBase & tcp, const PeerAddress & peerAddress)
+    {
+        TCPBase::ActiveConnectionState * state = tcp.FindActiveConnection(peerAddress);
+        return (state != nullptr) ? state->mEndPoint : nullptr;
+    }
     static void CheckProcessReceivedBuffer(nlTestSuite * inSuite, void * inContext);
 };
 } // namespace Transport
@@ -105,9 +112,13 @@ public:
         mReceiveHandlerCallCount++;
     }
 
-    void InitializeMessageTest(TCPImpl & tcp, const IPAddress & addr)
+    void InitializeMessageTest(TCPImpl & tcp, const IPAddress & addr,
+                               System::Clock::Timeout idleConnectionTimeout = System::Clock::kZero)
     {
-        CHIP_ERROR err = tcp.Init(Transport::TcpListenParameters(mContext.GetTCPEndPointManager()).SetAddressType(addr.Type()));
+        auto params = Transport::TcpListenParameters(mContext.GetTCPEndPointManager())
+                          .SetAddressType(addr.Type())
+                          .SetIdleConnectionTimeout(idleConnectionTimeout);
+        CHIP_ERROR err = tcp.Init(params);
 
         // retry a few times in case the port is somehow in use.
         // this is a WORKAROUND for flaky testing if we run tests very fast after each other.
@@ -126,7 +137,7 @@ public:
         {
             ChipLogProgress(NotSpecified, "RETRYING tcp initialization");
             chip::test_utils::SleepMillis(100);
-            err = tcp.Init(Transport::TcpListenParameters(mContext.GetTCPEndPointManager()).SetAddressType(addr.Type()));
+            err = tcp.Init(params);
         }
 
         NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
@@ -152,7 +163,8 @@ public:
         NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
 
         // Should be able to send a message to itself by just calling send.
-        err = tcp.SendMessage(Transport::PeerAddress::TCP(addr), std::move(buffer));
+        mReceiveHandlerCallCount = 0;
+        err                      = tcp.SendMessage(Transport::PeerAddress::TCP(addr), std::move(buffer));
         NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
 
         mContext.DriveIOUntil(chip::System::Clock::Seconds16(5), [this]() { return mReceiveHandlerCallCount != 0; });
@@ -161,6 +173,50 @@ public:
         SetCallback(nullptr);
     }
 
+    void ThroughputTest(TCPImpl & tcp, const IPAddress & addr, int messageCount, uint16_t payloadSize)
+    {
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+        mReceiveHandlerCallCount = 0;
+
+        System::Clock::Timestamp start = System::SystemClock().GetMonotonicTimestamp();
+        for (int sent = 0; sent < messageCount;)
+        {
+            // Send in bursts, so that the end point send queue stays within the size of a packet buffer chain.
+            int burstEnd = std::min(sent + kThroughputBurstSize, messageCount);
+            for (; sent < burstEnd; sent++)
+            {
+                chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(payloadSize);
+                NL_TEST_ASSERT(mSuite, !buffer.IsNull());
+                memset(buffer->Start(), static_cast<int>(sent), payloadSize);
+                buffer->SetDataLength(payloadSize);
+                NL_TEST_ASSERT(mSuite, header.EncodeBeforeData(buffer) == CHIP_NO_ERROR);
+
+                // Messages sent before the connection is up, or while the socket is busy, are queued and written together.
+                CHIP_ERROR err = tcp.SendMessage(Transport::PeerAddress::TCP(addr), std::move(buffer));
+                NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
+            }
+
+            mContext.DriveIOUntil(chip::System::Clock::Seconds16(10), [this, sent]() { return mReceiveHandlerCallCount == sent; });
+            if (mReceiveHandlerCallCount != sent)
+            {
+                break;
+            }
+        }
+
+        NL_TEST_ASSERT(mSuite, mReceiveHandlerCallCount == messageCount);
+
+        System::Clock::Milliseconds64 elapsed =
+            std::chrono::duration_cast<System::Clock::Milliseconds64>(System::SystemClock().GetMonotonicTimestamp() - start);
+        uint64_t elapsedMs = std::max<uint64_t>(elapsed.count(), 1);
+        ChipLogProgress(NotSpecified,
+                        "TCP loopback: %d messages of %u bytes in %" PRIu64 " ms (%" PRIu64 " messages/s, %" PRIu64 " KiB/s)",
+                        messageCount, static_cast<unsigned>(payloadSize), elapsedMs,
+                        static_cast<uint64_t>(messageCount) * 1000 / elapsedMs,
+                        static_cast<uint64_t>(messageCount) * payloadSize * 1000 / 1024 / elapsedMs);
+    }
+
     void FinalizeMessageTest(TCPImpl & tcp, const IPAddress & addr)
     {
         // Disconnect and wait for seeing peer close
@@ -170,6 +226,8 @@ public:
 
     int mReceiveHandlerCallCount = 0;
 
+    static constexpr int kThroughputBurstSize = 32;
+
 private:
     nlTestSuite * mSuite;
     TestContext & mContext;
@@ -232,6 +290,53 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+void CheckIdleConnectionReuse(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, System::Clock::Milliseconds32(500));
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+
+    Transport::PeerAddress peerAddress = Transport::PeerAddress::TCP(addr);
+    Inet::TCPEndPoint * endPoint       = Transport::TCPTest::GetConnectionEndPoint(tcp, peerAddress);
+    NL_TEST_ASSERT(inSuite, endPoint != nullptr);
+
+    // The connection is kept open after being disconnected, and reused by the next message to the same peer.
+    tcp.Disconnect(peerAddress);
+    NL_TEST_ASSERT(inSuite, Transport::TCPTest::GetConnectionEndPoint(tcp, peerAddress) == endPoint);
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+    NL_TEST_ASSERT(inSuite, Transport::TCPTest::GetConnectionEndPoint(tcp, peerAddress) == endPoint);
+
+    // Once idle for long enough, the connection is closed. The peer closes its end in turn.
+    tcp.Disconnect(peerAddress);
+    ctx.DriveIOUntil(chip::System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    NL_TEST_ASSERT(inSuite, !tcp.HasActiveConnections());
+}
+
+void CheckLoopbackThroughput(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // The first burst of messages is queued while the connection is being established.
+    gMockTransportMgrDelegate.ThroughputTest(tcp, addr, 200, 1000);
+    // Messages sent over the established connection.
+    gMockTransportMgrDelegate.ThroughputTest(tcp, addr, 2000, 1000);
+
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+}
+
 // Generates a packet buffer or a chain of packet buffers for a single message.
 struct TestData
 {
@@ -440,13 +545,34 @@ void chip::Transport::TCPTest::CheckProcessReceivedBuffer(nlTestSuite * inSuite,
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 2);
 
-    // Test a message that is too large to coalesce into a single packet buffer.
+    // Test a message that is too large to coalesce into a single packet buffer. When large packet buffers are
+    // available, it is reassembled as its buffers arrive; otherwise, the first buffer is enough to trigger an error.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
-    gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, &testData[1]);
     NL_TEST_ASSERT(inSuite, testData[0].Init((const uint16_t[]){ 51, System::PacketBuffer::kMaxSizeWithoutReserve, 0 }));
-    // Sending only the first buffer of the long chain. This should be enough to trigger the error.
     System::PacketBufferHandle head = testData[0].mHandle.PopHead();
     err                             = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(head));
+    if (System::PacketBuffer::kLargeBufMaxSizeWithoutReserve > System::PacketBuffer::kMaxSizeWithoutReserve)
+    {
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 0);
+        err = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(testData[0].mHandle));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 1);
+    }
+    else
+    {
+        NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_MESSAGE_TOO_LONG);
+        NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 0);
+    }
+
+    // Test a message that is too large even for a large packet buffer.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, &testData[1]);
+    head = System::PacketBufferHandle::New(kPacketSizeBytes, 0 /* reserve */);
+    NL_TEST_ASSERT(inSuite, !head.IsNull());
+    chip::Encoding::LittleEndian::Put16(head->Start(), UINT16_MAX);
+    head->SetDataLength(kPacketSizeBytes);
+    err = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(head));
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_MESSAGE_TOO_LONG);
     NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 0);
 
@@ -468,6 +594,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Init Test IPV6",        CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",       CheckMessageTest6),
     NL_TEST_DEF("ProcessReceivedBuffer Test",   chip::Transport::TCPTest::CheckProcessReceivedBuffer),
+    NL_TEST_DEF("Idle Connection Reuse Test",   CheckIdleConnectionReuse),
+    NL_TEST_DEF("Loopback Throughput Test",     CheckLoopbackThroughput),
 
     NL_TEST_SENTINEL()
 };
@@ -18,6 +18,7 @@
 // THIS FILE IS GENERATED BY ZAP
 
 #include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/StructEncoder.h>
 
 namespace chip {
 namespace app {
@@ -29,12 +30,7 @@ namespace Structs {
 namespace LabelStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLabel)), label));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLabel, label, Fields::kValue, value);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -79,11 +75,7 @@ namespace Commands {
 namespace Identify {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIdentifyTime)), identifyTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIdentifyTime, identifyTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -116,12 +108,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TriggerEffect {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEffectIdentifier)), effectIdentifier));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEffectVariant)), effectVariant));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kEffectIdentifier, effectIdentifier, Fields::kEffectVariant, effectVariant);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -200,12 +187,7 @@ namespace Commands {
 namespace AddGroup {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kGroupName, groupName);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -241,12 +223,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddGroupResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -282,11 +259,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ViewGroup {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -319,13 +292,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ViewGroupResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kGroupName, groupName);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -364,11 +331,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetGroupMembership {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupList)), groupList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupList, groupList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -401,12 +364,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetGroupMembershipResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCapacity)), capacity));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupList)), groupList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCapacity, capacity, Fields::kGroupList, groupList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -442,11 +400,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveGroup {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -479,12 +433,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveGroupResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -520,10 +469,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveAllGroups {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -553,12 +499,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddGroupIfIdentifying {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupName)), groupName));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kGroupName, groupName);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -633,12 +574,7 @@ namespace Structs {
 namespace AttributeValuePair {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttributeId)), attributeId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttributeValue)), attributeValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kAttributeId, attributeId, Fields::kAttributeValue, attributeValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -677,13 +613,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ExtensionFieldSet {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kClusterId)), clusterId));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttributeValueList)), attributeValueList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kClusterId, clusterId, Fields::kAttributeValueList, attributeValueList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -725,16 +655,8 @@ namespace Commands {
 namespace AddScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId, Fields::kTransitionTime,
+                                   transitionTime, Fields::kSceneName, sceneName, Fields::kExtensionFieldSets, extensionFieldSets);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -779,13 +701,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddSceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -824,12 +740,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ViewScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -865,17 +776,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ViewSceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kSceneId, sceneId,
+                                   Fields::kTransitionTime, transitionTime, Fields::kSceneName, sceneName,
+                                   Fields::kExtensionFieldSets, extensionFieldSets);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -923,12 +826,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -964,13 +862,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveSceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1009,11 +901,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveAllScenes {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1046,12 +934,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveAllScenesResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1087,12 +970,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StoreScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1128,13 +1006,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StoreSceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1173,13 +1045,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RecallScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId, Fields::kTransitionTime,
+                                   transitionTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1218,11 +1085,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetSceneMembership {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1255,14 +1118,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetSceneMembershipResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCapacity)), capacity));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneList)), sceneList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kCapacity, capacity, Fields::kGroupId, groupId,
+                                   Fields::kSceneList, sceneList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1304,16 +1161,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedAddScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId, Fields::kTransitionTime,
+                                   transitionTime, Fields::kSceneName, sceneName, Fields::kExtensionFieldSets, extensionFieldSets);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1358,13 +1207,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedAddSceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1403,12 +1246,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedViewScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupId, groupId, Fields::kSceneId, sceneId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1444,17 +1282,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedViewSceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupId)), groupId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneId)), sceneId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneName)), sceneName));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtensionFieldSets)), extensionFieldSets));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupId, groupId, Fields::kSceneId, sceneId,
+                                   Fields::kTransitionTime, transitionTime, Fields::kSceneName, sceneName,
+                                   Fields::kExtensionFieldSets, extensionFieldSets);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1502,15 +1332,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CopyScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMode)), mode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupIdFrom)), groupIdFrom));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneIdFrom)), sceneIdFrom));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupIdTo)), groupIdTo));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneIdTo)), sceneIdTo));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMode, mode, Fields::kGroupIdFrom, groupIdFrom, Fields::kSceneIdFrom,
+                                   sceneIdFrom, Fields::kGroupIdTo, groupIdTo, Fields::kSceneIdTo, sceneIdTo);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1555,13 +1378,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CopySceneResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupIdFrom)), groupIdFrom));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSceneIdFrom)), sceneIdFrom));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kGroupIdFrom, groupIdFrom, Fields::kSceneIdFrom,
+                                   sceneIdFrom);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1655,10 +1473,7 @@ namespace Commands {
 namespace Off {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1688,10 +1503,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace On {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1721,10 +1533,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Toggle {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1754,12 +1563,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace OffWithEffect {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEffectId)), effectId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEffectVariant)), effectVariant));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kEffectId, effectId, Fields::kEffectVariant, effectVariant);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1795,10 +1599,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace OnWithRecallGlobalScene {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1828,13 +1629,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace OnWithTimedOff {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOnOffControl)), onOffControl));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOnTime)), onTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOffWaitTime)), offWaitTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOnOffControl, onOffControl, Fields::kOnTime, onTime, Fields::kOffWaitTime,
+                                   offWaitTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -1968,14 +1764,8 @@ namespace Commands {
 namespace MoveToLevel {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLevel)), level));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLevel, level, Fields::kTransitionTime, transitionTime,
+                                   Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2017,14 +1807,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Move {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRate)), rate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMoveMode, moveMode, Fields::kRate, rate, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2066,15 +1850,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Step {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepMode, stepMode, Fields::kStepSize, stepSize, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2119,12 +1896,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Stop {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2160,14 +1932,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveToLevelWithOnOff {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLevel)), level));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLevel, level, Fields::kTransitionTime, transitionTime,
+                                   Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2209,14 +1975,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveWithOnOff {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRate)), rate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMoveMode, moveMode, Fields::kRate, rate, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2258,15 +2018,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StepWithOnOff {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepMode, stepMode, Fields::kStepSize, stepSize, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2311,12 +2064,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StopWithOnOff {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2352,11 +2100,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveToClosestFrequency {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFrequency)), frequency));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kFrequency, frequency);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2568,12 +2312,7 @@ namespace Structs {
 namespace DeviceTypeStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRevision)), revision));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kType, type, Fields::kRevision, revision);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -2774,13 +2513,8 @@ namespace Structs {
 namespace Target {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCluster)), cluster));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDeviceType)), deviceType));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCluster, cluster, Fields::kEndpoint, endpoint, Fields::kDeviceType,
+                                   deviceType);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3127,21 +2861,14 @@ namespace Structs {
 namespace ActionStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndpointListID)), endpointListID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSupportedCommands)), supportedCommands));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kState)), state));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
-}
-
-CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
-{
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kName, name, Fields::kType, type,
+                                   Fields::kEndpointListID, endpointListID, Fields::kSupportedCommands, supportedCommands,
+                                   Fields::kState, state);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVType outer;
     VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
     err = reader.EnterContainer(outer);
@@ -3187,14 +2914,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EndpointListStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndpointListID)), endpointListID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndpoints)), endpoints));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kEndpointListID, endpointListID, Fields::kName, name, Fields::kType, type,
+                                   Fields::kEndpoints, endpoints);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3242,12 +2963,7 @@ namespace Commands {
 namespace InstantAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3283,13 +2999,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace InstantActionWithTransition {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID, Fields::kTransitionTime,
+                                   transitionTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3328,12 +3039,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StartAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3369,13 +3075,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StartActionWithDuration {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDuration)), duration));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID, Fields::kDuration,
+                                   duration);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3414,12 +3115,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StopAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3455,12 +3151,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace PauseAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3496,13 +3187,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace PauseActionWithDuration {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDuration)), duration));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID, Fields::kDuration,
+                                   duration);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3541,12 +3227,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ResumeAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3582,12 +3263,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnableAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3623,13 +3299,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnableActionWithDuration {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDuration)), duration));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID, Fields::kDuration,
+                                   duration);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3668,12 +3339,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace DisableAction {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3709,13 +3375,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace DisableActionWithDuration {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActionID)), actionID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInvokeID)), invokeID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDuration)), duration));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActionID, actionID, Fields::kInvokeID, invokeID, Fields::kDuration,
+                                   duration);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3893,14 +3554,8 @@ namespace Structs {
 namespace CapabilityMinimaStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCaseSessionsPerFabric)), caseSessionsPerFabric));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSubscriptionsPerFabric)), subscriptionsPerFabric));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCaseSessionsPerFabric, caseSessionsPerFabric,
+                                   Fields::kSubscriptionsPerFabric, subscriptionsPerFabric);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -3942,10 +3597,7 @@ namespace Commands {
 namespace MfgSpecificPing {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4216,21 +3868,11 @@ namespace Commands {
 namespace QueryImage {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kVendorId)), vendorId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProductId)), productId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProtocolsSupported)), protocolsSupported));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHardwareVersion)), hardwareVersion));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocation)), location));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRequestorCanConsent)), requestorCanConsent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMetadataForProvider)), metadataForProvider));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kVendorId, vendorId, Fields::kProductId, productId,
+                                   Fields::kSoftwareVersion, softwareVersion, Fields::kProtocolsSupported, protocolsSupported,
+                                   Fields::kHardwareVersion, hardwareVersion, Fields::kLocation, location,
+                                   Fields::kRequestorCanConsent, requestorCanConsent, Fields::kMetadataForProvider,
+                                   metadataForProvider);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4284,20 +3926,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace QueryImageResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDelayedActionTime)), delayedActionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kImageURI)), imageURI));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSoftwareVersionString)), softwareVersionString));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUpdateToken)), updateToken));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserConsentNeeded)), userConsentNeeded));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMetadataForRequestor)), metadataForRequestor));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kDelayedActionTime, delayedActionTime,
+                                   Fields::kImageURI, imageURI, Fields::kSoftwareVersion, softwareVersion,
+                                   Fields::kSoftwareVersionString, softwareVersionString, Fields::kUpdateToken, updateToken,
+                                   Fields::kUserConsentNeeded, userConsentNeeded, Fields::kMetadataForRequestor,
+                                   metadataForRequestor);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4351,12 +3984,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ApplyUpdateRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUpdateToken)), updateToken));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNewVersion)), newVersion));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUpdateToken, updateToken, Fields::kNewVersion, newVersion);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4392,12 +4020,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ApplyUpdateResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAction)), action));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDelayedActionTime)), delayedActionTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kAction, action, Fields::kDelayedActionTime, delayedActionTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4433,12 +4056,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NotifyUpdateApplied {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUpdateToken)), updateToken));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSoftwareVersion)), softwareVersion));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUpdateToken, updateToken, Fields::kSoftwareVersion, softwareVersion);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4574,16 +4192,9 @@ namespace Commands {
 namespace AnnounceOtaProvider {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProviderNodeId)), providerNodeId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kVendorId)), vendorId));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAnnouncementReason)), announcementReason));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMetadataForNode)), metadataForNode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kProviderNodeId, providerNodeId, Fields::kVendorId, vendorId,
+                                   Fields::kAnnouncementReason, announcementReason, Fields::kMetadataForNode, metadataForNode,
+                                   Fields::kEndpoint, endpoint);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -4985,12 +4596,7 @@ namespace Structs {
 namespace BatChargeFaultChangeType {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCurrent)), current));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPrevious)), previous));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCurrent, current, Fields::kPrevious, previous);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5029,12 +4635,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace BatFaultChangeType {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCurrent)), current));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPrevious)), previous));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCurrent, current, Fields::kPrevious, previous);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5073,12 +4674,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace WiredFaultChangeType {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCurrent)), current));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPrevious)), previous));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCurrent, current, Fields::kPrevious, previous);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5249,14 +4845,8 @@ namespace Structs {
 namespace BasicCommissioningInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFailSafeExpiryLengthSeconds)),
-                                           failSafeExpiryLengthSeconds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMaxCumulativeFailsafeSeconds)),
-                                           maxCumulativeFailsafeSeconds));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kFailSafeExpiryLengthSeconds, failSafeExpiryLengthSeconds,
+                                   Fields::kMaxCumulativeFailsafeSeconds, maxCumulativeFailsafeSeconds);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5298,13 +4888,7 @@ namespace Commands {
 namespace ArmFailSafe {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExpiryLengthSeconds)), expiryLengthSeconds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kExpiryLengthSeconds, expiryLengthSeconds, Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5340,12 +4924,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ArmFailSafeResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kErrorCode)), errorCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kErrorCode, errorCode, Fields::kDebugText, debugText);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5381,14 +4960,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetRegulatoryConfig {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNewRegulatoryConfig)), newRegulatoryConfig));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCountryCode)), countryCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNewRegulatoryConfig, newRegulatoryConfig, Fields::kCountryCode,
+                                   countryCode, Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5427,12 +5000,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetRegulatoryConfigResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kErrorCode)), errorCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kErrorCode, errorCode, Fields::kDebugText, debugText);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5468,10 +5036,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CommissioningComplete {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5501,12 +5066,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CommissioningCompleteResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kErrorCode)), errorCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kErrorCode, errorCode, Fields::kDebugText, debugText);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5593,12 +5153,7 @@ namespace Structs {
 namespace NetworkInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kConnected)), connected));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkID, networkID, Fields::kConnected, connected);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5637,18 +5192,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ThreadInterfaceScanResult {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPanId)), panId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtendedPanId)), extendedPanId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkName)), networkName));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kChannel)), channel));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kVersion)), version));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtendedAddress)), extendedAddress));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRssi)), rssi));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLqi)), lqi));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kPanId, panId, Fields::kExtendedPanId, extendedPanId, Fields::kNetworkName,
+                                   networkName, Fields::kChannel, channel, Fields::kVersion, version, Fields::kExtendedAddress,
+                                   extendedAddress, Fields::kRssi, rssi, Fields::kLqi, lqi);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5705,16 +5251,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace WiFiInterfaceScanResult {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSecurity)), security));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSsid)), ssid));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBssid)), bssid));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kChannel)), channel));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWiFiBand)), wiFiBand));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRssi)), rssi));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kSecurity, security, Fields::kSsid, ssid, Fields::kBssid, bssid,
+                                   Fields::kChannel, channel, Fields::kWiFiBand, wiFiBand, Fields::kRssi, rssi);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5768,12 +5306,7 @@ namespace Commands {
 namespace ScanNetworks {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSsid)), ssid));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kSsid, ssid, Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5809,14 +5342,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ScanNetworksResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkingStatus)), networkingStatus));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWiFiScanResults)), wiFiScanResults));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kThreadScanResults)), threadScanResults));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkingStatus, networkingStatus, Fields::kDebugText, debugText,
+                                   Fields::kWiFiScanResults, wiFiScanResults, Fields::kThreadScanResults, threadScanResults);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5858,13 +5385,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddOrUpdateWiFiNetwork {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSsid)), ssid));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentials)), credentials));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kSsid, ssid, Fields::kCredentials, credentials, Fields::kBreadcrumb,
+                                   breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5903,13 +5425,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddOrUpdateThreadNetwork {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOperationalDataset)), operationalDataset));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOperationalDataset, operationalDataset, Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5945,12 +5461,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveNetwork {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkID, networkID, Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -5986,13 +5497,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NetworkConfigResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkingStatus)), networkingStatus));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkIndex)), networkIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkingStatus, networkingStatus, Fields::kDebugText, debugText,
+                                   Fields::kNetworkIndex, networkIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6031,12 +5537,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ConnectNetwork {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkID, networkID, Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6072,13 +5573,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ConnectNetworkResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkingStatus)), networkingStatus));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kErrorValue)), errorValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkingStatus, networkingStatus, Fields::kDebugText, debugText,
+                                   Fields::kErrorValue, errorValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6117,13 +5613,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ReorderNetwork {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkID)), networkID));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkIndex)), networkIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBreadcrumb)), breadcrumb));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNetworkID, networkID, Fields::kNetworkIndex, networkIndex,
+                                   Fields::kBreadcrumb, breadcrumb);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6223,14 +5714,8 @@ namespace Commands {
 namespace RetrieveLogsRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIntent)), intent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRequestedProtocol)), requestedProtocol));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransferFileDesignator)), transferFileDesignator));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIntent, intent, Fields::kRequestedProtocol, requestedProtocol,
+                                   Fields::kTransferFileDesignator, transferFileDesignator);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6269,14 +5754,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RetrieveLogsResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kContent)), content));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTimeStamp)), timeStamp));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTimeSinceBoot)), timeSinceBoot));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kContent, content, Fields::kTimeStamp, timeStamp,
+                                   Fields::kTimeSinceBoot, timeSinceBoot);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6354,20 +5833,11 @@ namespace Structs {
 namespace NetworkInterfaceType {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIsOperational)), isOperational));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOffPremiseServicesReachableIPv4)),
-                                           offPremiseServicesReachableIPv4));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOffPremiseServicesReachableIPv6)),
-                                           offPremiseServicesReachableIPv6));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHardwareAddress)), hardwareAddress));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIPv4Addresses)), IPv4Addresses));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIPv6Addresses)), IPv6Addresses));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kName, name, Fields::kIsOperational, isOperational,
+                                   Fields::kOffPremiseServicesReachableIPv4, offPremiseServicesReachableIPv4,
+                                   Fields::kOffPremiseServicesReachableIPv6, offPremiseServicesReachableIPv6,
+                                   Fields::kHardwareAddress, hardwareAddress, Fields::kIPv4Addresses, IPv4Addresses,
+                                   Fields::kIPv6Addresses, IPv6Addresses, Fields::kType, type);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6427,12 +5897,7 @@ namespace Commands {
 namespace TestEventTrigger {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEnableKey)), enableKey));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEventTrigger)), eventTrigger));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kEnableKey, enableKey, Fields::kEventTrigger, eventTrigger);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6691,15 +6156,8 @@ namespace Structs {
 namespace ThreadMetrics {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kId)), id));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStackFreeCurrent)), stackFreeCurrent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStackFreeMinimum)), stackFreeMinimum));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStackSize)), stackSize));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kId, id, Fields::kName, name, Fields::kStackFreeCurrent, stackFreeCurrent,
+                                   Fields::kStackFreeMinimum, stackFreeMinimum, Fields::kStackSize, stackSize);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6750,10 +6208,7 @@ namespace Commands {
 namespace ResetWatermarks {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6876,24 +6331,12 @@ namespace Structs {
 namespace NeighborTable {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtAddress)), extAddress));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAge)), age));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRloc16)), rloc16));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLinkFrameCounter)), linkFrameCounter));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMleFrameCounter)), mleFrameCounter));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLqi)), lqi));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAverageRssi)), averageRssi));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLastRssi)), lastRssi));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFrameErrorRate)), frameErrorRate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMessageErrorRate)), messageErrorRate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRxOnWhenIdle)), rxOnWhenIdle));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFullThreadDevice)), fullThreadDevice));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFullNetworkData)), fullNetworkData));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIsChild)), isChild));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kExtAddress, extAddress, Fields::kAge, age, Fields::kRloc16, rloc16,
+                                   Fields::kLinkFrameCounter, linkFrameCounter, Fields::kMleFrameCounter, mleFrameCounter,
+                                   Fields::kLqi, lqi, Fields::kAverageRssi, averageRssi, Fields::kLastRssi, lastRssi,
+                                   Fields::kFrameErrorRate, frameErrorRate, Fields::kMessageErrorRate, messageErrorRate,
+                                   Fields::kRxOnWhenIdle, rxOnWhenIdle, Fields::kFullThreadDevice, fullThreadDevice,
+                                   Fields::kFullNetworkData, fullNetworkData, Fields::kIsChild, isChild);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -6968,29 +6411,14 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace OperationalDatasetComponents {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kActiveTimestampPresent)), activeTimestampPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPendingTimestampPresent)), pendingTimestampPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMasterKeyPresent)), masterKeyPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNetworkNamePresent)), networkNamePresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtendedPanIdPresent)), extendedPanIdPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMeshLocalPrefixPresent)), meshLocalPrefixPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDelayPresent)), delayPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPanIdPresent)), panIdPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kChannelPresent)), channelPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPskcPresent)), pskcPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSecurityPolicyPresent)), securityPolicyPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kChannelMaskPresent)), channelMaskPresent));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kActiveTimestampPresent, activeTimestampPresent,
+                                   Fields::kPendingTimestampPresent, pendingTimestampPresent, Fields::kMasterKeyPresent,
+                                   masterKeyPresent, Fields::kNetworkNamePresent, networkNamePresent, Fields::kExtendedPanIdPresent,
+                                   extendedPanIdPresent, Fields::kMeshLocalPrefixPresent, meshLocalPrefixPresent,
+                                   Fields::kDelayPresent, delayPresent, Fields::kPanIdPresent, panIdPresent,
+                                   Fields::kChannelPresent, channelPresent, Fields::kPskcPresent, pskcPresent,
+                                   Fields::kSecurityPolicyPresent, securityPolicyPresent, Fields::kChannelMaskPresent,
+                                   channelMaskPresent);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7059,20 +6487,10 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RouteTable {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExtAddress)), extAddress));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRloc16)), rloc16));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRouterId)), routerId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNextHop)), nextHop));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPathCost)), pathCost));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLQIIn)), LQIIn));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLQIOut)), LQIOut));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAge)), age));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAllocated)), allocated));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLinkEstablished)), linkEstablished));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kExtAddress, extAddress, Fields::kRloc16, rloc16, Fields::kRouterId,
+                                   routerId, Fields::kNextHop, nextHop, Fields::kPathCost, pathCost, Fields::kLQIIn, LQIIn,
+                                   Fields::kLQIOut, LQIOut, Fields::kAge, age, Fields::kAllocated, allocated,
+                                   Fields::kLinkEstablished, linkEstablished);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7135,12 +6553,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SecurityPolicy {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRotationTime)), rotationTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFlags)), flags));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kRotationTime, rotationTime, Fields::kFlags, flags);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7182,10 +6595,7 @@ namespace Commands {
 namespace ResetCounts {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7519,10 +6929,7 @@ namespace Commands {
 namespace ResetCounts {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7744,10 +7151,7 @@ namespace Commands {
 namespace ResetCounts {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7840,13 +7244,8 @@ namespace Structs {
 namespace DstOffsetType {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOffset)), offset));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValidStarting)), validStarting));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValidUntil)), validUntil));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOffset, offset, Fields::kValidStarting, validStarting, Fields::kValidUntil,
+                                   validUntil);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7888,13 +7287,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TimeZoneType {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOffset)), offset));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValidAt)), validAt));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOffset, offset, Fields::kValidAt, validAt, Fields::kName, name);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -7939,13 +7332,8 @@ namespace Commands {
 namespace SetUtcTime {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUtcTime)), utcTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGranularity)), granularity));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTimeSource)), timeSource));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUtcTime, utcTime, Fields::kGranularity, granularity, Fields::kTimeSource,
+                                   timeSource);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -8588,16 +7976,9 @@ namespace Commands {
 namespace OpenCommissioningWindow {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCommissioningTimeout)), commissioningTimeout));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPAKEVerifier)), PAKEVerifier));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDiscriminator)), discriminator));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIterations)), iterations));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSalt)), salt));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCommissioningTimeout, commissioningTimeout, Fields::kPAKEVerifier,
+                                   PAKEVerifier, Fields::kDiscriminator, discriminator, Fields::kIterations, iterations,
+                                   Fields::kSalt, salt);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -8642,12 +8023,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace OpenBasicCommissioningWindow {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCommissioningTimeout)), commissioningTimeout));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCommissioningTimeout, commissioningTimeout);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -8680,10 +8056,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RevokeCommissioning {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -8902,11 +8275,7 @@ namespace Commands {
 namespace AttestationRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttestationNonce)), attestationNonce));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kAttestationNonce, attestationNonce);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -8939,13 +8308,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AttestationResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttestationElements)), attestationElements));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSignature)), signature));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kAttestationElements, attestationElements, Fields::kSignature, signature);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -8981,11 +8344,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CertificateChainRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCertificateType)), certificateType));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCertificateType, certificateType);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9018,11 +8377,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CertificateChainResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCertificate)), certificate));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCertificate, certificate);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9055,12 +8410,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CSRRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCSRNonce)), CSRNonce));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIsForUpdateNOC)), isForUpdateNOC));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCSRNonce, CSRNonce, Fields::kIsForUpdateNOC, isForUpdateNOC);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9096,13 +8446,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace CSRResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNOCSRElements)), NOCSRElements));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttestationSignature)), attestationSignature));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNOCSRElements, NOCSRElements, Fields::kAttestationSignature,
+                                   attestationSignature);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9138,15 +8483,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddNOC {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNOCValue)), NOCValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kICACValue)), ICACValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIPKValue)), IPKValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCaseAdminSubject)), caseAdminSubject));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAdminVendorId)), adminVendorId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNOCValue, NOCValue, Fields::kICACValue, ICACValue, Fields::kIPKValue,
+                                   IPKValue, Fields::kCaseAdminSubject, caseAdminSubject, Fields::kAdminVendorId, adminVendorId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9191,12 +8529,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace UpdateNOC {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNOCValue)), NOCValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kICACValue)), ICACValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNOCValue, NOCValue, Fields::kICACValue, ICACValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9232,13 +8565,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NOCResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatusCode)), statusCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDebugText)), debugText));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatusCode, statusCode, Fields::kFabricIndex, fabricIndex,
+                                   Fields::kDebugText, debugText);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9277,11 +8605,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace UpdateFabricLabel {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLabel)), label));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLabel, label);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9314,11 +8638,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RemoveFabric {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFabricIndex)), fabricIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kFabricIndex, fabricIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9351,11 +8671,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AddTrustedRootCertificate {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRootCertificate)), rootCertificate));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kRootCertificate, rootCertificate);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9568,19 +8884,10 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GroupKeySetStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySecurityPolicy)), groupKeySecurityPolicy));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEpochKey0)), epochKey0));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEpochStartTime0)), epochStartTime0));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEpochKey1)), epochKey1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEpochStartTime1)), epochStartTime1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEpochKey2)), epochKey2));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEpochStartTime2)), epochStartTime2));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySetID, groupKeySetID, Fields::kGroupKeySecurityPolicy,
+                                   groupKeySecurityPolicy, Fields::kEpochKey0, epochKey0, Fields::kEpochStartTime0, epochStartTime0,
+                                   Fields::kEpochKey1, epochKey1, Fields::kEpochStartTime1, epochStartTime1, Fields::kEpochKey2,
+                                   epochKey2, Fields::kEpochStartTime2, epochStartTime2);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9640,11 +8947,7 @@ namespace Commands {
 namespace KeySetWrite {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySet)), groupKeySet));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySet, groupKeySet);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9677,11 +8980,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace KeySetRead {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySetID, groupKeySetID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9714,11 +9013,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace KeySetReadResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySet)), groupKeySet));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySet, groupKeySet);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9751,11 +9046,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace KeySetRemove {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySetID)), groupKeySetID));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySetID, groupKeySetID);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9788,11 +9079,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace KeySetReadAllIndices {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySetIDs)), groupKeySetIDs));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySetIDs, groupKeySetIDs);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -9825,11 +9112,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace KeySetReadAllIndicesResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kGroupKeySetIDs)), groupKeySetIDs));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kGroupKeySetIDs, groupKeySetIDs);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10182,12 +9465,7 @@ namespace Structs {
 namespace SemanticTag {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMfgCode)), mfgCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMfgCode, mfgCode, Fields::kValue, value);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10226,13 +9504,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ModeOptionStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLabel)), label));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMode)), mode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSemanticTags)), semanticTags));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLabel, label, Fields::kMode, mode, Fields::kSemanticTags, semanticTags);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10277,11 +9549,7 @@ namespace Commands {
 namespace ChangeToMode {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNewMode)), newMode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNewMode, newMode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10368,12 +9636,7 @@ namespace Structs {
 namespace DlCredential {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentialType)), credentialType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentialIndex)), credentialIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCredentialType, credentialType, Fields::kCredentialIndex, credentialIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10415,11 +9678,7 @@ namespace Commands {
 namespace LockDoor {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPinCode)), pinCode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kPinCode, pinCode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10452,11 +9711,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace UnlockDoor {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPinCode)), pinCode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kPinCode, pinCode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10489,12 +9744,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace UnlockWithTimeout {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTimeout)), timeout));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPinCode)), pinCode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTimeout, timeout, Fields::kPinCode, pinCode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10530,17 +9780,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetWeekDaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDaysMask)), daysMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartHour)), startHour));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartMinute)), startMinute));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndHour)), endHour));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndMinute)), endMinute));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kWeekDayIndex, weekDayIndex, Fields::kUserIndex, userIndex,
+                                   Fields::kDaysMask, daysMask, Fields::kStartHour, startHour, Fields::kStartMinute, startMinute,
+                                   Fields::kEndHour, endHour, Fields::kEndMinute, endMinute);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10591,12 +9833,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetWeekDaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kWeekDayIndex, weekDayIndex, Fields::kUserIndex, userIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10632,18 +9869,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetWeekDayScheduleResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDaysMask)), daysMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartHour)), startHour));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartMinute)), startMinute));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndHour)), endHour));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndMinute)), endMinute));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kWeekDayIndex, weekDayIndex, Fields::kUserIndex, userIndex, Fields::kStatus,
+                                   status, Fields::kDaysMask, daysMask, Fields::kStartHour, startHour, Fields::kStartMinute,
+                                   startMinute, Fields::kEndHour, endHour, Fields::kEndMinute, endMinute);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10697,12 +9925,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ClearWeekDaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWeekDayIndex)), weekDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kWeekDayIndex, weekDayIndex, Fields::kUserIndex, userIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10738,14 +9961,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetYearDaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kYearDayIndex, yearDayIndex, Fields::kUserIndex, userIndex,
+                                   Fields::kLocalStartTime, localStartTime, Fields::kLocalEndTime, localEndTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10787,12 +10004,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetYearDaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kYearDayIndex, yearDayIndex, Fields::kUserIndex, userIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10828,15 +10040,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetYearDayScheduleResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kYearDayIndex, yearDayIndex, Fields::kUserIndex, userIndex, Fields::kStatus,
+                                   status, Fields::kLocalStartTime, localStartTime, Fields::kLocalEndTime, localEndTime);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10881,12 +10086,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ClearYearDaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kYearDayIndex)), yearDayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kYearDayIndex, yearDayIndex, Fields::kUserIndex, userIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10922,14 +10122,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetHolidaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOperatingMode)), operatingMode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kHolidayIndex, holidayIndex, Fields::kLocalStartTime, localStartTime,
+                                   Fields::kLocalEndTime, localEndTime, Fields::kOperatingMode, operatingMode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -10971,11 +10165,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetHolidaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kHolidayIndex, holidayIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11008,15 +10198,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetHolidayScheduleResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalStartTime)), localStartTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLocalEndTime)), localEndTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOperatingMode)), operatingMode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kHolidayIndex, holidayIndex, Fields::kStatus, status,
+                                   Fields::kLocalStartTime, localStartTime, Fields::kLocalEndTime, localEndTime,
+                                   Fields::kOperatingMode, operatingMode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11061,11 +10245,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ClearHolidaySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHolidayIndex)), holidayIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kHolidayIndex, holidayIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11098,17 +10278,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetUser {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOperationType)), operationType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserName)), userName));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserUniqueId)), userUniqueId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserType)), userType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentialRule)), credentialRule));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOperationType, operationType, Fields::kUserIndex, userIndex,
+                                   Fields::kUserName, userName, Fields::kUserUniqueId, userUniqueId, Fields::kUserStatus,
+                                   userStatus, Fields::kUserType, userType, Fields::kCredentialRule, credentialRule);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11159,11 +10331,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetUser {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUserIndex, userIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11196,22 +10364,11 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetUserResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserName)), userName));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserUniqueId)), userUniqueId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserType)), userType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentialRule)), credentialRule));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentials)), credentials));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCreatorFabricIndex)), creatorFabricIndex));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLastModifiedFabricIndex)), lastModifiedFabricIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNextUserIndex)), nextUserIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUserIndex, userIndex, Fields::kUserName, userName, Fields::kUserUniqueId,
+                                   userUniqueId, Fields::kUserStatus, userStatus, Fields::kUserType, userType,
+                                   Fields::kCredentialRule, credentialRule, Fields::kCredentials, credentials,
+                                   Fields::kCreatorFabricIndex, creatorFabricIndex, Fields::kLastModifiedFabricIndex,
+                                   lastModifiedFabricIndex, Fields::kNextUserIndex, nextUserIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11271,11 +10428,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ClearUser {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUserIndex, userIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11308,16 +10461,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetCredential {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOperationType)), operationType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredential)), credential));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentialData)), credentialData));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserStatus)), userStatus));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserType)), userType));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOperationType, operationType, Fields::kCredential, credential,
+                                   Fields::kCredentialData, credentialData, Fields::kUserIndex, userIndex, Fields::kUserStatus,
+                                   userStatus, Fields::kUserType, userType);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11365,14 +10511,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetCredentialResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNextCredentialIndex)), nextCredentialIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kUserIndex, userIndex,
+                                   Fields::kNextCredentialIndex, nextCredentialIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11411,11 +10551,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetCredentialStatus {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredential)), credential));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCredential, credential);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11448,18 +10584,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetCredentialStatusResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredentialExists)), credentialExists));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUserIndex)), userIndex));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCreatorFabricIndex)), creatorFabricIndex));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLastModifiedFabricIndex)), lastModifiedFabricIndex));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNextCredentialIndex)), nextCredentialIndex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCredentialExists, credentialExists, Fields::kUserIndex, userIndex,
+                                   Fields::kCreatorFabricIndex, creatorFabricIndex, Fields::kLastModifiedFabricIndex,
+                                   lastModifiedFabricIndex, Fields::kNextCredentialIndex, nextCredentialIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11504,11 +10631,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ClearCredential {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCredential)), credential));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCredential, credential);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11939,10 +11062,7 @@ namespace Commands {
 namespace UpOrOpen {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -11972,10 +11092,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace DownOrClose {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12005,10 +11122,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StopMotion {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12038,11 +11152,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GoToLiftValue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLiftValue)), liftValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLiftValue, liftValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12075,12 +11185,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GoToLiftPercentage {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLiftPercent100thsValue)), liftPercent100thsValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kLiftPercent100thsValue, liftPercent100thsValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12113,11 +11218,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GoToTiltValue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTiltValue)), tiltValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTiltValue, tiltValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12150,12 +11251,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GoToTiltPercentage {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTiltPercent100thsValue)), tiltPercent100thsValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTiltPercent100thsValue, tiltPercent100thsValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12291,11 +11387,7 @@ namespace Commands {
 namespace BarrierControlGoToPercent {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPercentOpen)), percentOpen));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kPercentOpen, percentOpen);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -12328,10 +11420,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace BarrierControlStop {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13094,13 +12183,8 @@ namespace Structs {
 namespace ThermostatScheduleTransition {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHeatSetpoint)), heatSetpoint));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCoolSetpoint)), coolSetpoint));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTransitionTime, transitionTime, Fields::kHeatSetpoint, heatSetpoint,
+                                   Fields::kCoolSetpoint, coolSetpoint);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13145,12 +12229,7 @@ namespace Commands {
 namespace SetpointRaiseLower {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMode)), mode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAmount)), amount));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMode, mode, Fields::kAmount, amount);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13186,16 +12265,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetWeeklyScheduleResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNumberOfTransitionsForSequence)),
-                                           numberOfTransitionsForSequence));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDayOfWeekForSequence)), dayOfWeekForSequence));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kModeForSequence)), modeForSequence));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitions)), transitions));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNumberOfTransitionsForSequence, numberOfTransitionsForSequence,
+                                   Fields::kDayOfWeekForSequence, dayOfWeekForSequence, Fields::kModeForSequence, modeForSequence,
+                                   Fields::kTransitions, transitions);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13237,16 +12309,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SetWeeklySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNumberOfTransitionsForSequence)),
-                                           numberOfTransitionsForSequence));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDayOfWeekForSequence)), dayOfWeekForSequence));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kModeForSequence)), modeForSequence));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitions)), transitions));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNumberOfTransitionsForSequence, numberOfTransitionsForSequence,
+                                   Fields::kDayOfWeekForSequence, dayOfWeekForSequence, Fields::kModeForSequence, modeForSequence,
+                                   Fields::kTransitions, transitions);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13288,12 +12353,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetWeeklySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDaysToReturn)), daysToReturn));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kModeToReturn)), modeToReturn));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kDaysToReturn, daysToReturn, Fields::kModeToReturn, modeToReturn);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13329,10 +12389,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ClearWeeklySchedule {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13662,15 +12719,8 @@ namespace Commands {
 namespace MoveToHue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHue)), hue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDirection)), direction));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kHue, hue, Fields::kDirection, direction, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13715,14 +12765,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveHue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRate)), rate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMoveMode, moveMode, Fields::kRate, rate, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13764,15 +12808,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StepHue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepMode, stepMode, Fields::kStepSize, stepSize, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13817,14 +12854,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveToSaturation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSaturation)), saturation));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kSaturation, saturation, Fields::kTransitionTime, transitionTime,
+                                   Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13866,14 +12897,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveSaturation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRate)), rate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMoveMode, moveMode, Fields::kRate, rate, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13915,15 +12940,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StepSaturation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepMode, stepMode, Fields::kStepSize, stepSize, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -13968,15 +12986,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveToHueAndSaturation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHue)), hue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSaturation)), saturation));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kHue, hue, Fields::kSaturation, saturation, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14021,15 +13032,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveToColor {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorX)), colorX));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorY)), colorY));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kColorX, colorX, Fields::kColorY, colorY, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14074,14 +13078,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveColor {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRateX)), rateX));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRateY)), rateY));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kRateX, rateX, Fields::kRateY, rateY, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14123,15 +13121,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StepColor {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepX)), stepX));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepY)), stepY));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepX, stepX, Fields::kStepY, stepY, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14176,14 +13167,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveToColorTemperature {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorTemperature)), colorTemperature));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kColorTemperature, colorTemperature, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14225,15 +13210,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedMoveToHue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEnhancedHue)), enhancedHue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDirection)), direction));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kEnhancedHue, enhancedHue, Fields::kDirection, direction,
+                                   Fields::kTransitionTime, transitionTime, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14278,14 +13257,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedMoveHue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRate)), rate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMoveMode, moveMode, Fields::kRate, rate, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14327,15 +13300,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedStepHue {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepMode, stepMode, Fields::kStepSize, stepSize, Fields::kTransitionTime,
+                                   transitionTime, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14380,15 +13346,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace EnhancedMoveToHueAndSaturation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEnhancedHue)), enhancedHue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSaturation)), saturation));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kEnhancedHue, enhancedHue, Fields::kSaturation, saturation,
+                                   Fields::kTransitionTime, transitionTime, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14433,17 +13393,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ColorLoopSet {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUpdateFlags)), updateFlags));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAction)), action));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDirection)), direction));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTime)), time));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartHue)), startHue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUpdateFlags, updateFlags, Fields::kAction, action, Fields::kDirection,
+                                   direction, Fields::kTime, time, Fields::kStartHue, startHue, Fields::kOptionsMask, optionsMask,
+                                   Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14494,12 +13446,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StopMoveStep {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOptionsMask, optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14535,18 +13482,10 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace MoveColorTemperature {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMoveMode)), moveMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kRate)), rate));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorTemperatureMinimumMireds)),
-                                           colorTemperatureMinimumMireds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorTemperatureMaximumMireds)),
-                                           colorTemperatureMaximumMireds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMoveMode, moveMode, Fields::kRate, rate,
+                                   Fields::kColorTemperatureMinimumMireds, colorTemperatureMinimumMireds,
+                                   Fields::kColorTemperatureMaximumMireds, colorTemperatureMaximumMireds, Fields::kOptionsMask,
+                                   optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -14594,19 +13533,10 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StepColorTemperature {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepMode)), stepMode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStepSize)), stepSize));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTransitionTime)), transitionTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorTemperatureMinimumMireds)),
-                                           colorTemperatureMinimumMireds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColorTemperatureMaximumMireds)),
-                                           colorTemperatureMaximumMireds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsMask)), optionsMask));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionsOverride)), optionsOverride));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStepMode, stepMode, Fields::kStepSize, stepSize, Fields::kTransitionTime,
+                                   transitionTime, Fields::kColorTemperatureMinimumMireds, colorTemperatureMinimumMireds,
+                                   Fields::kColorTemperatureMaximumMireds, colorTemperatureMaximumMireds, Fields::kOptionsMask,
+                                   optionsMask, Fields::kOptionsOverride, optionsOverride);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15304,15 +14234,8 @@ namespace Structs {
 namespace ChannelInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMajorNumber)), majorNumber));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMinorNumber)), minorNumber));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCallSign)), callSign));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAffiliateCallSign)), affiliateCallSign));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMajorNumber, majorNumber, Fields::kMinorNumber, minorNumber, Fields::kName,
+                                   name, Fields::kCallSign, callSign, Fields::kAffiliateCallSign, affiliateCallSign);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15360,14 +14283,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace LineupInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOperatorName)), operatorName));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLineupName)), lineupName));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPostalCode)), postalCode));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLineupInfoType)), lineupInfoType));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kOperatorName, operatorName, Fields::kLineupName, lineupName,
+                                   Fields::kPostalCode, postalCode, Fields::kLineupInfoType, lineupInfoType);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15415,11 +14332,7 @@ namespace Commands {
 namespace ChangeChannel {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMatch)), match));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMatch, match);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15452,12 +14365,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ChangeChannelResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15493,12 +14401,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ChangeChannelByNumber {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMajorNumber)), majorNumber));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMinorNumber)), minorNumber));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMajorNumber, majorNumber, Fields::kMinorNumber, minorNumber);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15534,11 +14437,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SkipChannel {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCount)), count));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCount, count);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15616,12 +14515,7 @@ namespace Structs {
 namespace TargetInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIdentifier)), identifier));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIdentifier, identifier, Fields::kName, name);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15663,12 +14557,7 @@ namespace Commands {
 namespace NavigateTarget {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTarget)), target));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTarget, target, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15704,12 +14593,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NavigateTargetResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15787,12 +14671,7 @@ namespace Structs {
 namespace PlaybackPosition {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kUpdatedAt)), updatedAt));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPosition)), position));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kUpdatedAt, updatedAt, Fields::kPosition, position);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15834,10 +14713,7 @@ namespace Commands {
 namespace Play {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15867,10 +14743,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Pause {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15900,10 +14773,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StopPlayback {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15933,10 +14803,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StartOver {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15966,10 +14833,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Previous {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -15999,10 +14863,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Next {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16032,10 +14893,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Rewind {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16065,10 +14923,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace FastForward {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16098,12 +14953,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SkipForward {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDeltaPositionMilliseconds)), deltaPositionMilliseconds));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kDeltaPositionMilliseconds, deltaPositionMilliseconds);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16136,12 +14986,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SkipBackward {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDeltaPositionMilliseconds)), deltaPositionMilliseconds));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kDeltaPositionMilliseconds, deltaPositionMilliseconds);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16174,12 +15019,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace PlaybackResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16215,11 +15055,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Seek {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPosition)), position));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kPosition, position);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16309,14 +15145,8 @@ namespace Structs {
 namespace InputInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIndex)), index));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kInputType)), inputType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDescription)), description));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIndex, index, Fields::kInputType, inputType, Fields::kName, name,
+                                   Fields::kDescription, description);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16364,11 +15194,7 @@ namespace Commands {
 namespace SelectInput {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIndex)), index));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIndex, index);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16401,10 +15227,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ShowInputStatus {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16434,10 +15257,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace HideInputStatus {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16467,12 +15287,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RenameInput {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIndex)), index));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIndex, index, Fields::kName, name);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16551,10 +15366,7 @@ namespace Commands {
 namespace Sleep {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16621,11 +15433,7 @@ namespace Commands {
 namespace SendKey {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kKeyCode)), keyCode));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kKeyCode, keyCode);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16658,11 +15466,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SendKeyResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16731,13 +15535,7 @@ namespace Structs {
 namespace Dimension {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWidth)), width));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kHeight)), height));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMetric)), metric));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kWidth, width, Fields::kHeight, height, Fields::kMetric, metric);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16779,12 +15577,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace AdditionalInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kName, name, Fields::kValue, value);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16823,13 +15616,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Parameter {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kExternalIDList)), externalIDList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kType, type, Fields::kValue, value, Fields::kExternalIDList,
+                                   externalIDList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16871,11 +15659,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ContentSearch {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kParameterList)), parameterList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kParameterList, parameterList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16911,13 +15695,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StyleInformation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kImageUrl)), imageUrl));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kColor)), color));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSize)), size));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kImageUrl, imageUrl, Fields::kColor, color, Fields::kSize, size);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -16959,16 +15737,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace BrandingInformation {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProviderName)), providerName));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBackground)), background));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kLogo)), logo));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProgressBar)), progressBar));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSplash)), splash));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWaterMark)), waterMark));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kProviderName, providerName, Fields::kBackground, background, Fields::kLogo,
+                                   logo, Fields::kProgressBar, progressBar, Fields::kSplash, splash, Fields::kWaterMark, waterMark);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17022,13 +15792,7 @@ namespace Commands {
 namespace LaunchContent {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSearch)), search));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAutoPlay)), autoPlay));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kSearch, search, Fields::kAutoPlay, autoPlay, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17067,14 +15831,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace LaunchURL {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kContentURL)), contentURL));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kDisplayString)), displayString));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kBrandingInformation)), brandingInformation));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kContentURL, contentURL, Fields::kDisplayString, displayString,
+                                   Fields::kBrandingInformation, brandingInformation);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17113,12 +15871,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace LaunchResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17196,13 +15949,7 @@ namespace Structs {
 namespace OutputInfo {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIndex)), index));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOutputType)), outputType));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIndex, index, Fields::kOutputType, outputType, Fields::kName, name);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17247,11 +15994,7 @@ namespace Commands {
 namespace SelectOutput {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIndex)), index));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIndex, index);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17284,12 +16027,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace RenameOutput {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIndex)), index));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kName)), name));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kIndex, index, Fields::kName, name);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17367,12 +16105,7 @@ namespace Structs {
 namespace Application {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCatalogVendorId)), catalogVendorId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kApplicationId)), applicationId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCatalogVendorId, catalogVendorId, Fields::kApplicationId, applicationId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17411,12 +16144,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ApplicationEP {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kApplication)), application));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kEndpoint)), endpoint));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kApplication, application, Fields::kEndpoint, endpoint);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17458,12 +16186,7 @@ namespace Commands {
 namespace LaunchApp {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kApplication)), application));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kApplication, application, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17499,11 +16222,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace StopApp {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kApplication)), application));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kApplication, application);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17536,11 +16255,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace HideApp {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kApplication)), application));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kApplication, application);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17573,12 +16288,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace LauncherResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kData)), data));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStatus, status, Fields::kData, data);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17656,12 +16366,7 @@ namespace Structs {
 namespace ApplicationBasicApplication {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCatalogVendorId)), catalogVendorId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kApplicationId)), applicationId));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kCatalogVendorId, catalogVendorId, Fields::kApplicationId, applicationId);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17764,12 +16469,7 @@ namespace Commands {
 namespace GetSetupPIN {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTempAccountIdentifier)), tempAccountIdentifier));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTempAccountIdentifier, tempAccountIdentifier);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17802,11 +16502,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetSetupPINResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSetupPIN)), setupPIN));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kSetupPIN, setupPIN);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17839,13 +16535,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Login {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTempAccountIdentifier)), tempAccountIdentifier));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kSetupPIN)), setupPIN));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kTempAccountIdentifier, tempAccountIdentifier, Fields::kSetupPIN, setupPIN);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17881,10 +16571,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Logout {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -17951,16 +16638,9 @@ namespace Commands {
 namespace GetProfileInfoResponseCommand {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProfileCount)), profileCount));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProfileIntervalPeriod)), profileIntervalPeriod));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMaxNumberOfIntervals)), maxNumberOfIntervals));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kListOfAttributes)), listOfAttributes));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kProfileCount, profileCount, Fields::kProfileIntervalPeriod,
+                                   profileIntervalPeriod, Fields::kMaxNumberOfIntervals, maxNumberOfIntervals,
+                                   Fields::kListOfAttributes, listOfAttributes);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18002,10 +16682,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetProfileInfoCommand {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18035,18 +16712,9 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetMeasurementProfileResponseCommand {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartTime)), startTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStatus)), status));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kProfileIntervalPeriod)), profileIntervalPeriod));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNumberOfIntervalsDelivered)), numberOfIntervalsDelivered));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttributeId)), attributeId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kIntervals)), intervals));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kStartTime, startTime, Fields::kStatus, status,
+                                   Fields::kProfileIntervalPeriod, profileIntervalPeriod, Fields::kNumberOfIntervalsDelivered,
+                                   numberOfIntervalsDelivered, Fields::kAttributeId, attributeId, Fields::kIntervals, intervals);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18094,13 +16762,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace GetMeasurementProfileCommand {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kAttributeId)), attributeId));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStartTime)), startTime));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNumberOfIntervals)), numberOfIntervals));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kAttributeId, attributeId, Fields::kStartTime, startTime,
+                                   Fields::kNumberOfIntervals, numberOfIntervals);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18559,18 +17222,8 @@ namespace Structs {
 namespace SimpleStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kA)), a));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kB)), b));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kC)), c));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kD)), d));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kE)), e));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kF)), f));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kG)), g));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kH)), h));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kA, a, Fields::kB, b, Fields::kC, c, Fields::kD, d, Fields::kE, e,
+                                   Fields::kF, f, Fields::kG, g, Fields::kH, h);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18738,26 +17391,12 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NullablesAndOptionalsStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableInt)), nullableInt));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalInt)), optionalInt));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalInt)), nullableOptionalInt));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableString)), nullableString));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalString)), optionalString));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalString)), nullableOptionalString));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableStruct)), nullableStruct));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalStruct)), optionalStruct));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStruct)), nullableOptionalStruct));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableList)), nullableList));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalList)), optionalList));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalList)), nullableOptionalList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNullableInt, nullableInt, Fields::kOptionalInt, optionalInt,
+                                   Fields::kNullableOptionalInt, nullableOptionalInt, Fields::kNullableString, nullableString,
+                                   Fields::kOptionalString, optionalString, Fields::kNullableOptionalString, nullableOptionalString,
+                                   Fields::kNullableStruct, nullableStruct, Fields::kOptionalStruct, optionalStruct,
+                                   Fields::kNullableOptionalStruct, nullableOptionalStruct, Fields::kNullableList, nullableList,
+                                   Fields::kOptionalList, optionalList, Fields::kNullableOptionalList, nullableOptionalList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18826,13 +17465,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NestedStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kA)), a));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kB)), b));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kC)), c));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kA, a, Fields::kB, b, Fields::kC, c);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18874,17 +17507,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace NestedStructList {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kA)), a));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kB)), b));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kC)), c));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kD)), d));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kE)), e));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kF)), f));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kG)), g));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kA, a, Fields::kB, b, Fields::kC, c, Fields::kD, d, Fields::kE, e,
+                                   Fields::kF, f, Fields::kG, g);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18938,11 +17562,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace DoubleNestedStructList {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kA)), a));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kA, a);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -18978,12 +17598,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestListStructOctet {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMember1)), member1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMember2)), member2));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kMember1, member1, Fields::kMember2, member2);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19025,10 +17640,7 @@ namespace Commands {
 namespace Test {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19058,11 +17670,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestSpecificResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kReturnValue)), returnValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kReturnValue, returnValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19095,10 +17703,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestNotHandled {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19128,11 +17733,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestAddArgumentsResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kReturnValue)), returnValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kReturnValue, returnValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19165,10 +17766,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestSpecific {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19198,11 +17796,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestSimpleArgumentResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kReturnValue)), returnValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kReturnValue, returnValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19235,10 +17829,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestUnknownCommand {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19268,16 +17859,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestStructArrayArgumentResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg2)), arg2));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg3)), arg3));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg4)), arg4));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg5)), arg5));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg6)), arg6));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1, Fields::kArg2, arg2, Fields::kArg3, arg3, Fields::kArg4, arg4,
+                                   Fields::kArg5, arg5, Fields::kArg6, arg6);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19325,12 +17908,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestAddArguments {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg2)), arg2));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1, Fields::kArg2, arg2);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19366,11 +17944,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestListInt8UReverseResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19403,11 +17977,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestSimpleArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19440,12 +18010,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestEnumsResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg2)), arg2));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1, Fields::kArg2, arg2);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19481,16 +18046,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestStructArrayArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg2)), arg2));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg3)), arg3));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg4)), arg4));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg5)), arg5));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg6)), arg6));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1, Fields::kArg2, arg2, Fields::kArg3, arg3, Fields::kArg4, arg4,
+                                   Fields::kArg5, arg5, Fields::kArg6, arg6);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19538,14 +18095,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestNullableOptionalResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWasPresent)), wasPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kWasNull)), wasNull));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOriginalValue)), originalValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kWasPresent, wasPresent, Fields::kWasNull, wasNull, Fields::kValue, value,
+                                   Fields::kOriginalValue, originalValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19587,11 +18138,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestStructArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19624,62 +18171,26 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestComplexNullableOptionalResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableIntWasNull)), nullableIntWasNull));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableIntValue)), nullableIntValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalIntWasPresent)), optionalIntWasPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalIntValue)), optionalIntValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalIntWasPresent)),
-                                           nullableOptionalIntWasPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalIntWasNull)), nullableOptionalIntWasNull));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalIntValue)), nullableOptionalIntValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableStringWasNull)), nullableStringWasNull));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableStringValue)), nullableStringValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalStringWasPresent)), optionalStringWasPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalStringValue)), optionalStringValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStringWasPresent)),
-                                           nullableOptionalStringWasPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStringWasNull)),
-                                           nullableOptionalStringWasNull));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStringValue)),
-                                           nullableOptionalStringValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableStructWasNull)), nullableStructWasNull));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableStructValue)), nullableStructValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalStructWasPresent)), optionalStructWasPresent));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalStructValue)), optionalStructValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStructWasPresent)),
-                                           nullableOptionalStructWasPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStructWasNull)),
-                                           nullableOptionalStructWasNull));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStructValue)),
-                                           nullableOptionalStructValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableListWasNull)), nullableListWasNull));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableListValue)), nullableListValue));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalListWasPresent)), optionalListWasPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalListValue)), optionalListValue));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalListWasPresent)),
-                                           nullableOptionalListWasPresent));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalListWasNull)),
-                                           nullableOptionalListWasNull));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalListValue)), nullableOptionalListValue));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNullableIntWasNull, nullableIntWasNull, Fields::kNullableIntValue,
+                                   nullableIntValue, Fields::kOptionalIntWasPresent, optionalIntWasPresent,
+                                   Fields::kOptionalIntValue, optionalIntValue, Fields::kNullableOptionalIntWasPresent,
+                                   nullableOptionalIntWasPresent, Fields::kNullableOptionalIntWasNull, nullableOptionalIntWasNull,
+                                   Fields::kNullableOptionalIntValue, nullableOptionalIntValue, Fields::kNullableStringWasNull,
+                                   nullableStringWasNull, Fields::kNullableStringValue, nullableStringValue,
+                                   Fields::kOptionalStringWasPresent, optionalStringWasPresent, Fields::kOptionalStringValue,
+                                   optionalStringValue, Fields::kNullableOptionalStringWasPresent, nullableOptionalStringWasPresent,
+                                   Fields::kNullableOptionalStringWasNull, nullableOptionalStringWasNull,
+                                   Fields::kNullableOptionalStringValue, nullableOptionalStringValue,
+                                   Fields::kNullableStructWasNull, nullableStructWasNull, Fields::kNullableStructValue,
+                                   nullableStructValue, Fields::kOptionalStructWasPresent, optionalStructWasPresent,
+                                   Fields::kOptionalStructValue, optionalStructValue, Fields::kNullableOptionalStructWasPresent,
+                                   nullableOptionalStructWasPresent, Fields::kNullableOptionalStructWasNull,
+                                   nullableOptionalStructWasNull, Fields::kNullableOptionalStructValue, nullableOptionalStructValue,
+                                   Fields::kNullableListWasNull, nullableListWasNull, Fields::kNullableListValue, nullableListValue,
+                                   Fields::kOptionalListWasPresent, optionalListWasPresent, Fields::kOptionalListValue,
+                                   optionalListValue, Fields::kNullableOptionalListWasPresent, nullableOptionalListWasPresent,
+                                   Fields::kNullableOptionalListWasNull, nullableOptionalListWasNull,
+                                   Fields::kNullableOptionalListValue, nullableOptionalListValue);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19793,11 +18304,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestNestedStructArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19830,11 +18337,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace BooleanResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kValue, value);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19867,11 +18370,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestListStructArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19904,11 +18403,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SimpleStructResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19941,11 +18436,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestListInt8UArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -19978,11 +18469,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestEmitTestEventResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kValue, value);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20015,11 +18502,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestNestedStructListArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20052,11 +18535,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestEmitTestFabricScopedEventResponse {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kValue)), value));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kValue, value);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20089,11 +18568,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestListNestedStructListArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20126,11 +18601,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestListInt8UReverseRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20163,12 +18634,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestEnumsRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg2)), arg2));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1, Fields::kArg2, arg2);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20204,11 +18670,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestNullableOptionalRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20241,26 +18703,12 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestComplexNullableOptionalRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableInt)), nullableInt));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalInt)), optionalInt));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalInt)), nullableOptionalInt));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableString)), nullableString));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalString)), optionalString));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalString)), nullableOptionalString));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableStruct)), nullableStruct));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalStruct)), optionalStruct));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalStruct)), nullableOptionalStruct));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableList)), nullableList));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kOptionalList)), optionalList));
-    ReturnErrorOnFailure(
-        DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNullableOptionalList)), nullableOptionalList));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kNullableInt, nullableInt, Fields::kOptionalInt, optionalInt,
+                                   Fields::kNullableOptionalInt, nullableOptionalInt, Fields::kNullableString, nullableString,
+                                   Fields::kOptionalString, optionalString, Fields::kNullableOptionalString, nullableOptionalString,
+                                   Fields::kNullableStruct, nullableStruct, Fields::kOptionalStruct, optionalStruct,
+                                   Fields::kNullableOptionalStruct, nullableOptionalStruct, Fields::kNullableList, nullableList,
+                                   Fields::kOptionalList, optionalList, Fields::kNullableOptionalList, nullableOptionalList);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20326,11 +18774,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SimpleStructEchoRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20363,10 +18807,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TimedInvokeRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20396,11 +18837,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestSimpleOptionalArgumentRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20433,13 +18870,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestEmitTestEventRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg2)), arg2));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg3)), arg3));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1, Fields::kArg2, arg2, Fields::kArg3, arg3);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20478,11 +18909,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace TestEmitTestFabricScopedEventRequest {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kArg1)), arg1));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kArg1, arg1);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20892,15 +19319,8 @@ namespace Commands {
 namespace FailAtFault {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kId)), id));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNumCallsToSkip)), numCallsToSkip));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNumCallsToFail)), numCallsToFail));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kTakeMutex)), takeMutex));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kType, type, Fields::kId, id, Fields::kNumCallsToSkip, numCallsToSkip,
+                                   Fields::kNumCallsToFail, numCallsToFail, Fields::kTakeMutex, takeMutex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
@@ -20945,13 +19365,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace FailRandomlyAtFault {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kType)), type));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kId)), id));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kPercentage)), percentage));
-    ReturnErrorOnFailure(writer.EndContainer(outer));
-    return CHIP_NO_ERROR;
+    return DataModel::EncodeStruct(writer, tag, Fields::kType, type, Fields::kId, id, Fields::kPercentage, percentage);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)